@@ -0,0 +1,122 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_PROFILER__PROFILER_HPP_
+#define SIMPLE_PROFILER__PROFILER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace common
+{
+namespace profiler
+{
+using Clock = std::chrono::steady_clock;
+
+/**
+ * @brief a span recorded while the profiler is enabled, into a buffer of the recording thread.
+ *
+ * The name must outlive the profiler, i.e. be a string literal or returned by intern().
+ */
+struct Span
+{
+  const char * name;
+
+  Clock::time_point begin;
+
+  Clock::time_point end;
+};
+
+struct Cost
+{
+  std::string name;
+
+  std::chrono::nanoseconds duration;  // NOTE: Inclusive of nested spans.
+
+  std::size_t count;
+};
+
+/**
+ * @brief whether PROFILE_SCOPE records spans, i.e. the profiler is built with
+ * SIMPLE_PROFILER_ENABLED=ON.
+ */
+auto compiled() noexcept -> bool;
+
+auto enabledFlag() noexcept -> std::atomic<bool> &;
+
+inline auto enabled() noexcept -> bool { return enabledFlag().load(std::memory_order_relaxed); }
+
+auto enable(bool = true) -> void;
+
+auto intern(const std::string &) -> const char *;
+
+auto record(const char * name, const Clock::time_point & begin, const Clock::time_point & end)
+  -> void;
+
+/**
+ * @brief the costs of the spans recorded since the previous call, summed up by name across threads,
+ * at most `size` of them, the most expensive first.
+ */
+auto summarize(std::size_t size) -> std::vector<Cost>;
+
+/**
+ * @brief write every span recorded so far in the Chrome trace event format (chrome://tracing,
+ * Perfetto).
+ */
+auto writeChromeTrace(const std::string & path) -> void;
+
+auto clear() -> void;
+
+class Scope
+{
+  const char * const name;
+
+  const bool active;
+
+  const Clock::time_point begin;
+
+public:
+  explicit Scope(const char * name) noexcept
+  : name(name), active(enabled()), begin(active ? Clock::now() : Clock::time_point())
+  {
+  }
+
+  ~Scope()
+  {
+    if (active) {
+      record(name, begin, Clock::now());
+    }
+  }
+
+  Scope(const Scope &) = delete;
+
+  Scope & operator=(const Scope &) = delete;
+};
+}  // namespace profiler
+}  // namespace common
+
+#define SIMPLE_PROFILER_CONCATENATE_(X, Y) X##Y
+#define SIMPLE_PROFILER_CONCATENATE(X, Y) SIMPLE_PROFILER_CONCATENATE_(X, Y)
+
+#ifdef SIMPLE_PROFILER_ENABLED
+#define PROFILE_SCOPE(NAME) \
+  const ::common::profiler::Scope SIMPLE_PROFILER_CONCATENATE(profile_scope_, __COUNTER__)(NAME)
+#else
+#define PROFILE_SCOPE(NAME) static_assert(true, "")
+#endif
+
+#endif  // SIMPLE_PROFILER__PROFILER_HPP_
@@ -0,0 +1,203 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <simple_profiler/profiler.hpp>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace common
+{
+namespace profiler
+{
+namespace
+{
+/**
+ * @brief the number of spans a thread records at most, so that a long run without clear() does not
+ * exhaust the memory.
+ */
+constexpr std::size_t capacity = 1 << 20;
+
+struct Buffer
+{
+  std::mutex mutex;
+
+  std::vector<Span> spans;
+
+  std::size_t summarized = 0;  // NOTE: Number of spans already passed to summarize().
+
+  std::size_t id;
+
+  explicit Buffer(std::size_t id) : id(id) {}
+};
+
+struct Registry
+{
+  std::mutex mutex;
+
+  std::vector<std::shared_ptr<Buffer>> buffers;  // NOTE: Outlive the threads that recorded them.
+
+  std::unordered_set<std::string> names;
+
+  const Clock::time_point origin = Clock::now();
+};
+
+auto registry() -> Registry &
+{
+  static Registry registry;
+  return registry;
+}
+
+auto buffer() -> Buffer &
+{
+  thread_local const auto buffer = []() {
+    auto & registry = profiler::registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.buffers.push_back(std::make_shared<Buffer>(registry.buffers.size()));
+    return registry.buffers.back();
+  }();
+  return *buffer;
+}
+}  // namespace
+
+auto compiled() noexcept -> bool
+{
+#ifdef SIMPLE_PROFILER_ENABLED
+  return true;
+#else
+  return false;
+#endif
+}
+
+auto enabledFlag() noexcept -> std::atomic<bool> &
+{
+  static std::atomic<bool> flag{false};
+  return flag;
+}
+
+auto enable(bool enabled) -> void
+{
+  registry();  // NOTE: The origin of the trace is the first call of enable().
+  enabledFlag().store(enabled, std::memory_order_relaxed);
+}
+
+auto intern(const std::string & name) -> const char *
+{
+  auto & registry = profiler::registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  return registry.names.insert(name).first->c_str();
+}
+
+auto record(const char * name, const Clock::time_point & begin, const Clock::time_point & end)
+  -> void
+{
+  auto & buffer = profiler::buffer();
+  std::lock_guard<std::mutex> lock(buffer.mutex);
+  if (buffer.spans.size() < capacity) {
+    buffer.spans.push_back({name, begin, end});
+  }
+}
+
+auto summarize(std::size_t size) -> std::vector<Cost>
+{
+  std::unordered_map<std::string, Cost> costs;
+  {
+    auto & registry = profiler::registry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    for (const auto & buffer : registry.buffers) {
+      std::lock_guard<std::mutex> lock(buffer->mutex);
+      for (auto i = buffer->summarized; i < buffer->spans.size(); ++i) {
+        const auto & span = buffer->spans[i];
+        auto & cost = costs.emplace(span.name, Cost{span.name, {}, 0}).first->second;
+        cost.duration += span.end - span.begin;
+        ++cost.count;
+      }
+      buffer->summarized = buffer->spans.size();
+    }
+  }
+
+  std::vector<Cost> result;
+  result.reserve(costs.size());
+  for (auto && each : costs) {
+    result.push_back(std::move(each.second));
+  }
+
+  const auto more_expensive = [](const Cost & a, const Cost & b) {
+    return a.duration > b.duration;
+  };
+  if (size < result.size()) {
+    std::partial_sort(result.begin(), result.begin() + size, result.end(), more_expensive);
+    result.resize(size);
+  } else {
+    std::sort(result.begin(), result.end(), more_expensive);
+  }
+  return result;
+}
+
+auto writeChromeTrace(const std::string & path) -> void
+{
+  const auto escaped = [](const char * name) {
+    std::string result;
+    for (; *name; ++name) {
+      if (*name == '"' or *name == '\\') {
+        result.push_back('\\');
+      }
+      result.push_back(*name);
+    }
+    return result;
+  };
+
+  const auto microseconds = [](const Clock::duration & duration) {
+    return std::chrono::duration<double, std::micro>(duration).count();
+  };
+
+  std::ofstream file(path);
+  file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+
+  auto & registry = profiler::registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  auto first = true;
+  for (const auto & buffer : registry.buffers) {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    for (const auto & span : buffer->spans) {
+      file << (first ? "\n" : ",\n") << "{\"name\":\"" << escaped(span.name)
+           << "\",\"ph\":\"X\",\"pid\":0,\"tid\":" << buffer->id
+           << ",\"ts\":" << microseconds(span.begin - registry.origin)
+           << ",\"dur\":" << microseconds(span.end - span.begin) << "}";
+      first = false;
+    }
+  }
+
+  file << "\n]}\n";
+}
+
+auto clear() -> void
+{
+  auto & registry = profiler::registry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto & buffer : registry.buffers) {
+    std::lock_guard<std::mutex> lock(buffer->mutex);
+    buffer->spans.clear();
+    buffer->summarized = 0;
+  }
+}
+}  // namespace profiler
+}  // namespace common
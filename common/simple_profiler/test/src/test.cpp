@@ -0,0 +1,95 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <simple_profiler/profiler.hpp>
+#include <string>
+#include <thread>
+
+TEST(PROFILER, COMPILED)
+{
+#ifdef SIMPLE_PROFILER_ENABLED
+  EXPECT_TRUE(common::profiler::compiled());
+#else
+  EXPECT_FALSE(common::profiler::compiled());
+#endif
+}
+
+TEST(PROFILER, NOTHING_IS_RECORDED_WHILE_DISABLED)
+{
+  common::profiler::clear();
+  common::profiler::enable(false);
+  {
+    common::profiler::Scope scope("disabled");
+  }
+  EXPECT_TRUE(common::profiler::summarize(10).empty());
+}
+
+TEST(PROFILER, SUMMARIZE)
+{
+  common::profiler::clear();
+  common::profiler::enable();
+  for (auto i = 0; i < 3; ++i) {
+    common::profiler::Scope outer("outer");
+    {
+      common::profiler::Scope inner("inner");
+    }
+  }
+  std::thread([]() { common::profiler::Scope scope("outer"); }).join();
+  common::profiler::enable(false);
+
+  const auto costs = common::profiler::summarize(10);
+  ASSERT_EQ(costs.size(), 2U);
+  EXPECT_EQ(costs[0].name, "outer");
+  EXPECT_EQ(costs[0].count, 4U);
+  EXPECT_EQ(costs[1].name, "inner");
+  EXPECT_EQ(costs[1].count, 3U);
+  EXPECT_GE(costs[0].duration, costs[1].duration);
+
+  EXPECT_EQ(common::profiler::summarize(1).size(), 0U);  // NOTE: Summarized already.
+}
+
+TEST(PROFILER, INTERN)
+{
+  const auto name = common::profiler::intern(std::string("interned"));
+  EXPECT_EQ(name, common::profiler::intern("interned"));
+  EXPECT_EQ(std::string(name), "interned");
+}
+
+TEST(PROFILER, WRITE_CHROME_TRACE)
+{
+  common::profiler::clear();
+  common::profiler::enable();
+  {
+    common::profiler::Scope scope("\"quoted\"");
+  }
+  common::profiler::enable(false);
+
+  common::profiler::writeChromeTrace("/tmp/test_simple_profiler.json");
+
+  std::ifstream file("/tmp/test_simple_profiler.json");
+  const auto trace =
+    std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+  EXPECT_EQ(trace.find("{\"traceEvents\":["), 0U);
+  EXPECT_NE(trace.find("\"name\":\"\\\"quoted\\\"\",\"ph\":\"X\""), std::string::npos);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -29,6 +29,7 @@
 #include <concealer/transition_assertion.hpp>
 #include <concealer/utility/autoware_stream.hpp>
 #include <concealer/utility/visibility.hpp>
+#include <condition_variable>
 #include <exception>
 #include <future>
 #include <geometry_msgs/msg/twist_stamped.hpp>
@@ -59,11 +60,15 @@ class Autoware : public rclcpp::Node, public ContinuousTransformBroadcaster<Auto
 
   mutable std::mutex mutex;
 
+  mutable std::condition_variable received;
+
   std::promise<void> promise;
 
   std::future<void> future;
 
-  std::thread spinner;
+  rclcpp::executors::SingleThreadedExecutor executor;
+
+  std::thread spinner;  // NOTE: Sleeps until a message, a timer or shutdown wakes the executor.
 
   rclcpp::TimerBase::SharedPtr updater;
 
@@ -99,10 +104,11 @@ public:
   : rclcpp::Node("concealer", "simulation", rclcpp::NodeOptions().use_global_arguments(false)),
     future(std::move(promise.get_future())),
     spinner([this]() {
-      while (rclcpp::ok() and currentFuture().wait_for(std::chrono::milliseconds(1)) ==
+      executor.add_node(get_node_base_interface());
+      while (rclcpp::ok() and currentFuture().wait_for(std::chrono::milliseconds(0)) ==
                                 std::future_status::timeout) {
         try {
-          rclcpp::spin_some(get_node_base_interface());
+          executor.spin_until_future_complete(currentFuture());
         } catch (...) {
           thrown = std::current_exception();
         }
@@ -116,10 +122,11 @@ public:
   : rclcpp::Node("concealer", "simulation", rclcpp::NodeOptions().use_global_arguments(false)),
     future(std::move(promise.get_future())),
     spinner([this]() {
-      while (rclcpp::ok() and currentFuture().wait_for(std::chrono::milliseconds(1)) ==
+      executor.add_node(get_node_base_interface());
+      while (rclcpp::ok() and currentFuture().wait_for(std::chrono::milliseconds(0)) ==
                                 std::future_status::timeout) {
         try {
-          rclcpp::spin_some(get_node_base_interface());
+          executor.spin_until_future_complete(currentFuture());
         } catch (...) {
           thrown = std::current_exception();
         }
@@ -184,6 +191,9 @@ public:
 
   /*   */ auto lock() const { return std::unique_lock<std::mutex>(mutex); }
 
+  // NOTE: Must be called with the lock held, by each subscription callback.
+  /*   */ auto notify() const -> void { received.notify_all(); }
+
   /*   */ auto ready() const noexcept(false) -> bool;
 
   // different autowares accept different initial target speed
@@ -196,6 +206,25 @@ public:
   /*   */ auto set(const geometry_msgs::msg::Twist &) -> const geometry_msgs::msg::Twist &;
 
   virtual auto setVelocityLimit(double) -> void = 0;
+
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  Block until the predicate on the subscribed values holds, Autoware is
+   *  shut down, or the timeout expires. The predicate is evaluated with the
+   *  lock held each time a subscription delivers a message, so it must not
+   *  take the lock itself. Returns false only on timeout.
+   *
+   * ------------------------------------------------------------------------ */
+  template <typename Predicate>
+  auto waitFor(const std::chrono::steady_clock::duration & timeout, Predicate && satisfied)
+    -> bool
+  {
+    auto lock = this->lock();
+    return received.wait_for(lock, timeout, [&]() {
+      return future.wait_for(std::chrono::seconds(0)) == std::future_status::ready or
+             satisfied();
+    });
+  }
 };
 }  // namespace concealer
 
@@ -24,8 +24,7 @@ private:
 public:                                                                                            \
   auto request##TYPE(const TYPE::Request::SharedPtr & request)->void                               \
   {                                                                                                \
-    for (auto rate = rclcpp::WallRate(std::chrono::seconds(1));                                    \
-         not client_of_##TYPE->service_is_ready(); rate.sleep()) {                                 \
+    while (rclcpp::ok() and not client_of_##TYPE->wait_for_service(std::chrono::seconds(1))) {    \
       RCLCPP_INFO_STREAM(                                                                          \
         static_cast<Autoware &>(*this).get_logger(), #TYPE " service is not ready.");              \
     }                                                                                              \
@@ -85,6 +84,7 @@ public:                                                              \
     TOPIC, 1, [this](const TYPE::SharedPtr message) {                                       \
       const auto lock = static_cast<Autoware &>(*this).lock();                              \
       current_value_of_##TYPE = *message;                                                   \
+      static_cast<Autoware &>(*this).notify();                                              \
     }))
 
 #define CONCEALER_INIT_PUBLISHER(TYPE, TOPIC) \
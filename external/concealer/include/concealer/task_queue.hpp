@@ -15,43 +15,81 @@
 #ifndef CONCEALER__TASK_QUEUE_HPP_
 #define CONCEALER__TASK_QUEUE_HPP_
 
+#include <condition_variable>
 #include <exception>
 #include <functional>
 #include <future>
+#include <memory>
+#include <mutex>
 #include <queue>
 #include <thread>
 
 namespace concealer
 {
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Tasks are run one by one in the order they were delayed, on a single
+ *  dispatcher thread that sleeps on a condition variable while the queue is
+ *  empty. Each task has a future that becomes ready when the task completes.
+ *  If a task throws, no further tasks are run; the exception is rethrown by
+ *  rethrow() and is also stored into the future of that task. The futures of
+ *  tasks removed by cancel() (or left on destruction) are broken promises.
+ *
+ * -------------------------------------------------------------------------- */
 class TaskQueue
 {
   using Thunk = std::function<void()>;
 
+  mutable std::mutex mutex;
+
+  std::condition_variable condition;
+
   std::queue<Thunk> thunks;
 
-  std::promise<void> notifier;
+  bool running = false;
 
-  std::thread dispatcher;
+  bool stopped = false;
 
   std::exception_ptr thrown;
 
+  std::thread dispatcher;
+
 public:
   explicit TaskQueue();
 
   ~TaskQueue();
 
   template <typename F>
-  decltype(auto) delay(F && f)
+  auto delay(F && f) -> std::shared_future<void>
   {
-    return thunks.emplace([this, f]() {
-      try {
-        return f();
-      } catch (...) {
-        thrown = std::current_exception();
-      }
-    });
+    auto promise = std::make_shared<std::promise<void>>();
+
+    auto future = promise->get_future().share();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+
+      thunks.emplace([this, f, promise]() {
+        try {
+          f();
+          promise->set_value();
+        } catch (...) {
+          {
+            std::lock_guard<std::mutex> lock(mutex);
+            thrown = std::current_exception();
+          }
+          promise->set_exception(std::current_exception());
+        }
+      });
+    }
+
+    condition.notify_one();
+
+    return future;
   }
 
+  void cancel();
+
   bool exhausted() const noexcept;
 
   void rethrow() const noexcept(false);
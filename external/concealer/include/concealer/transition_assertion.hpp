@@ -57,16 +57,13 @@ struct TransitionAssertion
   void waitForAutowareStateToBe##STATE(                                                            \
     Thunk thunk = []() {}, const std::chrono::seconds & interval = std::chrono::seconds(1))        \
   {                                                                                                \
-    rclcpp::WallRate rate{interval};                                                               \
-    for (thunk(); static_cast<Autoware &>(*this).currentFuture().wait_for(                         \
-                    std::chrono::milliseconds(1)) == std::future_status::timeout and               \
-                  not static_cast<const Autoware &>(*this).is##STATE();                            \
-         rate.sleep()) {                                                                           \
-      remains -= std::chrono::duration_cast<std::chrono::seconds>(rate.period());                  \
+    for (thunk(); not static_cast<Autoware &>(*this).waitFor(                                      \
+           interval, [this]() { return static_cast<const Autoware &>(*this).is##STATE(); });       \
+         thunk()) {                                                                                \
+      remains -= interval;                                                                         \
       RCLCPP_INFO_STREAM(                                                                          \
         static_cast<Autoware &>(*this).get_logger(),                                               \
         "Simulator waiting for Autoware state to be " #STATE " (" << remains.count() << ").");     \
-      thunk();                                                                                     \
     }                                                                                              \
     RCLCPP_INFO_STREAM(                                                                            \
       static_cast<Autoware &>(*this).get_logger(),                                                 \
@@ -23,6 +23,11 @@ void Autoware::shutdownAutoware()
   {
     if (spinner.joinable()) {
       promise.set_value();
+      {
+        const auto lock = this->lock();  // NOTE: Wake up waitFor without losing the wakeup.
+        notify();
+      }
+      executor.cancel();
       spinner.join();
     }
   }
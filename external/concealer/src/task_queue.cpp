@@ -12,43 +12,70 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <chrono>
 #include <concealer/task_queue.hpp>
-#include <rclcpp/rclcpp.hpp>
 #include <utility>
 
 namespace concealer
 {
 TaskQueue::TaskQueue()
-: dispatcher(
-    [this](auto notification) {
-      using namespace std::literals::chrono_literals;
-      while (rclcpp::ok() and notification.wait_for(1ms) == std::future_status::timeout) {
-        if (not thunks.empty() and not thrown) {
-          // NOTE: To ensure that the task to be queued is completed as expected is the responsibility of the side to create a task.
-          std::thread(thunks.front()).join();
-          thunks.pop();
-        } else {
-          std::this_thread::sleep_for(100ms);
-        }
+: dispatcher([this]() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+      condition.wait(lock, [this]() { return stopped or (not thunks.empty() and not thrown); });
+
+      if (stopped) {
+        break;
+      }
+
+      auto thunk = std::move(thunks.front());
+      thunks.pop();
+      running = true;
+
+      lock.unlock();
+      {
+        // NOTE: To ensure that the task to be queued is completed as expected is the responsibility of the side to create a task.
+        thunk();
+        thunk = nullptr;  // NOTE: Release the captures of the task outside of the lock.
       }
-    },
-    std::move(notifier.get_future()))
+      lock.lock();
+
+      running = false;
+    }
+  })
 {
 }
 
 TaskQueue::~TaskQueue()
 {
   if (dispatcher.joinable()) {
-    notifier.set_value();
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopped = true;
+    }
+    condition.notify_one();
     dispatcher.join();
   }
 }
 
-bool TaskQueue::exhausted() const noexcept { return thunks.empty(); }
+void TaskQueue::cancel()
+{
+  std::queue<Thunk> cancelled;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::swap(thunks, cancelled);
+  }
+}
+
+bool TaskQueue::exhausted() const noexcept
+{
+  std::lock_guard<std::mutex> lock(mutex);
+  return thunks.empty() and not running;
+}
 
 void TaskQueue::rethrow() const
 {
+  std::lock_guard<std::mutex> lock(mutex);
   if (thrown) {
     std::rethrow_exception(thrown);
   }
@@ -0,0 +1,186 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <concealer/task_queue.hpp>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using concealer::TaskQueue;
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  A task that blocks the dispatcher of the queue until open() is called, so
+ *  that the tasks delayed after it are still pending. enter() waits until the
+ *  dispatcher runs it.
+ *
+ * -------------------------------------------------------------------------- */
+class Gate
+{
+  std::promise<void> entered, opened;
+
+  std::shared_future<void> entered_future = entered.get_future().share();
+
+  std::shared_future<void> opened_future = opened.get_future().share();
+
+public:
+  auto task()
+  {
+    const auto future = opened_future;
+    return [this, future]() {
+      entered.set_value();
+      future.wait();
+    };
+  }
+
+  void enter() const { entered_future.wait(); }
+
+  void open() { opened.set_value(); }
+};
+
+auto isBrokenPromise(const std::shared_future<void> & future)
+{
+  try {
+    future.get();
+  } catch (const std::future_error & error) {
+    return error.code() == std::future_errc::broken_promise;
+  }
+  return false;
+}
+
+auto waitUntilExhausted(const TaskQueue & queue)
+{
+  for (auto i = 0; i < 1000 and not queue.exhausted(); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+  return queue.exhausted();
+}
+
+TEST(TaskQueue, DelayReturnsFutureOfTask)
+{
+  TaskQueue queue;
+  std::atomic<bool> done{false};
+  const auto future = queue.delay([&]() { done = true; });
+  const auto copy = future;
+  ASSERT_EQ(copy.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_NO_THROW(future.get());
+  EXPECT_NO_THROW(copy.get());
+  EXPECT_TRUE(done);
+}
+
+TEST(TaskQueue, TasksRunInOrderOfDelay)
+{
+  TaskQueue queue;
+  std::vector<int> order;
+  std::shared_future<void> last;
+  for (auto i = 0; i < 100; ++i) {
+    last = queue.delay([&order, i]() { order.push_back(i); });
+  }
+  ASSERT_EQ(last.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  ASSERT_EQ(order.size(), 100u);
+  for (auto i = 0; i < 100; ++i) {
+    EXPECT_EQ(order[i], i);
+  }
+}
+
+TEST(TaskQueue, ExhaustedOnlyWithoutTasks)
+{
+  Gate gate;
+  TaskQueue queue;
+  EXPECT_TRUE(queue.exhausted());
+  queue.delay(gate.task());
+  const auto future = queue.delay([]() {});
+  EXPECT_FALSE(queue.exhausted());
+  gate.open();
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_TRUE(waitUntilExhausted(queue));
+}
+
+TEST(TaskQueue, CancelRemovesPendingTasks)
+{
+  Gate gate;
+  TaskQueue queue;
+  const auto running = queue.delay(gate.task());
+  gate.enter();
+  std::atomic<int> count{0};
+  std::vector<std::shared_future<void>> pending;
+  for (auto i = 0; i < 3; ++i) {
+    pending.push_back(queue.delay([&]() { ++count; }));
+  }
+  queue.cancel();
+  for (const auto & future : pending) {
+    EXPECT_TRUE(isBrokenPromise(future));
+  }
+  gate.open();
+  ASSERT_EQ(running.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_NO_THROW(running.get());  // NOTE: The task already running is not cancelled.
+  EXPECT_TRUE(waitUntilExhausted(queue));
+  EXPECT_EQ(count, 0);
+}
+
+TEST(TaskQueue, DelayAfterCancel)
+{
+  TaskQueue queue;
+  queue.cancel();
+  std::atomic<bool> done{false};
+  const auto future = queue.delay([&]() { done = true; });
+  ASSERT_EQ(future.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_TRUE(done);
+}
+
+TEST(TaskQueue, ThrowingTaskStopsQueue)
+{
+  TaskQueue queue;
+  const auto thrown = queue.delay([]() { throw std::runtime_error("task failed"); });
+  std::atomic<bool> done{false};
+  const auto next = queue.delay([&]() { done = true; });
+  ASSERT_EQ(thrown.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  EXPECT_THROW(thrown.get(), std::runtime_error);
+  EXPECT_THROW(queue.rethrow(), std::runtime_error);
+  EXPECT_EQ(next.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+  EXPECT_FALSE(queue.exhausted());
+  EXPECT_FALSE(done);
+}
+
+TEST(TaskQueue, ShutdownWaitsForRunningTaskOnly)
+{
+  std::atomic<bool> done{false};
+  std::atomic<int> count{0};
+  std::shared_future<void> pending;
+  {
+    TaskQueue queue;
+    std::promise<void> started;
+    queue.delay([&]() {
+      started.set_value();
+      std::this_thread::sleep_for(std::chrono::milliseconds(100));
+      done = true;
+    });
+    pending = queue.delay([&]() { ++count; });
+    started.get_future().wait();
+  }
+  EXPECT_TRUE(done);
+  EXPECT_TRUE(isBrokenPromise(pending));
+  EXPECT_EQ(count, 0);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
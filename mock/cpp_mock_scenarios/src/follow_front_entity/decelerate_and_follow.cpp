@@ -41,10 +41,10 @@ public:
 private:
   void onUpdate() override
   {
-    double ego_accel = api_.getEntityStatus("ego").action_status.accel.linear.x;
-    double ego_twist = api_.getEntityStatus("ego").action_status.twist.linear.x;
-    // double npc_accel = api_.getEntityStatus("npc").action_status.accel.linear.x;
-    double npc_twist = api_.getEntityStatus("npc").action_status.twist.linear.x;
+    double ego_accel = api_.getEntityStatus("ego")->action_status.accel.linear.x;
+    double ego_twist = api_.getEntityStatus("ego")->action_status.twist.linear.x;
+    // double npc_accel = api_.getEntityStatus("npc")->action_status.accel.linear.x;
+    double npc_twist = api_.getEntityStatus("npc")->action_status.twist.linear.x;
     // LCOV_EXCL_START
     if (ego_twist > (npc_twist + 1) && ego_accel > 0) {
       stop(cpp_mock_scenarios::Result::FAILURE);
@@ -46,13 +46,13 @@ private:
       stop(cpp_mock_scenarios::Result::FAILURE);
     }
     if (t <= 1.0) {
-      const auto vel = api_.getEntityStatus("bob").action_status.twist.linear.x;
+      const auto vel = api_.getEntityStatus("bob")->action_status.twist.linear.x;
       if (t != vel) {
         stop(cpp_mock_scenarios::Result::FAILURE);
       }
     }
     if (t >= 6.15 && 7.25 >= t) {
-      const auto vel = api_.getEntityStatus("ego").action_status.twist.linear.x;
+      const auto vel = api_.getEntityStatus("ego")->action_status.twist.linear.x;
       if (std::fabs(0.01) <= vel) {
         stop(cpp_mock_scenarios::Result::FAILURE);
       }
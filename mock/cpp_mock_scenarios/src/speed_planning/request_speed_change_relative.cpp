@@ -43,12 +43,12 @@ private:
   {
     if (
       api_.getCurrentTime() <= 2.9 &&
-      api_.getEntityStatus("front").action_status.twist.linear.x > 6.0) {
+      api_.getEntityStatus("front")->action_status.twist.linear.x > 6.0) {
       stop(cpp_mock_scenarios::Result::FAILURE);
     }
     if (
       api_.getCurrentTime() >= 3.0 &&
-      api_.getEntityStatus("front").action_status.twist.linear.x <= 6.0) {
+      api_.getEntityStatus("front")->action_status.twist.linear.x <= 6.0) {
       stop(cpp_mock_scenarios::Result::SUCCESS);
     }
   }
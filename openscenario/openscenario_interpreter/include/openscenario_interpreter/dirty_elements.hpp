@@ -0,0 +1,46 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__DIRTY_ELEMENTS_HPP_
+#define OPENSCENARIO_INTERPRETER__DIRTY_ELEMENTS_HPP_
+
+#include <unordered_set>
+#include <utility>
+
+namespace openscenario_interpreter
+{
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Elements of the scenario whose part of the published context may have
+ *  changed. StoryboardElements mark themselves on their transitions,
+ *  Conditions when they are reevaluated, and ConditionGroups and Triggers when
+ *  their results change. The interpreter takes them to publish the context as
+ *  a patch of only their parts.
+ *
+ * -------------------------------------------------------------------------- */
+class DirtyElements
+{
+  std::unordered_set<const void *> elements;
+
+public:
+  auto mark(const void * element) -> void { elements.insert(element); }
+
+  // NOTE: Returns the elements marked since the last take, and forgets them.
+  auto take() -> std::unordered_set<const void *> { return std::exchange(elements, {}); }
+};
+
+extern DirtyElements dirty_elements;
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__DIRTY_ELEMENTS_HPP_
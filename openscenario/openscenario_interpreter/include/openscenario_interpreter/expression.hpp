@@ -15,12 +15,16 @@
 #ifndef OPENSCENARIO_INTERPRETER__EXPRESSION_HPP_
 #define OPENSCENARIO_INTERPRETER__EXPRESSION_HPP_
 
+#include <cstddef>
 #include <openscenario_interpreter/pointer.hpp>
 
 namespace openscenario_interpreter
 {
 struct Expression  // NOTE: Member functions are lexicographically sorted.
 {
+  template <typename>
+  friend class Pointer;
+
   virtual bool accomplished() { return false; }
 
   virtual auto description() const -> std::string { return ""; }
@@ -36,6 +40,11 @@ struct Expression  // NOTE: Member functions are lexicographically sorted.
   {
     return IfHasStreamOutputOperator<Expression>::invoke(os, *this);
   }
+
+protected:
+  std::size_t type_id = 0;  // NOTE: Set by Pointer<Expression>::Binder.
+
+  void * bound = nullptr;  // NOTE: Set by Pointer<Expression>::Binder.
 };
 }  // namespace openscenario_interpreter
 
@@ -18,6 +18,7 @@
 #include <boost/mpl/and.hpp>
 #include <list>
 #include <openscenario_interpreter/expression.hpp>
+#include <tuple>
 #include <type_traits>
 #include <typeindex>
 #include <utility>
@@ -83,27 +84,67 @@ struct Unspecified
 auto operator<<(std::ostream &, const Unspecified &) -> std::ostream &;
 }  // namespace openscenario_interpreter
 
-#define CASE(TYPE)                                                               \
-  {                                                                              \
-    [](auto & datum) { return datum.template is_also<TYPE>(); },                 \
-      [&](auto & datum, auto &&... args) {                                       \
-        return function(datum.template as<TYPE>(), std::forward<Args>(args)...); \
-      }                                                                          \
+namespace openscenario_interpreter
+{
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Tries each case of DEFINE_LAZY_VISITOR in order. Unlike a table of
+ *  std::function built on every call, this does not allocate, and each type
+ *  test is an integer comparison when the datum is bound to exactly the type
+ *  of the case (see Pointer::is).
+ *
+ * -------------------------------------------------------------------------- */
+template <typename Test, typename Call>
+struct LazyCase
+{
+  Test test;
+
+  Call call;
+
+  explicit LazyCase(Test test, Call call) : test(test), call(call) {}
+};
+
+template <
+  typename Result, std::size_t I = 0, typename Otherwise, typename Datum, typename Arguments,
+  typename Cases>
+auto visitLazily(Otherwise && otherwise, Datum & datum, Arguments && arguments, Cases && cases)
+  -> Result
+{
+  if constexpr (I < std::tuple_size<std::decay_t<Cases>>::value) {
+    if (std::get<I>(cases).test(datum)) {
+      return std::apply(
+        [&](auto &&... xs) -> Result {
+          return std::get<I>(cases).call(datum, std::forward<decltype(xs)>(xs)...);
+        },
+        std::forward<Arguments>(arguments));
+    } else {
+      return visitLazily<Result, I + 1>(
+        std::forward<Otherwise>(otherwise), datum, std::forward<Arguments>(arguments),
+        std::forward<Cases>(cases));
+    }
+  } else {
+    return otherwise();
   }
+}
+}  // namespace openscenario_interpreter
 
-#define DEFINE_LAZY_VISITOR(TYPE, ...)                                                             \
-  template <typename Result, typename Function, typename... Args>                                  \
-  Result apply(Function && function, TYPE & datum, Args &&... args)                                \
-  {                                                                                                \
-    std::vector<std::pair<std::function<bool(TYPE &)>, std::function<Result(TYPE &, Args &&...)>>> \
-      dispatcher{{__VA_ARGS__}};                                                                   \
-    for (auto & p : dispatcher) {                                                                  \
-      if (p.first(datum)) {                                                                        \
-        return p.second(datum, std::forward<Args>(args)...);                                       \
-      }                                                                                            \
-    }                                                                                              \
-    throw UNSUPPORTED_SETTING_DETECTED(TYPE, makeTypename(datum.type().name()));                   \
-  }                                                                                                \
+#define CASE(TYPE)                                                             \
+  LazyCase(                                                                    \
+    [](auto & datum) { return datum.template is_also<TYPE>(); },               \
+    [&](auto & datum, auto &&... args) {                                       \
+      return function(datum.template as<TYPE>(), std::forward<Args>(args)...); \
+    })
+
+#define DEFINE_LAZY_VISITOR(TYPE, ...)                                                     \
+  template <typename Result, typename Function, typename... Args>                          \
+  Result apply(Function && function, TYPE & datum, Args &&... args)                        \
+  {                                                                                        \
+    return visitLazily<Result>(                                                            \
+      [&]() -> Result {                                                                    \
+        throw UNSUPPORTED_SETTING_DETECTED(TYPE, makeTypename(datum.type().name()));       \
+      },                                                                                   \
+      datum, std::forward_as_tuple(std::forward<Args>(args)...), std::tuple{__VA_ARGS__}); \
+  }                                                                                        \
   static_assert(true, "")
 
 #endif  // OPENSCENARIO_INTERPRETER__OBJECT_HPP_
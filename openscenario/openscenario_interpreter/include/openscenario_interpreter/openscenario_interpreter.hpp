@@ -17,13 +17,16 @@
 
 #include <boost/variant.hpp>
 #include <chrono>
+#include <functional>
 #include <lifecycle_msgs/msg/state.hpp>
 #include <lifecycle_msgs/msg/transition.hpp>
 #include <memory>
+#include <nlohmann/json.hpp>
 #include <openscenario_interpreter/console/escape_sequence.hpp>
 #include <openscenario_interpreter/procedure.hpp>
 #include <openscenario_interpreter/syntax/custom_command_action.hpp>
 #include <openscenario_interpreter/syntax/openscenario.hpp>
+#include <openscenario_interpreter/syntax/parameter_value_distribution_definition.hpp>
 #include <openscenario_interpreter/syntax/scenario_definition.hpp>
 #include <openscenario_interpreter/utility/execution_timer.hpp>
 #include <openscenario_interpreter/utility/visibility.hpp>
@@ -32,6 +35,8 @@
 #include <rclcpp_lifecycle/lifecycle_node.hpp>
 #include <scenario_simulator_exception/exception.hpp>
 #include <simple_junit/junit5.hpp>
+#include <std_srvs/srv/trigger.hpp>
+#include <unordered_map>
 #include <utility>
 
 #define INTERPRETER_INFO_STREAM(...) \
@@ -49,20 +54,63 @@ class Interpreter : public rclcpp_lifecycle::LifecycleNode
 
   const rclcpp_lifecycle::LifecyclePublisher<Context>::SharedPtr publisher_of_context;
 
+  const rclcpp::Service<std_srvs::srv::Trigger>::SharedPtr context_snapshot_service;
+
+  nlohmann::json published_context;
+
+  // NOTE: Where the part of each element is in the published context, and how to serialize it.
+  std::unordered_map<
+    const void *, std::pair<nlohmann::json::json_pointer, std::function<nlohmann::json()>>>
+    published_context_index;
+
+  std::size_t context_subscription_count;
+
+  std::chrono::steady_clock::time_point time_of_last_context;
+
+  bool context_snapshot_requested;
+
   String intended_result;
 
   double local_frame_rate;
 
   double local_real_time_factor;
 
+  bool as_fast_as_possible;
+
+  double maximum_real_time_factor;
+
+  double context_publish_rate;
+
+  int debug_marker_publish_decimation;
+
+  int entity_status_publish_decimation;
+
+  bool in_process_simulator;
+
+  bool track_condition_dependencies;
+
   String osc_path;
 
   String output_directory;
 
+  bool profile;
+
   std::shared_ptr<OpenScenario> script;
 
   std::list<std::shared_ptr<ScenarioDefinition>> scenarios;
 
+  std::shared_ptr<OpenScenario> distribution;
+
+  std::list<ParameterValueSet> variants;
+
+  std::size_t variant_count;
+
+  boost::filesystem::path shared_map_path;
+
+  std::shared_ptr<hdmap_utils::HdMapUtils> shared_map;
+
+  String case_name;
+
   std::shared_ptr<rclcpp::TimerBase> timer;
 
   common::JUnit5 results;
@@ -71,6 +119,10 @@ class Interpreter : public rclcpp_lifecycle::LifecycleNode
 
   ExecutionTimer<> execution_timer;
 
+  std::chrono::steady_clock::time_point time_on_activate;
+
+  double simulation_time_on_activate;
+
   using Result = rclcpp_lifecycle::node_interfaces::LifecycleNodeInterface::CallbackReturn;
 
 public:
@@ -79,10 +131,14 @@ public:
 
   ~Interpreter() override;
 
+  auto currentLocalFramePeriod() const -> std::chrono::nanoseconds;
+
   auto currentLocalFrameRate() const -> std::chrono::milliseconds;
 
   auto currentScenarioDefinition() const -> const std::shared_ptr<ScenarioDefinition> &;
 
+  auto indexPublishedContext() -> void;
+
   auto isAnErrorIntended() const -> bool;
 
   auto isFailureIntended() const -> bool;
@@ -91,6 +147,8 @@ public:
 
   auto makeCurrentConfiguration() const -> traffic_simulator::Configuration;
 
+  auto nextVariant() -> void;
+
   auto on_activate(const rclcpp_lifecycle::State &) -> Result override;
 
   auto on_cleanup(const rclcpp_lifecycle::State &) -> Result override;
@@ -103,7 +161,9 @@ public:
 
   auto on_shutdown(const rclcpp_lifecycle::State &) -> Result override;
 
-  auto publishCurrentContext() const -> void;
+  auto publishCurrentContext() -> void;
+
+  auto reportThroughput() const -> void;
 
   template <typename T, typename... Ts>
   auto set(Ts &&... xs) -> void
@@ -114,8 +174,6 @@ public:
 
     const auto suite_name = boost::filesystem::path(osc_path).parent_path().filename().string();
 
-    const auto case_name = boost::filesystem::path(osc_path).stem().string();
-
     boost::apply_visitor(
       overload(
         [&](const common::junit::Pass &) { results.testsuite(suite_name).testcase(case_name); },
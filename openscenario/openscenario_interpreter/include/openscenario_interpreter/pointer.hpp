@@ -15,6 +15,7 @@
 #ifndef OPENSCENARIO_INTERPRETER__POINTER_HPP_
 #define OPENSCENARIO_INTERPRETER__POINTER_HPP_
 
+#include <atomic>
 #include <cstddef>
 #include <memory>
 #include <openscenario_interpreter/error.hpp>
@@ -29,6 +30,27 @@
 
 namespace openscenario_interpreter
 {
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Compact identifier of each type bound to Pointer, assigned when the type is
+ *  first used. Pointer::is and the fast path of Pointer::as compare these
+ *  integers instead of std::type_info, and Pointer::as casts statically
+ *  instead of dynamically when the bound type is exactly the requested one.
+ *
+ * -------------------------------------------------------------------------- */
+inline auto nextTypeId() noexcept -> std::size_t
+{
+  static std::atomic<std::size_t> count{0};
+  return ++count;
+}
+
+template <typename T>
+auto typeId() noexcept -> std::size_t
+{
+  static const auto id = nextTypeId();
+  return id;
+}
+
 template <typename T>
 class Pointer : public std::shared_ptr<T>
 {
@@ -38,6 +60,8 @@ class Pointer : public std::shared_ptr<T>
     template <typename... Ts>
     explicit constexpr Binder(Ts &&... xs) : Bound(std::forward<decltype(xs)>(xs)...)
     {
+      T::type_id = typeId<Bound>();
+      T::bound = static_cast<Bound *>(this);
     }
 
     virtual ~Binder() = default;
@@ -97,19 +121,21 @@ public:
   template <typename U>
   auto is() const -> bool
   {
-    return type() == typeid(U);
+    return *this and std::shared_ptr<T>::get()->type_id == typeId<std::remove_cv_t<U>>();
   }
 
   template <typename U>
-  auto is_also() const
+  auto is_also() const -> bool
   {
-    return static_cast<bool>(std::dynamic_pointer_cast<U>(*this));
+    return is<U>() or dynamic_cast<U *>(std::shared_ptr<T>::get());
   }
 
   template <typename U>
   auto as() const -> U &
   {
-    if (const auto bound = std::dynamic_pointer_cast<U>(*this)) {
+    if (is<U>()) {
+      return *static_cast<U *>(std::shared_ptr<T>::get()->bound);
+    } else if (const auto bound = dynamic_cast<U *>(std::shared_ptr<T>::get())) {
       return *bound;
     } else {
       throw SemanticError("Can't treat ", binding().type().name(), " as ", typeid(U).name());
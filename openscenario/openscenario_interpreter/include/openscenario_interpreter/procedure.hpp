@@ -15,10 +15,14 @@
 #ifndef OPENSCENARIO_INTERPRETER__PROCEDURE_HPP_
 #define OPENSCENARIO_INTERPRETER__PROCEDURE_HPP_
 
+#include <initializer_list>
 #include <limits>
 #include <memory>
 #include <openscenario_interpreter/error.hpp>
+#include <openscenario_interpreter/revisions.hpp>
+#include <openscenario_interpreter/syntax/entity_ref.hpp>
 #include <traffic_simulator/api/api.hpp>
+#include <type_traits>
 #include <utility>
 
 namespace openscenario_interpreter
@@ -34,10 +38,26 @@ decltype(auto) connect(Ts &&... xs)
 
 inline void disconnect() { connection.reset(); }
 
+inline auto resolve(const EntityRef & entity_ref) -> const traffic_simulator::entity::EntityHandle &
+{
+  if (not connection->entityExists(entity_ref.handle)) {
+    entity_ref.handle = connection->getEntityHandle(entity_ref);
+  }
+  return entity_ref.handle;
+}
+
+template <
+  typename T, typename = typename std::enable_if<
+                not std::is_same<typename std::decay<T>::type, EntityRef>::value>::type>
+constexpr auto resolve(T && x) -> T &&
+{
+  return std::forward<decltype(x)>(x);
+}
+
 template <typename... Ts>
 decltype(auto) getEntityStatus(Ts &&... xs)
 try {
-  return connection->getEntityStatus(std::forward<decltype(xs)>(xs)...);
+  return connection->getEntityStatus(resolve(std::forward<decltype(xs)>(xs))...);
 } catch (const common::scenario_simulator_exception::SimulationError & error) {
   throw SemanticError(
     error.what(), ".\n", "Possible causes:\n",
@@ -47,7 +67,7 @@ try {
 template <typename... Ts>
 auto getRelativePose(Ts &&... xs)
 try {
-  return connection->getRelativePose(std::forward<decltype(xs)>(xs)...);
+  return connection->getRelativePose(resolve(std::forward<decltype(xs)>(xs))...);
 } catch (...) {
   geometry_msgs::msg::Pose result{};
   result.position.x = std::numeric_limits<double>::quiet_NaN();
@@ -69,18 +89,18 @@ void addMetric(Ts &&... xs)
 auto toLanePosition(const geometry_msgs::msg::Pose & pose) -> typename std::decay<
   decltype(connection->toLaneletPose(std::declval<decltype(pose)>(), false).get())>::type;
 
-#define STRIP_OPTIONAL(IDENTIFIER, ALTERNATE)                                      \
-  template <typename... Ts>                                                        \
-  auto IDENTIFIER(Ts &&... xs)                                                     \
-  {                                                                                \
-    const auto result = connection->IDENTIFIER(std::forward<decltype(xs)>(xs)...); \
-    if (result) {                                                                  \
-      return result.get();                                                         \
-    } else {                                                                       \
-      using value_type = typename std::decay<decltype(result)>::type::value_type;  \
-      return ALTERNATE;                                                            \
-    }                                                                              \
-  }                                                                                \
+#define STRIP_OPTIONAL(IDENTIFIER, ALTERNATE)                                               \
+  template <typename... Ts>                                                                 \
+  auto IDENTIFIER(Ts &&... xs)                                                              \
+  {                                                                                         \
+    const auto result = connection->IDENTIFIER(resolve(std::forward<decltype(xs)>(xs))...); \
+    if (result) {                                                                           \
+      return result.get();                                                                  \
+    } else {                                                                                \
+      using value_type = typename std::decay<decltype(result)>::type::value_type;           \
+      return ALTERNATE;                                                                     \
+    }                                                                                       \
+  }                                                                                         \
   static_assert(true, "")
 
 STRIP_OPTIONAL(getBoundingBoxDistance, static_cast<value_type>(0));
@@ -105,14 +125,10 @@ FORWARD_TO_SIMULATION_API(getCurrentAction);
 FORWARD_TO_SIMULATION_API(getCurrentTime);
 FORWARD_TO_SIMULATION_API(getDriverModel);
 FORWARD_TO_SIMULATION_API(getTrafficRelationReferees);
-FORWARD_TO_SIMULATION_API(initialize);
 FORWARD_TO_SIMULATION_API(isInLanelet);
 FORWARD_TO_SIMULATION_API(ready);
 FORWARD_TO_SIMULATION_API(requestLaneChange);
-FORWARD_TO_SIMULATION_API(requestSpeedChange);
-FORWARD_TO_SIMULATION_API(setEntityStatus);
 FORWARD_TO_SIMULATION_API(setVelocityLimit);
-FORWARD_TO_SIMULATION_API(updateFrame);
 
 #undef FORWARD_TO_SIMULATION_API
 
@@ -127,12 +143,9 @@ FORWARD_TO_SIMULATION_API(updateFrame);
 // NOTE: See OpenSCENARIO 1.1 Figure 2. Actions and conditions
 
 RENAME(applyAcquirePositionAction, requestAcquirePosition);
-RENAME(applyAddEntityAction, spawn);
 RENAME(applyAssignControllerAction, setDriverModel);
 RENAME(applyAssignRouteAction, requestAssignRoute);
-RENAME(applyDeleteEntityAction, despawn);
 RENAME(applyLaneChangeAction, requestLaneChange);
-RENAME(applyTeleportAction, setEntityStatus);
 RENAME(applyWalkStraightAction, requestWalkStraight);
 RENAME(evaluateCollisionCondition, checkCollision);
 RENAME(evaluateCurrentEmergencyState, getEmergencyStateString);
@@ -141,6 +154,44 @@ RENAME(evaluateReachPositionCondition, reachPosition);
 RENAME(toWorldPosition, toMapPose);
 
 #undef RENAME
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Requests that change the kinematics of entities at once (not on the next
+ *  updateFrame) bump the revision of them, so that a Condition evaluated after
+ *  such a request in the same frame does not return its result cached before
+ *  the request.
+ *
+ * -------------------------------------------------------------------------- */
+#define RENAME_TOUCHING(TO, FROM, ...)                          \
+  template <typename... Ts>                                     \
+  decltype(auto) TO(Ts &&... xs)                                \
+  {                                                             \
+    for (const auto dependency : {__VA_ARGS__}) {               \
+      revisions.touch(dependency);                              \
+    }                                                           \
+    return connection->FROM(std::forward<decltype(xs)>(xs)...); \
+  }                                                             \
+  static_assert(true, "")
+
+RENAME_TOUCHING(applyAddEntityAction, spawn, Dependency::entity_kinematics);
+RENAME_TOUCHING(applyDeleteEntityAction, despawn, Dependency::entity_kinematics);
+RENAME_TOUCHING(applyTeleportAction, setEntityStatus, Dependency::entity_kinematics);
+RENAME_TOUCHING(requestSpeedChange, requestSpeedChange, Dependency::entity_kinematics);
+RENAME_TOUCHING(setEntityStatus, setEntityStatus, Dependency::entity_kinematics);
+
+#undef RENAME_TOUCHING
+
+auto initialize(const double realtime_factor, const double step_time) -> bool;
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Advances the simulation time over the thresholds of SimulationTimeConditions
+ *  between the previous and the current time, and touches the kinematics of
+ *  entities only if the status of any entity has changed by the update.
+ *
+ * -------------------------------------------------------------------------- */
+auto updateFrame() -> bool;
 }  // namespace openscenario_interpreter
 
 #endif  // OPENSCENARIO_INTERPRETER__PROCEDURE_HPP_
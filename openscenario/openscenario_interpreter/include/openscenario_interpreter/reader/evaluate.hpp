@@ -16,8 +16,10 @@
 #define OPENSCENARIO_INTERPRETER__EXPRESSION__ATTRIBUTE_HPP_
 
 #include <iomanip>
+#include <memory>
 #include <openscenario_interpreter/object.hpp>
 #include <openscenario_interpreter/utility/variant.hpp>
+#include <string>
 #include <type_traits>
 
 #include "openscenario_interpreter/utility/demangle.hpp"
@@ -29,6 +31,30 @@ struct Scope;
 
 inline namespace reader
 {
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  An expression compiled once and bound to the parameters it refers to. The
+ *  parameters are looked up by name only on construction. The expression is
+ *  evaluated again only if the value of any of them has changed since the
+ *  previous evaluation; otherwise the previous result is returned.
+ *
+ * -------------------------------------------------------------------------- */
+class CompiledExpression
+{
+  struct Binding;
+
+  std::unique_ptr<Binding> binding;
+
+public:
+  explicit CompiledExpression(const std::string &, const Scope &);
+
+  CompiledExpression(CompiledExpression &&) noexcept;
+
+  ~CompiledExpression();
+
+  auto evaluate() -> const std::string &;
+};
+
 std::string evaluate(const std::string &, const Scope &);
 }  // namespace reader
 }  // namespace openscenario_interpreter
@@ -0,0 +1,82 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__REVISIONS_HPP_
+#define OPENSCENARIO_INTERPRETER__REVISIONS_HPP_
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <optional>
+
+namespace openscenario_interpreter
+{
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  What the result of a Condition depends on. Parameters change only by
+ *  ParameterSetAction and ParameterModifyAction, and the states of
+ *  StoryboardElements only by their own transitions. The simulation time
+ *  advances on every updateFrame, but the result of a SimulationTimeCondition
+ *  changes only when the time crosses its value, so the simulation time is
+ *  tracked for each threshold declared by SimulationTimeConditions. The
+ *  kinematics of entities change by the requests to the simulator that write
+ *  them at once (e.g. TeleportAction, or SpeedAction with the step dynamics
+ *  shape) and by the updateFrames in which the status of any entity changes.
+ *  These four are tracked. Traffic signals, values from other nodes and
+ *  durations of entity states (e.g. StandStillCondition) may change at any
+ *  time and are untracked.
+ *
+ * -------------------------------------------------------------------------- */
+enum class Dependency {
+  parameter,
+  storyboard_element_state,
+  simulation_time,
+  entity_kinematics,
+  untracked,
+};
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Counters of writes to each tracked dependency. A Condition remembers the
+ *  revision of its dependency when it was evaluated last, and returns its
+ *  previous result while the revision stays the same.
+ *
+ * -------------------------------------------------------------------------- */
+class Revisions
+{
+  std::array<std::size_t, 4> counts = {};
+
+  std::map<double, std::size_t> thresholds;  // NOTE: Number of times the time crossed each
+
+public:
+  // NOTE: If false, every Condition is evaluated on every frame.
+  bool tracking = true;
+
+  auto of(const Dependency) const noexcept -> std::optional<std::size_t>;
+
+  // NOTE: The revision of the simulation time seen from the given threshold.
+  auto of(const double threshold) const -> std::optional<std::size_t>;
+
+  auto declare(const double threshold) -> void;
+
+  // NOTE: Touches the thresholds between the times. Called when the time advances.
+  auto advance(const double from, const double to) -> void;
+
+  auto touch(const Dependency) noexcept -> void;
+};
+
+extern Revisions revisions;
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__REVISIONS_HPP_
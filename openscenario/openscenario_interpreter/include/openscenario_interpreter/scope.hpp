@@ -142,8 +142,14 @@ private:
   auto outermostFrame() const noexcept -> const EnvironmentFrame &;
 };
 
+template <typename>
+class Reference;
+
 class Scope
 {
+  template <typename>
+  friend class Reference;
+
   struct GlobalEnvironment
   {
     const boost::filesystem::path pathname;  // for substitution syntax '$(dirname)'
@@ -200,6 +206,43 @@ public:
 
   auto insert(const Name &, const Object &) -> void;
 };
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Reference to a variable (parameter, storyboard element, etc.) by name that
+ *  is resolved by searching the environment frames only once. Resolution is
+ *  deferred until the first access because a StoryboardElement may refer to
+ *  another element that is declared after it. After that, the reference is
+ *  just a pointer to the bound object, so evaluating it every frame costs no
+ *  string parsing, hashing or frame search.
+ *
+ * -------------------------------------------------------------------------- */
+template <typename T = Object>
+class Reference
+{
+  const Scope scope;
+
+  const std::string name;
+
+  mutable Object object;
+
+public:
+  explicit Reference(const Scope & scope, const std::string & name) : scope(scope), name(name) {}
+
+  auto bind() const -> const Object &
+  {
+    if (not object) {
+      object = scope.frame->template ref<T>(name);
+    }
+    return object;
+  }
+
+  template <typename U = T>
+  auto as() const -> decltype(auto)
+  {
+    return bind().template as<U>();
+  }
+};
 }  // namespace openscenario_interpreter
 
 #endif  // OPENSCENARIO_INTERPRETER__SCOPE_HPP_
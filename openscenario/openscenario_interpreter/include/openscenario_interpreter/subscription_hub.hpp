@@ -0,0 +1,83 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__SUBSCRIPTION_HUB_HPP_
+#define OPENSCENARIO_INTERPRETER__SUBSCRIPTION_HUB_HPP_
+
+#include <exception>
+#include <memory>
+#include <openscenario_interpreter/object.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace openscenario_interpreter
+{
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Process-wide set of subscriptions to topics of type
+ *  openscenario_msgs::msg::ParameterDeclaration, used by
+ *  UserDefinedValueCondition. Each topic is subscribed to only once, no matter
+ *  how many conditions refer to it. All subscriptions belong to one callback
+ *  group of the interpreter's node, so they are serviced by the interpreter's
+ *  executor between frames rather than by threads of their own. The value of
+ *  each message is parsed once when it arrives.
+ *
+ * -------------------------------------------------------------------------- */
+class SubscriptionHub
+{
+public:
+  class Value
+  {
+    friend class SubscriptionHub;
+
+    Object value = unspecified;
+
+    std::exception_ptr thrown;
+
+  public:
+    auto get() const -> const Object &;
+  };
+
+private:
+  rclcpp::node_interfaces::NodeBaseInterface::SharedPtr node_base;
+
+  rclcpp::node_interfaces::NodeTopicsInterface::SharedPtr node_topics;
+
+  rclcpp::CallbackGroup::SharedPtr callback_group;
+
+  std::unordered_map<
+    std::string, std::pair<rclcpp::SubscriptionBase::SharedPtr, std::shared_ptr<Value>>>
+    topics;
+
+public:
+  template <typename Node>
+  auto attach(Node & node) -> void
+  {
+    detach();
+    node_base = node.get_node_base_interface();
+    node_topics = node.get_node_topics_interface();
+    callback_group = node_base->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  }
+
+  auto detach() -> void;
+
+  auto subscribe(const std::string &) -> std::shared_ptr<const Value>;
+};
+
+extern SubscriptionHub subscription_hub;
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__SUBSCRIPTION_HUB_HPP_
@@ -15,11 +15,11 @@
 #ifndef OPENSCENARIO_INTERPRETER__SYNTAX__CATALOG_LOCATION_HPP_
 #define OPENSCENARIO_INTERPRETER__SYNTAX__CATALOG_LOCATION_HPP_
 
-#include <memory>
+#include <boost/filesystem.hpp>
 #include <openscenario_interpreter/syntax/directory.hpp>
 #include <pugixml.hpp>
+#include <string>
 #include <unordered_map>
-#include <vector>
 
 namespace openscenario_interpreter
 {
@@ -27,16 +27,21 @@ inline namespace syntax
 {
 /* ---- CatalogLocation --------------------------------------------------------
  *
+ *  Index from the name of each Catalog in the directory to the file that
+ *  contains it. Building the index parses only the elements of each file,
+ *  without their text. A catalog file is parsed when a CatalogReference first
+ *  refers to it, and the parsed document is kept for later scenarios run in
+ *  the same process for as long as the file is not modified.
  *
  * -------------------------------------------------------------------------- */
-class CatalogLocation : public std::unordered_map<std::string, pugi::xml_node>
+class CatalogLocation : public std::unordered_map<std::string, boost::filesystem::path>
 {
-  std::vector<std::shared_ptr<pugi::xml_document>> catalog_files;
-
 public:
   const Directory directory;
 
   explicit CatalogLocation(const pugi::xml_node &, Scope &);
+
+  static auto load(const boost::filesystem::path &) -> pugi::xml_node;
 };
 }  // namespace syntax
 }  // namespace openscenario_interpreter
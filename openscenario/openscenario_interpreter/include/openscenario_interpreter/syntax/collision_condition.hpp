@@ -42,6 +42,8 @@ struct CollisionCondition : private Scope
 
   const TriggeringEntities triggering_entities;
 
+  const Object another_given_scenario_object;  // NOTE: Bound if another_given_entity is EntityRef.
+
   explicit CollisionCondition(const pugi::xml_node &, Scope &, const TriggeringEntities &);
 
   auto description() const -> std::string;
@@ -16,6 +16,8 @@
 #define OPENSCENARIO_INTERPRETER__SYNTAX__CONDITION_HPP_
 
 #include <nlohmann/json.hpp>
+#include <optional>
+#include <openscenario_interpreter/revisions.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/condition_edge.hpp>
 #include <openscenario_interpreter/syntax/double.hpp>
@@ -49,6 +51,12 @@ struct Condition : public ComplexType
 
   bool current_value;
 
+  const Dependency dependency;
+
+  const Double threshold;  // of the simulation time if the dependency is simulation_time
+
+  std::optional<std::size_t> revision;  // of the dependency when evaluated last
+
   explicit Condition(const pugi::xml_node & node, Scope & scope);
 
   auto evaluate() -> Object;
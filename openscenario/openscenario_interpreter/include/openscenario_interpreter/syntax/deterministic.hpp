@@ -0,0 +1,53 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__SYNTAX__DETERMINISTIC_HPP_
+#define OPENSCENARIO_INTERPRETER__SYNTAX__DETERMINISTIC_HPP_
+
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/parameter_value_set.hpp>
+#include <pugixml.hpp>
+#include <vector>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+/* ---- Deterministic ----------------------------------------------------------
+ *
+ *  <xsd:complexType name="Deterministic">
+ *    <xsd:sequence>
+ *      <xsd:group ref="DeterministicParameterDistribution" minOccurs="0" maxOccurs="unbounded"/>
+ *    </xsd:sequence>
+ *  </xsd:complexType>
+ *
+ *  <xsd:group name="DeterministicParameterDistribution">
+ *    <xsd:choice>
+ *      <xsd:element name="DeterministicMultiParameterDistribution" type="DeterministicMultiParameterDistribution"/>
+ *      <xsd:element name="DeterministicSingleParameterDistribution" type="DeterministicSingleParameterDistribution"/>
+ *    </xsd:choice>
+ *  </xsd:group>
+ *
+ *  Every combination of the values of the distributions, in the order of
+ *  appearance with the last distribution varying fastest.
+ *
+ * -------------------------------------------------------------------------- */
+struct Deterministic : public std::vector<ParameterValueSet>
+{
+  explicit Deterministic(const pugi::xml_node &, Scope &);
+};
+}  // namespace syntax
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__SYNTAX__DETERMINISTIC_HPP_
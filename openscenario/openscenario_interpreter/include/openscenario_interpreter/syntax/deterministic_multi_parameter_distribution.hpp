@@ -0,0 +1,53 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__SYNTAX__DETERMINISTIC_MULTI_PARAMETER_DISTRIBUTION_HPP_
+#define OPENSCENARIO_INTERPRETER__SYNTAX__DETERMINISTIC_MULTI_PARAMETER_DISTRIBUTION_HPP_
+
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/parameter_value_set.hpp>
+#include <pugixml.hpp>
+#include <vector>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+/* ---- DeterministicMultiParameterDistribution --------------------------------
+ *
+ *  <xsd:complexType name="DeterministicMultiParameterDistribution">
+ *    <xsd:group ref="DeterministicMultiParameterDistributionType"/>
+ *  </xsd:complexType>
+ *
+ *  <xsd:group name="DeterministicMultiParameterDistributionType">
+ *    <xsd:sequence>
+ *      <xsd:element name="ValueSetDistribution" type="ValueSetDistribution"/>
+ *    </xsd:sequence>
+ *  </xsd:group>
+ *
+ *  <xsd:complexType name="ValueSetDistribution">
+ *    <xsd:sequence>
+ *      <xsd:element name="ParameterValueSet" type="ParameterValueSet" maxOccurs="unbounded"/>
+ *    </xsd:sequence>
+ *  </xsd:complexType>
+ *
+ * -------------------------------------------------------------------------- */
+struct DeterministicMultiParameterDistribution : public std::vector<ParameterValueSet>
+{
+  explicit DeterministicMultiParameterDistribution(const pugi::xml_node &, Scope &);
+};
+}  // namespace syntax
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__SYNTAX__DETERMINISTIC_MULTI_PARAMETER_DISTRIBUTION_HPP_
@@ -0,0 +1,55 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__SYNTAX__DETERMINISTIC_SINGLE_PARAMETER_DISTRIBUTION_HPP_
+#define OPENSCENARIO_INTERPRETER__SYNTAX__DETERMINISTIC_SINGLE_PARAMETER_DISTRIBUTION_HPP_
+
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/parameter_value_set.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
+#include <pugixml.hpp>
+#include <vector>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+/* ---- DeterministicSingleParameterDistribution -------------------------------
+ *
+ *  <xsd:complexType name="DeterministicSingleParameterDistribution">
+ *    <xsd:group ref="DeterministicSingleParameterDistributionType"/>
+ *    <xsd:attribute name="parameterName" type="String" use="required"/>
+ *  </xsd:complexType>
+ *
+ *  <xsd:group name="DeterministicSingleParameterDistributionType">
+ *    <xsd:choice>
+ *      <xsd:element name="DistributionSet" type="DistributionSet"/>
+ *      <xsd:element name="DistributionRange" type="DistributionRange"/>
+ *      <xsd:element name="UserDefinedDistribution" type="UserDefinedDistribution"/>
+ *    </xsd:choice>
+ *  </xsd:group>
+ *
+ *  One ParameterValueSet for each value the parameter takes.
+ *
+ * -------------------------------------------------------------------------- */
+struct DeterministicSingleParameterDistribution : public std::vector<ParameterValueSet>
+{
+  const String parameter_name;
+
+  explicit DeterministicSingleParameterDistribution(const pugi::xml_node &, Scope &);
+};
+}  // namespace syntax
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__SYNTAX__DETERMINISTIC_SINGLE_PARAMETER_DISTRIBUTION_HPP_
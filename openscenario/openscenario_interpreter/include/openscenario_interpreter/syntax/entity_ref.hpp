@@ -16,6 +16,7 @@
 #define OPENSCENARIO_INTERPRETER__SYNTAX__ENTITY_REF_HPP_
 
 #include <openscenario_interpreter/reader/attribute.hpp>
+#include <traffic_simulator/entity/entity_handle.hpp>
 #include <utility>
 
 namespace openscenario_interpreter
@@ -31,6 +32,16 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct EntityRef : public String
 {
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  Handle of the entity this EntityRef names, cached by resolve (see
+   *  procedure.hpp) on first use and resolved again only after the entity is
+   *  despawned, so that conditions evaluated every frame do not look up the
+   *  entity by name.
+   *
+   * ------------------------------------------------------------------------ */
+  mutable traffic_simulator::entity::EntityHandle handle;
+
   template <typename... Ts>
   EntityRef(Ts &&... xs) : String(std::forward<decltype(xs)>(xs)...)
   {
@@ -48,11 +48,18 @@ struct OpenScenario : public Scope
 
   explicit OpenScenario(const boost::filesystem::path &);
 
+  explicit OpenScenario(const pugi::xml_document &, const boost::filesystem::path &);
+
   auto evaluate() -> Object;
 
   auto load(const boost::filesystem::path &) -> const pugi::xml_node &;
+
+  auto load(const pugi::xml_document &) -> const pugi::xml_node &;
 };
 
+// NOTE: The part of the context which is not of any element of the scenario.
+auto serializeFrame(nlohmann::json &, const OpenScenario &) -> nlohmann::json &;
+
 auto operator<<(nlohmann::json &, const OpenScenario &) -> nlohmann::json &;
 }  // namespace syntax
 }  // namespace openscenario_interpreter
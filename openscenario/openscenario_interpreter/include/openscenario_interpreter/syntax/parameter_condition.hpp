@@ -41,6 +41,8 @@ struct ParameterCondition : private Scope
 
   const Rule rule;
 
+  const Reference<> parameter;
+
   explicit ParameterCondition(Scope &);
 
   explicit ParameterCondition(const pugi::xml_node &, Scope &);
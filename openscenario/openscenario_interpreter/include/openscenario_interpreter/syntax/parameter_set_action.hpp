@@ -36,6 +36,8 @@ struct ParameterSetAction : private Scope
 
   const String value;
 
+  const Reference<> parameter;
+
   explicit ParameterSetAction(const pugi::xml_node &, Scope &, const String &);
 
   static auto accomplished() noexcept -> bool;
@@ -44,6 +46,8 @@ struct ParameterSetAction : private Scope
 
   static auto set(const Scope & scope, const String &, const String &) -> void;
 
+  static auto set(const Object &, const String &) -> void;
+
   /*  */ auto start() const -> void;
 };
 }  // namespace syntax
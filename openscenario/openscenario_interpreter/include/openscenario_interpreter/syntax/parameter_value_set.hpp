@@ -0,0 +1,49 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__SYNTAX__PARAMETER_VALUE_SET_HPP_
+#define OPENSCENARIO_INTERPRETER__SYNTAX__PARAMETER_VALUE_SET_HPP_
+
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
+#include <pugixml.hpp>
+#include <utility>
+#include <vector>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+/* ---- ParameterValueSet ------------------------------------------------------
+ *
+ *  <xsd:complexType name="ParameterValueSet">
+ *    <xsd:sequence>
+ *      <xsd:element name="ParameterAssignment" type="ParameterAssignment" maxOccurs="unbounded"/>
+ *    </xsd:sequence>
+ *  </xsd:complexType>
+ *
+ *  Unlike ParameterAssignments, the assignments are not applied to the scope
+ *  they are read in, but to the scenario of each variant.
+ *
+ * -------------------------------------------------------------------------- */
+struct ParameterValueSet : public std::vector<std::pair<String, String>>
+{
+  ParameterValueSet() = default;
+
+  explicit ParameterValueSet(const pugi::xml_node &, Scope &);
+};
+}  // namespace syntax
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__SYNTAX__PARAMETER_VALUE_SET_HPP_
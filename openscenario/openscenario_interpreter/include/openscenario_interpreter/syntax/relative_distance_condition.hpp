@@ -65,6 +65,8 @@ struct RelativeDistanceCondition : private Scope
 
   const TriggeringEntities triggering_entities;
 
+  const Object entity;  // NOTE: The entity named by entity_ref.
+
   std::vector<Double> results;  // for description
 
   explicit RelativeDistanceCondition(const pugi::xml_node &, Scope &, const TriggeringEntities &);
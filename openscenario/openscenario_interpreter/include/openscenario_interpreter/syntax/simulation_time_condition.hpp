@@ -31,6 +31,9 @@ inline namespace syntax
  *    <xsd:attribute name="rule" type="Rule" use="required"/>
  *  </xsd:complexType>
  *
+ *  The result changes only when the simulation time crosses the value, which
+ *  is declared as a threshold of the simulation time to the revisions.
+ *
  * -------------------------------------------------------------------------- */
 struct SimulationTimeCondition
 {
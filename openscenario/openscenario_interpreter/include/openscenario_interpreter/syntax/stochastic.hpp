@@ -0,0 +1,48 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__SYNTAX__STOCHASTIC_HPP_
+#define OPENSCENARIO_INTERPRETER__SYNTAX__STOCHASTIC_HPP_
+
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/parameter_value_set.hpp>
+#include <pugixml.hpp>
+#include <vector>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+/* ---- Stochastic -------------------------------------------------------------
+ *
+ *  <xsd:complexType name="Stochastic">
+ *    <xsd:sequence>
+ *      <xsd:element name="StochasticDistribution" type="StochasticDistribution" maxOccurs="unbounded"/>
+ *    </xsd:sequence>
+ *    <xsd:attribute name="numberOfTestRuns" type="UnsignedInt" use="required"/>
+ *    <xsd:attribute name="randomSeed" type="Double" use="optional"/>
+ *  </xsd:complexType>
+ *
+ *  numberOfTestRuns ParameterValueSets, each of which assigns a value drawn
+ *  from each distribution. The same randomSeed always gives the same sets.
+ *
+ * -------------------------------------------------------------------------- */
+struct Stochastic : public std::vector<ParameterValueSet>
+{
+  explicit Stochastic(const pugi::xml_node &, Scope &);
+};
+}  // namespace syntax
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__SYNTAX__STOCHASTIC_HPP_
@@ -0,0 +1,60 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__SYNTAX__STOCHASTIC_DISTRIBUTION_HPP_
+#define OPENSCENARIO_INTERPRETER__SYNTAX__STOCHASTIC_DISTRIBUTION_HPP_
+
+#include <functional>
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
+#include <pugixml.hpp>
+#include <random>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+/* ---- StochasticDistribution -------------------------------------------------
+ *
+ *  <xsd:complexType name="StochasticDistribution">
+ *    <xsd:group ref="StochasticDistributionType"/>
+ *    <xsd:attribute name="parameterName" type="String" use="required"/>
+ *  </xsd:complexType>
+ *
+ *  <xsd:group name="StochasticDistributionType">
+ *    <xsd:choice>
+ *      <xsd:element name="ProbabilityDistributionSet" type="ProbabilityDistributionSet"/>
+ *      <xsd:element name="NormalDistribution" type="NormalDistribution"/>
+ *      <xsd:element name="UniformDistribution" type="UniformDistribution"/>
+ *      <xsd:element name="PoissonDistribution" type="PoissonDistribution"/>
+ *      <xsd:element name="Histogram" type="Histogram"/>
+ *      <xsd:element name="UserDefinedDistribution" type="UserDefinedDistribution"/>
+ *    </xsd:choice>
+ *  </xsd:group>
+ *
+ * -------------------------------------------------------------------------- */
+struct StochasticDistribution
+{
+  using Engine = std::mt19937_64;
+
+  const String parameter_name;
+
+  const std::function<String(Engine &)> sample;
+
+  explicit StochasticDistribution(const pugi::xml_node &, Scope &);
+};
+}  // namespace syntax
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__SYNTAX__STOCHASTIC_DISTRIBUTION_HPP_
@@ -17,8 +17,10 @@
 
 #include <cstddef>
 #include <limits>
+#include <openscenario_interpreter/dirty_elements.hpp>
 #include <openscenario_interpreter/procedure.hpp>
 #include <openscenario_interpreter/reader/attribute.hpp>
+#include <openscenario_interpreter/revisions.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/catalog_reference.hpp>
 #include <openscenario_interpreter/syntax/storyboard_element_state.hpp>
@@ -73,6 +75,16 @@ public:
 
   auto state() const -> const auto & { return current_state; }
 
+  auto transitionTo(const Object & state) -> const Object &
+  {
+    if (current_state != state) {
+      revisions.touch(Dependency::storyboard_element_state);
+      dirty_elements.mark(this);
+      current_state = state;
+    }
+    return current_state;
+  }
+
   template <StoryboardElementState::value_type State>
   auto is() const
   {
@@ -84,7 +96,7 @@ public:
     if (
       not is<StoryboardElementState::standbyState>() and
       not is<StoryboardElementState::stopTransition>()) {
-      return current_state = stop_transition;
+      return transitionTo(stop_transition);
     } else {
       return current_state;
     }
@@ -182,8 +194,8 @@ public:
         *  Story element instantaneously transitions into the runningState.
         *
         * ------------------------------------------------------------------- */
-        return current_state =
-                 (start_trigger.evaluate().as<Boolean>() ? start_transition : current_state);
+        return transitionTo(
+          start_trigger.evaluate().as<Boolean>() ? start_transition : current_state);
 
       case StoryboardElementState::startTransition: /* -------------------------
         *
@@ -194,7 +206,7 @@ public:
         * ------------------------------------------------------------------- */
         start();
         ++current_execution_count;
-        return current_state = running_state;
+        return transitionTo(running_state);
 
       case StoryboardElementState::runningState: /* ----------------------------
         *
@@ -238,7 +250,7 @@ public:
         if (0 <= getCurrentTime()) {
           run();
         }
-        return current_state = (accomplished() ? end_transition : current_state);
+        return transitionTo(accomplished() ? end_transition : current_state);
 
       case StoryboardElementState::endTransition: /* ---------------------------
         *
@@ -250,9 +262,8 @@ public:
         *  be used in conditions to trigger based on this transition.
         *
         * -------------------------------------------------------------------- */
-        return current_state =
-                 (current_execution_count < maximum_execution_count ? standby_state
-                                                                    : complete_state);
+        return transitionTo(
+          current_execution_count < maximum_execution_count ? standby_state : complete_state);
 
       case StoryboardElementState::completeState: /* ---------------------------
         *
@@ -306,7 +317,7 @@ public:
           stop();
           return current_state;
         } else {
-          return current_state = complete_state;
+          return transitionTo(complete_state);
         }
     }
   }
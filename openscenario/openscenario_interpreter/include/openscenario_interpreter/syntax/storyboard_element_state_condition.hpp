@@ -24,6 +24,8 @@ namespace openscenario_interpreter
 {
 inline namespace syntax
 {
+class StoryboardElement;
+
 /* ---- StoryboardElementStateCondition ----------------------------------------
  *
  *  <xsd:complexType name="StoryboardElementStateCondition">
@@ -43,6 +45,8 @@ struct StoryboardElementStateCondition : private Scope
 
   StoryboardElementState result;
 
+  const Reference<StoryboardElement> storyboard_element;
+
   explicit StoryboardElementStateCondition(const pugi::xml_node &, const Scope &);
 
   auto description() const -> String;
@@ -18,6 +18,7 @@
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/boolean.hpp>
 #include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/entity_ref.hpp>
 #include <openscenario_interpreter/syntax/rule.hpp>
 #include <openscenario_interpreter/syntax/string.hpp>
 #include <openscenario_interpreter/syntax/triggering_entities.hpp>
@@ -44,7 +45,7 @@ inline namespace syntax
  * -------------------------------------------------------------------------- */
 struct TimeHeadwayCondition
 {
-  const String entity_ref;
+  const EntityRef entity_ref;
 
   const Double value;
 
@@ -56,6 +57,8 @@ struct TimeHeadwayCondition
 
   const TriggeringEntities triggering_entities;
 
+  const Object entity;  // NOTE: The entity named by entity_ref.
+
   std::vector<Double> results;  // for description
 
   explicit TimeHeadwayCondition(const pugi::xml_node &, Scope &, const TriggeringEntities &);
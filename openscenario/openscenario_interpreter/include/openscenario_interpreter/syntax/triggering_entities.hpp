@@ -41,6 +41,8 @@ struct TriggeringEntities
 
   const std::list<EntityRef> entity_refs;
 
+  const std::list<Object> entities;  // NOTE: The entities named by entity_refs, in the same order.
+
   explicit TriggeringEntities(const pugi::xml_node &, Scope &);
 
   template <typename Predicate>
@@ -50,6 +52,21 @@ struct TriggeringEntities
       std::begin(entity_refs), std::end(entity_refs), std::forward<decltype(predicate)>(predicate));
   }
 
+  /* ---- NOTE -----------------------------------------------------------------
+   *
+   *  Same as apply, but the predicate also receives the entity bound to each
+   *  EntityRef at load time, so that the caller does not need to look up the
+   *  entity by name every frame. TriggeringEntitiesRule::apply visits the
+   *  elements in order, which keeps the two lists in step.
+   *
+   * ------------------------------------------------------------------------ */
+  template <typename Predicate>
+  auto applyWithEntity(Predicate && predicate) const -> decltype(auto)
+  {
+    auto entity = std::cbegin(entities);
+    return apply([&](const auto & entity_ref) { return predicate(entity_ref, *entity++); });
+  }
+
   auto description() const -> String;
 };
 }  // namespace syntax
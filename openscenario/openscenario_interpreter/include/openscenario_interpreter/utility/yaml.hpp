@@ -0,0 +1,41 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OPENSCENARIO_INTERPRETER__UTILITY__YAML_HPP_
+#define OPENSCENARIO_INTERPRETER__UTILITY__YAML_HPP_
+
+#include <boost/filesystem.hpp>
+#include <pugixml.hpp>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Reads OpenSCENARIO written in YAML into the given document, following the
+ *  same rules as openscenario_utility's conversion.py: a key beginning with a
+ *  lowercase letter is an attribute, any other key is a child element, a
+ *  sequence is a run of elements of the same name, and an empty sequence is
+ *  omitted. Merge keys (<<) are merged, and plain scalars are spelled as
+ *  PyYAML and Python spell them (e.g. yes is true, 010 is 8). Unlike
+ *  conversion.py, elements are not reordered to the schema's order, which the
+ *  interpreter does not depend on.
+ *
+ * -------------------------------------------------------------------------- */
+auto loadYAML(const boost::filesystem::path &, pugi::xml_document &) -> void;
+}  // namespace utility
+}  // namespace openscenario_interpreter
+
+#endif  // OPENSCENARIO_INTERPRETER__UTILITY__YAML_HPP_
@@ -12,13 +12,25 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include <boost/spirit/include/phoenix.hpp>
-#include <boost/spirit/include/qi.hpp>
+#include <algorithm>
+#include <boost/core/demangle.hpp>
+#include <cctype>
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
 #include <functional>
+#include <iomanip>
+#include <limits>
+#include <list>
+#include <memory>
+#include <mutex>
 #include <openscenario_interpreter/reader/evaluate.hpp>
 #include <openscenario_interpreter/scope.hpp>
 #include <openscenario_interpreter/syntax/parameter_type.hpp>
 #include <openscenario_interpreter/utility/overload.hpp>
+#include <optional>
+#include <unordered_map>
+#include <vector>
 
 #if __cplusplus >= 201606
 #include <variant>
@@ -168,89 +180,471 @@ Value Value::cast<bool>() const
   return same_as<bool>() ? *this : throw std::runtime_error("numeric cannot convert to boolean.");
 }
 
-namespace qi = boost::spirit::qi;
-namespace ascii = boost::spirit::ascii;
-namespace ph = boost::phoenix;
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  An expression is compiled once into a program for a small stack machine.
+ *  Each parameter the expression refers to is given a slot, and the program
+ *  loads the values of parameters from the slots, so it is independent of
+ *  any scope. Programs that refer to no parameter are evaluated once on
+ *  compilation.
+ *
+ *  The grammar is the one of OpenSCENARIO 1.1 (from the loosest binding):
+ *
+ *    lv0 = lv1 { "or" lv1 }
+ *    lv1 = lv2 { "and" lv2 }
+ *    lv2 = lv3 { ("+" | "-") lv3 }
+ *    lv3 = lv4 { ("*" | "/" | "%") lv4 }
+ *    lv4 = "-" lv5 | "not" lv5 | lv5
+ *    lv5 = ("pow" "(" lv0 "," lv0 ")") | (("round" | "floor" | "ceil" | "sqrt") "(" lv0 ")") | lv6
+ *    lv6 = "(" lv0 ")" | "true" | "false" | real | integer | "$" name
+ *
+ * -------------------------------------------------------------------------- */
+class Program
+{
+  enum class Code {
+    push,
+    load,
+    negate,
+    logical_not,
+    round,
+    floor,
+    ceil,
+    sqrt,
+    multiplies,
+    divides,
+    modulus,
+    plus,
+    minus,
+    logical_and,
+    logical_or,
+    pow,
+  };
+
+  struct Instruction
+  {
+    Code code;
+
+    Value value;
+
+    std::size_t slot;
+  };
+
+  std::vector<Instruction> instructions;
+
+  std::optional<Value> constant;
 
-template <typename Iter>
-struct Grammar : qi::grammar<Iter, Value(), ascii::space_type>
+  friend class Compiler;
+
+  auto run(const std::vector<Value> * arguments) const -> Value
+  {
+    std::vector<Value> stack;
+
+    stack.reserve(instructions.size());
+
+    auto pop = [&]() {
+      auto value = std::move(stack.back());
+      stack.pop_back();
+      return value;
+    };
+
+    for (const auto & instruction : instructions) {
+      // clang-format off
+      switch (instruction.code) {
+        case Code::push:        stack.push_back(instruction.value);                   break;
+        case Code::load:        stack.push_back((*arguments)[instruction.slot]);      break;
+        case Code::negate:      stack.back() = -stack.back();                         break;
+        case Code::logical_not: stack.back() = !stack.back();                         break;
+        case Code::round:       stack.back() = stack.back().round();                  break;
+        case Code::floor:       stack.back() = stack.back().floor();                  break;
+        case Code::ceil:        stack.back() = stack.back().ceil();                   break;
+        case Code::sqrt:        stack.back() = stack.back().sqrt();                   break;
+        case Code::multiplies:  { auto rhs = pop(); stack.back() = stack.back() *  rhs; } break;
+        case Code::divides:     { auto rhs = pop(); stack.back() = stack.back() /  rhs; } break;
+        case Code::modulus:     { auto rhs = pop(); stack.back() = stack.back() %  rhs; } break;
+        case Code::plus:        { auto rhs = pop(); stack.back() = stack.back() +  rhs; } break;
+        case Code::minus:       { auto rhs = pop(); stack.back() = stack.back() -  rhs; } break;
+        case Code::logical_and: { auto rhs = pop(); stack.back() = stack.back() && rhs; } break;
+        case Code::logical_or:  { auto rhs = pop(); stack.back() = stack.back() || rhs; } break;
+        case Code::pow:         { auto rhs = pop(); stack.back() = pow(stack.back(), rhs); } break;
+      }
+      // clang-format on
+    }
+
+    return stack.empty() ? Value() : stack.back();
+  }
+
+public:
+  std::vector<std::string> parameters;  // NOTE: The name of the parameter of each slot.
+
+  static auto load(const Object & parameter, const std::string & name) -> Value
+  {
+    if (parameter.is<Integer>()) {
+      return Value{static_cast<int>(parameter.as<Integer>())};
+    } else if (parameter.is<UnsignedInt>()) {
+      return Value{static_cast<unsigned int>(parameter.as<UnsignedInt>())};
+    } else if (parameter.is<UnsignedShort>()) {
+      return Value{static_cast<unsigned short>(parameter.as<UnsignedShort>())};
+    } else if (parameter.is<Double>()) {
+      return Value{parameter.as<Double>()};
+    } else if (parameter.is<Boolean>()) {
+      return Value{parameter.as<Boolean>()};
+    } else {
+      THROW_SYNTAX_ERROR(std::quoted(name), "is neither numeric nor boolean");
+    }
+  }
+
+  auto operator()(const std::vector<Value> & arguments) const -> Value
+  {
+    return constant ? *constant : run(&arguments);
+  }
+};
+
+class Compiler
 {
-  Grammar(const openscenario_interpreter::Scope & scope) : Grammar::base_type(lv0)
+  const std::string & expression;
+
+  std::string::const_iterator iter;
+
+  Program program;
+
+  using Code = Program::Code;
+
+  auto skip() -> void
+  {
+    while (iter != std::end(expression) and std::isspace(static_cast<unsigned char>(*iter))) {
+      ++iter;
+    }
+  }
+
+  static auto isNameCharacter(char c) -> bool
+  {
+    return std::isalnum(static_cast<unsigned char>(c)) or c == '_';
+  }
+
+  auto accept(char c) -> bool
+  {
+    if (skip(); iter != std::end(expression) and *iter == c) {
+      return ++iter, true;
+    } else {
+      return false;
+    }
+  }
+
+  auto accept(const std::string & keyword) -> bool
+  {
+    if (skip(); expression.compare(iter - std::begin(expression), keyword.size(), keyword) == 0) {
+      return iter += keyword.size(), true;
+    } else {
+      return false;
+    }
+  }
+
+  auto expect(char c) -> void
+  {
+    if (not accept(c)) {
+      throw std::invalid_argument("expected " + std::string(1, c));
+    }
+  }
+
+  auto emit(Code code, Value value = Value(), std::size_t slot = 0) -> void
+  {
+    program.instructions.push_back({code, std::move(value), slot});
+  }
+
+  auto slot(const std::string & name) -> std::size_t
+  {
+    auto & parameters = program.parameters;
+    if (auto iter = std::find(std::begin(parameters), std::end(parameters), name);
+        iter != std::end(parameters)) {
+      return std::distance(std::begin(parameters), iter);
+    } else {
+      return parameters.push_back(name), parameters.size() - 1;
+    }
+  }
+
+  auto lv0() -> void
+  {
+    for (lv1(); accept("or");) {
+      lv1(), emit(Code::logical_or);
+    }
+  }
+
+  auto lv1() -> void
+  {
+    for (lv2(); accept("and");) {
+      lv2(), emit(Code::logical_and);
+    }
+  }
+
+  auto lv2() -> void
+  {
+    for (lv3();;) {
+      if (accept('+')) {
+        lv3(), emit(Code::plus);
+      } else if (accept('-')) {
+        lv3(), emit(Code::minus);
+      } else {
+        break;
+      }
+    }
+  }
+
+  auto lv3() -> void
   {
-    using qi::_1;
-    using qi::_2;
-    using qi::_val;
-    const static qi::real_parser<double, qi::strict_real_policies<double>> dbl;
-
-    // clang-format off
-    lv0 = lv1[_val = _1] >> *(qi::lit("or") >> lv1[_val = _val or _1]);
-    lv1 = lv2[_val = _1] >> *(qi::lit("and") >> lv2[_val = _val and _1]);
-    lv2 = lv3[_val = _1] >> *(('+' >> lv3[_val = _val + _1]) | ('-' >> lv3[_val = _val - _1]));
-    lv3 = lv4[_val = _1] >> *(('*' >> lv4[_val = _val * _1]) | ('/' >> lv4[_val = _val / _1]) | ('%' >> lv4[_val = _val % _1]));
-    lv4 = (qi::lit('-') >> lv5)[_val = -_1]
-          | (qi::lit("not") >> lv5)[_val = !_1]
-          | lv5[_val = _1];
-    lv5 = (qi::lit("pow") >> '(' >> lv0 >> ',' >> lv0 >> ')')[_val = ph::bind([](auto &&x, auto &&y) { return pow(x, y); }, _1, _2)]
-          | (qi::lit("round") >> '(' >> lv0 >> ')')[_val = ph::bind(&Value::round, _1)]
-          | (qi::lit("floor") >> '(' >> lv0 >> ')')[_val = ph::bind(&Value::floor, _1)]
-          | (qi::lit("ceil") >> '(' >> lv0 >> ')')[_val = ph::bind(&Value::ceil, _1)]
-          | (qi::lit("sqrt") >> '(' >> lv0 >> ')')[_val = ph::bind(&Value::sqrt, _1)]
-          | lv6[_val = _1];
-    lv6 = ('(' >> lv0 >> ')')[_val = _1]
-          | qi::lit("true")[_val = ph::construct<Value>(true)]
-          | qi::lit("false")[_val = ph::construct<Value>(false)]
-          | dbl[_val = ph::construct<Value>(_1)]
-          | qi::int_[_val = ph::construct<Value>(_1)]
-          | qi::lexeme[qi::lit('$') >> *qi::char_("A-Za-z0-9_")][_val = ph::bind(
-              [scope](auto&& chars) {
-                return toValue(std::string(chars.begin(), chars.end()), scope);
-              }, _1)];
-    // clang-format on
+    for (lv4();;) {
+      if (accept('*')) {
+        lv4(), emit(Code::multiplies);
+      } else if (accept('/')) {
+        lv4(), emit(Code::divides);
+      } else if (accept('%')) {
+        lv4(), emit(Code::modulus);
+      } else {
+        break;
+      }
+    }
   }
 
-  static auto toValue(const std::string & key, const Scope & scope) -> Value
+  auto lv4() -> void
   {
-    auto found = scope.ref(key);
-    if (not found) {
-      THROW_SYNTAX_ERROR(std::quoted(key), "is not declared in this scope");
+    if (accept('-')) {
+      lv5(), emit(Code::negate);
+    } else if (accept("not")) {
+      lv5(), emit(Code::logical_not);
+    } else {
+      lv5();
     }
+  }
+
+  auto lv5() -> void
+  {
+    static const std::vector<std::pair<std::string, Code>> unary_functions{
+      {"round", Code::round},
+      {"floor", Code::floor},
+      {"ceil", Code::ceil},
+      {"sqrt", Code::sqrt},
+    };
+
+    if (accept("pow")) {
+      expect('('), lv0(), expect(','), lv0(), expect(')'), emit(Code::pow);
+      return;
+    }
+
+    for (const auto & [name, code] : unary_functions) {
+      if (accept(name)) {
+        expect('('), lv0(), expect(')'), emit(code);
+        return;
+      }
+    }
+
+    lv6();
+  }
 
-    if (found.is<Integer>()) {
-      return Value{static_cast<int>(found.as<Integer>())};
-    } else if (found.is<UnsignedInt>()) {
-      return Value{static_cast<unsigned int>(found.as<UnsignedInt>())};
-    } else if (found.is<UnsignedShort>()) {
-      return Value{static_cast<unsigned short>(found.as<UnsignedShort>())};
-    } else if (found.is<Double>()) {
-      return Value{found.as<Double>()};
-    } else if (found.is<Boolean>()) {
-      return Value{found.as<Boolean>()};
+  auto lv6() -> void
+  {
+    if (accept('(')) {
+      lv0(), expect(')');
+    } else if (accept("true")) {
+      emit(Code::push, Value(true));
+    } else if (accept("false")) {
+      emit(Code::push, Value(false));
+    } else if (accept('$')) {
+      auto first = iter;
+      while (iter != std::end(expression) and isNameCharacter(*iter)) {
+        ++iter;
+      }
+      if (iter == first) {
+        throw std::invalid_argument("expected name");
+      }
+      emit(Code::load, Value(), slot(std::string(first, iter)));
     } else {
-      THROW_SYNTAX_ERROR(std::quoted(key), "is neither numeric nor boolean");
+      number();
     }
   }
 
-  qi::rule<Iter, Value(), ascii::space_type> lv0, lv1, lv2, lv3, lv4, lv5, lv6;
+  // NOTE: A literal is real only if it has a decimal point or an exponent.
+  auto number() -> void
+  {
+    auto first = iter;
+
+    auto digits = [&]() {
+      auto begin = iter;
+      while (iter != std::end(expression) and std::isdigit(static_cast<unsigned char>(*iter))) {
+        ++iter;
+      }
+      return iter != begin;
+    };
+
+    if (iter != std::end(expression) and (*iter == '+' or *iter == '-')) {
+      ++iter;
+    }
+
+    auto integral = digits();
+
+    auto fractional = false;
+
+    if (iter != std::end(expression) and *iter == '.') {
+      if (++iter, not(fractional = digits() or integral)) {
+        throw std::invalid_argument("expected number");
+      }
+    }
+
+    auto exponential = false;
+
+    if (auto mantissa = iter; (integral or fractional) and iter != std::end(expression) and
+                              (*iter == 'e' or *iter == 'E')) {
+      if (++iter != std::end(expression) and (*iter == '+' or *iter == '-')) {
+        ++iter;
+      }
+      if (not(exponential = digits())) {
+        iter = mantissa;
+      }
+    }
+
+    if (fractional or exponential) {
+      emit(Code::push, Value(std::strtod(std::string(first, iter).c_str(), nullptr)));
+    } else if (integral) {
+      errno = 0;
+      const auto value = std::strtol(std::string(first, iter).c_str(), nullptr, 10);
+      if (errno == ERANGE or value < std::numeric_limits<int>::min() or
+          std::numeric_limits<int>::max() < value) {
+        throw std::invalid_argument("integer out of range");
+      }
+      emit(Code::push, Value(static_cast<int>(value)));
+    } else {
+      throw std::invalid_argument("expected number");
+    }
+  }
+
+public:
+  explicit Compiler(const std::string & expression)
+  : expression(expression), iter(std::begin(expression))
+  {
+  }
+
+  auto compile() -> Program
+  {
+    try {
+      if (not expression.empty()) {
+        lv0();
+      }
+      if (skip(); iter != std::end(expression)) {
+        throw std::invalid_argument("unexpected character");
+      }
+    } catch (const std::invalid_argument &) {
+      THROW_SYNTAX_ERROR("Failed to parse ", std::quoted(expression));
+    }
+
+    if (program.parameters.empty()) {
+      program.constant = program.run(nullptr);
+    }
+
+    return program;
+  }
 };
 
-std::string evaluate(const std::string & expression, const Scope & scope)
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Programs are shared by the text of the expression among all the scopes of
+ *  all the scenarios loaded by this process. Only the most recently used ones
+ *  are kept, so that loading scenarios one after another (e.g. the variants
+ *  of a ParameterValueDistribution) does not grow the cache without bound.
+ *
+ * -------------------------------------------------------------------------- */
+class Programs
 {
-  Grammar<decltype(expression.begin())> parser{scope};
-  Value output;
-  auto first = expression.begin();
-  auto last = expression.end();
+  const std::size_t capacity;
 
-  qi::phrase_parse(first, last, parser, ascii::space, output);
+  std::list<std::pair<std::string, std::shared_ptr<const Program>>> programs;  // NOTE: MRU first
 
-  if (first != last) {
-    THROW_SYNTAX_ERROR("Failed to parse ", std::quoted(expression));
+  std::unordered_map<std::string, decltype(programs)::iterator> index;
+
+  std::mutex mutex;
+
+public:
+  explicit Programs(std::size_t capacity) : capacity(capacity) {}
+
+  auto compile(const std::string & expression) -> std::shared_ptr<const Program>
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if (auto iter = index.find(expression); iter != std::end(index)) {
+      programs.splice(std::begin(programs), programs, iter->second);
+    } else {
+      auto program = std::make_shared<const Program>(Compiler(expression).compile());
+      programs.emplace_front(expression, std::move(program));
+      index.emplace(expression, std::begin(programs));
+      if (capacity < programs.size()) {
+        index.erase(programs.back().first);
+        programs.pop_back();
+      }
+    }
+
+    return programs.front().second;
   }
+};
 
-  return visit(
-    overload(
-      [](bool v) -> std::string { return v ? "true" : "false"; },
-      [](auto v) -> std::string { return std::to_string(v); }),
-    output.data);
+struct CompiledExpression::Binding
+{
+  const std::shared_ptr<const Program> program;
+
+  std::vector<Object> parameters;
+
+  std::vector<Value> arguments;
+
+  std::optional<std::string> result;
+
+  explicit Binding(const std::string & expression, const Scope & scope)
+  : program([&]() {
+      static Programs programs{1024};
+      return programs.compile(expression);
+    }()),
+    arguments(program->parameters.size())
+  {
+    for (const auto & name : program->parameters) {
+      if (auto parameter = scope.ref(name); parameter) {
+        parameters.push_back(parameter);
+      } else {
+        THROW_SYNTAX_ERROR(std::quoted(name), "is not declared in this scope");
+      }
+    }
+  }
+};
+
+CompiledExpression::CompiledExpression(const std::string & expression, const Scope & scope)
+: binding(std::make_unique<Binding>(expression, scope))
+{
+}
+
+CompiledExpression::CompiledExpression(CompiledExpression &&) noexcept = default;
+
+CompiledExpression::~CompiledExpression() = default;
+
+auto CompiledExpression::evaluate() -> const std::string &
+{
+  auto changed = not binding->result;
+
+  for (std::size_t slot = 0; slot < binding->parameters.size(); ++slot) {
+    auto argument = Program::load(binding->parameters[slot], binding->program->parameters[slot]);
+    if (not(argument.data == binding->arguments[slot].data)) {
+      binding->arguments[slot] = std::move(argument);
+      changed = true;
+    }
+  }
+
+  if (changed) {
+    binding->result = visit(
+      overload(
+        [](bool v) -> std::string { return v ? "true" : "false"; },
+        [](auto v) -> std::string { return std::to_string(v); }),
+      (*binding->program)(binding->arguments).data);
+  }
+
+  return *binding->result;
+}
+
+std::string evaluate(const std::string & expression, const Scope & scope)
+{
+  return CompiledExpression(expression, scope).evaluate();
 }
 
 }  // namespace reader
@@ -15,13 +15,19 @@
 #define OPENSCENARIO_INTERPRETER_NO_EXTENSION
 
 #include <algorithm>
+#include <iomanip>
 #include <nlohmann/json.hpp>
+#include <openscenario_interpreter/dirty_elements.hpp>
 #include <openscenario_interpreter/openscenario_interpreter.hpp>
 #include <openscenario_interpreter/record.hpp>
+#include <openscenario_interpreter/revisions.hpp>
+#include <openscenario_interpreter/subscription_hub.hpp>
 #include <openscenario_interpreter/syntax/object_controller.hpp>
 #include <openscenario_interpreter/syntax/scenario_definition.hpp>
 #include <openscenario_interpreter/utility/overload.hpp>
 #include <rclcpp_components/register_node_macro.hpp>
+#include <simple_profiler/profiler.hpp>
+#include <sstream>
 
 #define DECLARE_PARAMETER(IDENTIFIER) \
   declare_parameter<decltype(IDENTIFIER)>(#IDENTIFIER, IDENTIFIER)
@@ -33,20 +39,72 @@ namespace openscenario_interpreter
 Interpreter::Interpreter(const rclcpp::NodeOptions & options)
 : rclcpp_lifecycle::LifecycleNode("openscenario_interpreter", options),
   publisher_of_context(create_publisher<Context>("context", rclcpp::QoS(1).transient_local())),
+  context_snapshot_service(create_service<std_srvs::srv::Trigger>(
+    "context/request_snapshot",
+    [this](
+      const std::shared_ptr<std_srvs::srv::Trigger::Request>,
+      std::shared_ptr<std_srvs::srv::Trigger::Response> response) {
+      context_snapshot_requested = true;
+      response->success = true;
+    })),
+  context_subscription_count(0),
+  context_snapshot_requested(false),
   intended_result("success"),
   local_frame_rate(30),
   local_real_time_factor(1.0),
+  as_fast_as_possible(false),
+  maximum_real_time_factor(0.0),
+  context_publish_rate(10),
+  debug_marker_publish_decimation(1),
+  entity_status_publish_decimation(1),
+  in_process_simulator(false),
+  track_condition_dependencies(true),
   osc_path(""),
-  output_directory("/tmp")
+  output_directory("/tmp"),
+  profile(false),
+  variant_count(0)
 {
   DECLARE_PARAMETER(intended_result);
   DECLARE_PARAMETER(local_frame_rate);
   DECLARE_PARAMETER(local_real_time_factor);
+  DECLARE_PARAMETER(as_fast_as_possible);
+  DECLARE_PARAMETER(maximum_real_time_factor);
+  DECLARE_PARAMETER(context_publish_rate);
+  DECLARE_PARAMETER(debug_marker_publish_decimation);
+  DECLARE_PARAMETER(entity_status_publish_decimation);
+  DECLARE_PARAMETER(in_process_simulator);
+  DECLARE_PARAMETER(track_condition_dependencies);
   DECLARE_PARAMETER(osc_path);
   DECLARE_PARAMETER(output_directory);
+  DECLARE_PARAMETER(profile);
 }
 
-Interpreter::~Interpreter() { disconnect(); }
+Interpreter::~Interpreter()
+{
+  disconnect();
+
+  subscription_hub.detach();
+}
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  In as-fast-as-possible mode, the next frame is evaluated as soon as the
+ *  previous one finishes. If maximum_real_time_factor is positive, frames are
+ *  throttled so that the simulation time does not advance faster than
+ *  maximum_real_time_factor times the wall clock time.
+ *
+ * -------------------------------------------------------------------------- */
+auto Interpreter::currentLocalFramePeriod() const -> std::chrono::nanoseconds
+{
+  if (not as_fast_as_possible) {
+    return currentLocalFrameRate();
+  } else if (0 < maximum_real_time_factor) {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<double>(
+      1 / local_frame_rate * local_real_time_factor / maximum_real_time_factor));
+  } else {
+    return std::chrono::nanoseconds(0);
+  }
+}
 
 auto Interpreter::currentLocalFrameRate() const -> std::chrono::milliseconds
 {
@@ -58,6 +116,89 @@ auto Interpreter::currentScenarioDefinition() const -> const std::shared_ptr<Sce
   return scenarios.front();
 }
 
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Records where the part of each StoryboardElement, Trigger, ConditionGroup
+ *  and Condition is in the published context, following the structure written
+ *  by their operator<<. Each entry serializes only the fields of the element
+ *  that change during the simulation, not its children.
+ *
+ * -------------------------------------------------------------------------- */
+auto Interpreter::indexPublishedContext() -> void
+{
+  using json_pointer = nlohmann::json::json_pointer;
+
+  published_context_index.clear();
+
+  auto index = [this](const void * element, const json_pointer & pointer, auto && serialize) {
+    published_context_index.emplace(element, std::make_pair(pointer, serialize));
+  };
+
+  auto index_trigger = [&](const json_pointer & pointer, const Trigger & trigger) {
+    index(&trigger, pointer, [&trigger]() {
+      return nlohmann::json{
+        {"currentValue", boost::lexical_cast<std::string>(Boolean(trigger.current_value))}};
+    });
+    std::size_t i = 0;
+    for (const auto & condition_group : trigger) {
+      const auto condition_group_pointer = pointer / "ConditionGroup" / i++;
+      index(&condition_group, condition_group_pointer, [&condition_group]() {
+        return nlohmann::json{{
+          "currentValue",
+          boost::lexical_cast<std::string>(Boolean(condition_group.current_value)),
+        }};
+      });
+      std::size_t j = 0;
+      for (const auto & condition : condition_group) {
+        index(&condition, condition_group_pointer / "Condition" / j++, [&condition]() {
+          return nlohmann::json{
+            {"currentEvaluation", condition.description()},
+            {"currentValue", boost::lexical_cast<std::string>(Boolean(condition.current_value))}};
+        });
+      }
+    }
+  };
+
+  // NOTE: Only ManeuverGroup and Event write their execution counts, and only Event its trigger.
+  auto index_storyboard_element =
+    [&](const json_pointer & pointer, const StoryboardElement & element, const String & name) {
+      const auto counted = name == "ManeuverGroup" or name == "Event";
+      index(&element, pointer, [&element, counted]() {
+        nlohmann::json part;
+        part["currentState"] = boost::lexical_cast<std::string>(element.state());
+        if (counted) {
+          part["currentExecutionCount"] = element.current_execution_count;
+        }
+        return part;
+      });
+      if (name == "Event") {
+        index_trigger(pointer / "StartTrigger", element.start_trigger);
+      }
+    };
+
+  static const std::vector<std::string> names{
+    "Story", "Act", "ManeuverGroup", "Maneuver", "Event", "Action"};
+
+  std::function<void(const json_pointer &, const StoryboardElement &, std::size_t)> index_elements =
+    [&](const json_pointer & pointer, const StoryboardElement & parent, std::size_t depth) {
+      if (depth < names.size()) {
+        std::size_t i = 0;
+        for (const auto & each : parent.elements) {
+          const auto element_pointer = pointer / names[depth] / i++;
+          const auto & element = each.as<StoryboardElement>();
+          index_storyboard_element(element_pointer, element, names[depth]);
+          index_elements(element_pointer, element, depth + 1);
+        }
+      }
+    };
+
+  const auto & storyboard = currentScenarioDefinition()->storyboard;
+
+  index_storyboard_element(json_pointer("/OpenSCENARIO/Storyboard"), storyboard, "Storyboard");
+
+  index_elements(json_pointer("/OpenSCENARIO/Storyboard"), storyboard, 0);
+}
+
 auto Interpreter::isAnErrorIntended() const -> bool { return intended_result == "error"; }
 
 auto Interpreter::isFailureIntended() const -> bool { return intended_result == "failure"; }
@@ -76,8 +217,22 @@ auto Interpreter::makeCurrentConfiguration() const -> traffic_simulator::Configu
     configuration.initialize_duration =
       ObjectController::ego_count > 0 ? getParameter<int>("initialize_duration") : 0;
 
+    configuration.debug_marker_publish_decimation = std::max(debug_marker_publish_decimation, 1);
+
+    configuration.entity_status_publish_decimation = std::max(entity_status_publish_decimation, 1);
+
+    configuration.in_process_simulator = in_process_simulator;
+
+    if (profile) {
+      configuration.profile_path =
+        boost::filesystem::path(output_directory) / (case_name + ".trace.json");
+    }
+
     configuration.scenario_path = osc_path;
 
+    // NOTE: /clock must follow the simulation time if frames are not evaluated in real time.
+    configuration.use_raw_clock = not as_fast_as_possible;
+
     // XXX DIRTY HACK!!!
     if (not logic_file.isDirectory() and logic_file.filepath.extension() == ".osm") {
       configuration.lanelet2_map_file = logic_file.filepath.filename().string();
@@ -112,21 +267,78 @@ auto Interpreter::on_configure(const rclcpp_lifecycle::State &) -> Result
       GET_PARAMETER(intended_result);
       GET_PARAMETER(local_frame_rate);
       GET_PARAMETER(local_real_time_factor);
+      GET_PARAMETER(as_fast_as_possible);
+      GET_PARAMETER(maximum_real_time_factor);
+      GET_PARAMETER(context_publish_rate);
+      GET_PARAMETER(debug_marker_publish_decimation);
+      GET_PARAMETER(entity_status_publish_decimation);
+      GET_PARAMETER(in_process_simulator);
+      GET_PARAMETER(track_condition_dependencies);
       GET_PARAMETER(osc_path);
       GET_PARAMETER(output_directory);
+      GET_PARAMETER(profile);
+
+      revisions.tracking = track_condition_dependencies;
+
+      subscription_hub.attach(*this);  // NOTE: Must be attached before loading the script.
 
       script = std::make_shared<OpenScenario>(osc_path);
 
+      case_name = boost::filesystem::path(osc_path).stem().string();
+
+      shared_map = nullptr;
+
+      shared_map_path.clear();
+
       if (script->category.is<ScenarioDefinition>()) {
         scenarios = {std::dynamic_pointer_cast<ScenarioDefinition>(script->category)};
+      } else if (script->category.is<ParameterValueDistributionDefinition>()) {
+        const auto & definition = script->category.as<ParameterValueDistributionDefinition>();
+        distribution = script;
+        variants.assign(
+          std::begin(definition.parameter_value_sets), std::end(definition.parameter_value_sets));
+        variant_count = 0;
+        scenarios.clear();
       } else {
-        throw SyntaxError("ParameterValueDistributionDefinition is not yet supported.");
+        throw SyntaxError("CatalogDefinition cannot be run as a scenario.");
       }
 
       return Interpreter::Result::SUCCESS;  // => Inactive
     });
 }
 
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Each variant of a ParameterValueDistribution is instantiated from the
+ *  scenario file parsed once on configure, and is run by its own activation.
+ *  The resulting JUnit test case is named after the values of the variant.
+ *
+ * -------------------------------------------------------------------------- */
+auto Interpreter::nextVariant() -> void
+{
+  const auto & definition = distribution->category.as<ParameterValueDistributionDefinition>();
+
+  const auto & parameter_value_set = variants.front();
+
+  script = definition.instantiate(parameter_value_set);
+
+  scenarios = {std::dynamic_pointer_cast<ScenarioDefinition>(script->category)};
+
+  std::stringstream name;
+
+  name << boost::filesystem::path(osc_path).stem().string() << "__" << variant_count++;
+
+  for (const auto & [parameter_name, value] : parameter_value_set) {
+    name << "__" << parameter_name << "_" << value;
+  }
+
+  case_name = name.str();
+
+  INTERPRETER_INFO_STREAM("Run variant " << std::quoted(case_name));
+
+  variants.pop_front();
+}
+
 auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
 {
   auto evaluateStoryboard = [this]() {
@@ -135,12 +347,15 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
       [this]() {
         if (currentScenarioDefinition()) {
           const auto evaluate_time = execution_timer.invoke("evaluate", [&] {
+            PROFILE_SCOPE("Interpreter::evaluate");
             currentScenarioDefinition()->evaluate();
             publishCurrentContext();
             return 0 <= getCurrentTime();  // statistics only if 0 <= getCurrentTime()
           });
 
-          if (0 <= getCurrentTime() and currentLocalFrameRate() < evaluate_time) {
+          if (
+            not as_fast_as_possible and 0 <= getCurrentTime() and
+            currentLocalFrameRate() < evaluate_time) {
             RCLCPP_WARN_STREAM(
               get_logger(),
               "Your machine is not powerful enough to run the scenario at the specified "
@@ -158,18 +373,59 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
       });
   };
 
-  if (scenarios.empty()) {
+  if (scenarios.empty() and variants.empty()) {
     return Result::FAILURE;
   } else {
     return withExceptionHandler(
       [this](auto &&...) { return Interpreter::Result::ERROR; },
       [&]() {
+        if (scenarios.empty()) {
+          nextVariant();
+        }
+
         if (getParameter<bool>("record", true)) {
           record::start(
-            "-a", "-o", boost::filesystem::path(osc_path).replace_extension("").string());
+            "-a", "-o",
+            (boost::filesystem::path(osc_path).parent_path() / case_name).string());
         }
 
-        connect(shared_from_this(), makeCurrentConfiguration());
+        if (as_fast_as_possible and 0 < ObjectController::ego_count) {
+          RCLCPP_WARN_STREAM(
+            get_logger(),
+            "The as-fast-as-possible mode is not available for scenarios in which Autoware "
+            "controls the ego entity. The scenario is evaluated in real time.");
+          as_fast_as_possible = false;
+        }
+
+        if (profile and not common::profiler::compiled()) {
+          RCLCPP_WARN_STREAM(
+            get_logger(),
+            "The simulator is built without SIMPLE_PROFILER_ENABLED=ON, so no profile can be "
+            "recorded. The scenario is evaluated without profiling.");
+          profile = false;
+        }
+
+        const auto configuration = makeCurrentConfiguration();
+
+        connect(
+          shared_from_this(), configuration,
+          configuration.lanelet2_map_path() == shared_map_path ? shared_map : nullptr);
+
+        /* ---- NOTE -----------------------------------------------------------
+         *
+         *  Loading the lanelet map is the most expensive part of connecting to
+         *  the simulator, so the map of a variant is kept for the next variant
+         *  of the same ParameterValueDistribution and released after the last
+         *  one.
+         *
+         * ------------------------------------------------------------------ */
+        if (variants.empty()) {
+          shared_map = nullptr;
+          shared_map_path.clear();
+        } else {
+          shared_map = connection->getHdmapUtils();
+          shared_map_path = configuration.lanelet2_map_path();
+        }
 
         initialize(local_real_time_factor, 1 / local_frame_rate * local_real_time_factor);
 
@@ -179,7 +435,13 @@ auto Interpreter::on_activate(const rclcpp_lifecycle::State &) -> Result
 
         assert(publisher_of_context->is_activated());
 
-        timer = create_wall_timer(currentLocalFrameRate(), evaluateStoryboard);
+        published_context = nullptr;  // NOTE: The first context of a scenario is a snapshot.
+
+        time_on_activate = std::chrono::steady_clock::now();
+
+        simulation_time_on_activate = getCurrentTime();
+
+        timer = create_wall_timer(currentLocalFramePeriod(), evaluateStoryboard);
 
         return Interpreter::Result::SUCCESS;  // => Active
       });
@@ -192,6 +454,10 @@ auto Interpreter::on_deactivate(const rclcpp_lifecycle::State &) -> Result
 
   publisher_of_context->on_deactivate();
 
+  if (connection) {
+    reportThroughput();
+  }
+
   disconnect();  // Deactivate traffic_simulator
 
   scenarios.pop_front();
@@ -213,6 +479,10 @@ auto Interpreter::on_deactivate(const rclcpp_lifecycle::State &) -> Result
 
 auto Interpreter::on_cleanup(const rclcpp_lifecycle::State &) -> Result
 {
+  shared_map = nullptr;
+
+  shared_map_path.clear();
+
   return Interpreter::Result::SUCCESS;  // => Unconfigured
 }
 
@@ -230,17 +500,103 @@ auto Interpreter::on_shutdown(const rclcpp_lifecycle::State &) -> Result
   return Interpreter::Result::SUCCESS;  // => Finalized
 }
 
-auto Interpreter::publishCurrentContext() const -> void
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Serializing the whole context every frame is expensive for large scenarios,
+ *  so the context is published at most context_publish_rate times per second
+ *  (every frame if context_publish_rate is not positive), and as a patch of
+ *  only the parts of the elements marked dirty since the last publication. A
+ *  full snapshot is published when a new subscriber appears or when a
+ *  subscriber requests it via the service "context/request_snapshot". Nothing
+ *  is serialized while there is no subscriber.
+ *
+ * -------------------------------------------------------------------------- */
+auto Interpreter::publishCurrentContext() -> void
 {
+  const auto subscription_count = publisher_of_context->get_subscription_count();
+
+  if (subscription_count == 0) {
+    published_context = nullptr;
+    published_context_index.clear();
+    dirty_elements.take();
+    context_subscription_count = 0;
+    return;
+  }
+
+  const auto snapshot_required = published_context.is_null() or
+                                 context_subscription_count < subscription_count or
+                                 context_snapshot_requested;
+
+  context_subscription_count = subscription_count;
+
+  const auto time_of_this_context = std::chrono::steady_clock::now();
+
+  if (
+    not snapshot_required and 0 < context_publish_rate and
+    time_of_this_context - time_of_last_context <
+      std::chrono::duration<double>(1 / context_publish_rate)) {
+    return;
+  }
+
   Context context;
   {
-    nlohmann::json json;
     context.stamp = now();
-    context.data = (json << *script).dump();
+
+    if (snapshot_required) {
+      published_context = nlohmann::json();
+      published_context << *script;
+      indexPublishedContext();
+      dirty_elements.take();
+      context.type = Context::SNAPSHOT;
+      context.data = published_context.dump();
+    } else {
+      auto patch = nlohmann::json::array();
+
+      auto replace = [&](const auto & pointer, const nlohmann::json & part) {
+        for (const auto & [key, value] : part.items()) {
+          if (auto & published = published_context.at(pointer / key); published != value) {
+            patch.push_back(
+              {{"op", "replace"}, {"path", (pointer / key).to_string()}, {"value", value}});
+            published = value;
+          }
+        }
+      };
+
+      nlohmann::json frame;
+      replace(nlohmann::json::json_pointer(), serializeFrame(frame, *script));
+
+      for (const auto & element : dirty_elements.take()) {
+        if (const auto iter = published_context_index.find(element);
+            iter != std::end(published_context_index)) {
+          replace(iter->second.first, iter->second.second());
+        }
+      }
+
+      context.type = Context::PATCH;
+      context.data = patch.dump();
+    }
+
     context.time = getCurrentTime();
   }
 
   publisher_of_context->publish(context);
+
+  time_of_last_context = time_of_this_context;
+
+  context_snapshot_requested = false;
+}
+
+auto Interpreter::reportThroughput() const -> void
+{
+  const auto wall_time =
+    std::chrono::duration<double>(std::chrono::steady_clock::now() - time_on_activate).count();
+
+  const auto simulation_time = getCurrentTime() - simulation_time_on_activate;
+
+  RCLCPP_INFO_STREAM(
+    get_logger(), "Simulated " << simulation_time << " seconds in " << wall_time
+                               << " seconds of wall clock time (" << simulation_time / wall_time
+                               << " simulation seconds per wall clock second).");
 }
 }  // namespace openscenario_interpreter
 
@@ -14,11 +14,64 @@
 
 #include <memory>
 #include <openscenario_interpreter/procedure.hpp>
+#include <string>
+#include <unordered_map>
 
 namespace openscenario_interpreter
 {
 std::unique_ptr<traffic_simulator::API> connection = nullptr;
 
+using EntityStatus = traffic_simulator_msgs::msg::EntityStatus;
+
+// NOTE: The statuses of entities after the last updateFrame.
+static std::unordered_map<std::string, std::shared_ptr<const EntityStatus>> entity_statuses;
+
+static auto kinematicsEqual(const EntityStatus & a, const EntityStatus & b)
+{
+  // NOTE: The time of the status advances on every frame and is not compared.
+  return a.pose == b.pose and a.action_status == b.action_status and
+         a.lanelet_pose == b.lanelet_pose and a.lanelet_pose_valid == b.lanelet_pose_valid and
+         a.bounding_box == b.bounding_box;
+}
+
+auto initialize(const double realtime_factor, const double step_time) -> bool
+{
+  revisions.touch(Dependency::simulation_time);
+  revisions.touch(Dependency::entity_kinematics);
+  entity_statuses.clear();
+  return connection->initialize(realtime_factor, step_time);
+}
+
+auto updateFrame() -> bool
+{
+  const auto previous_time = connection->getCurrentTime();
+
+  const auto result = connection->updateFrame();
+
+  revisions.advance(previous_time, connection->getCurrentTime());
+
+  if (revisions.tracking) {
+    auto changed = false;
+    auto statuses = decltype(entity_statuses)();
+    for (const auto & name : connection->getEntityNames()) {
+      if (connection->entityStatusSet(name)) {
+        const auto status = connection->getEntityStatus(name);
+        if (const auto iter = entity_statuses.find(name);
+            iter == std::end(entity_statuses) or not kinematicsEqual(*iter->second, *status)) {
+          changed = true;
+        }
+        statuses.emplace(name, status);
+      }
+    }
+    if (changed or statuses.size() != entity_statuses.size()) {
+      revisions.touch(Dependency::entity_kinematics);
+    }
+    entity_statuses.swap(statuses);
+  }
+
+  return result;
+}
+
 auto toLanePosition(const geometry_msgs::msg::Pose & pose) -> typename std::decay<
   decltype(connection->toLaneletPose(std::declval<decltype(pose)>(), false).get())>::type
 {
@@ -0,0 +1,60 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <openscenario_interpreter/revisions.hpp>
+
+namespace openscenario_interpreter
+{
+Revisions revisions;
+
+auto Revisions::of(const Dependency dependency) const noexcept -> std::optional<std::size_t>
+{
+  if (tracking and dependency != Dependency::untracked) {
+    return counts[static_cast<std::size_t>(dependency)];
+  } else {
+    return std::nullopt;
+  }
+}
+
+auto Revisions::of(const double threshold) const -> std::optional<std::size_t>
+{
+  if (const auto iter = thresholds.find(threshold); tracking and iter != std::end(thresholds)) {
+    // NOTE: Touching simulation_time (e.g. by initialize) invalidates every threshold.
+    return counts[static_cast<std::size_t>(Dependency::simulation_time)] + iter->second;
+  } else {
+    return std::nullopt;
+  }
+}
+
+auto Revisions::declare(const double threshold) -> void { thresholds.emplace(threshold, 0); }
+
+auto Revisions::advance(const double from, const double to) -> void
+{
+  if (from != to) {
+    const auto [lower, upper] = std::minmax(from, to);
+    for (auto iter = thresholds.lower_bound(lower);
+         iter != std::end(thresholds) and iter->first <= upper; ++iter) {
+      ++iter->second;
+    }
+  }
+}
+
+auto Revisions::touch(const Dependency dependency) noexcept -> void
+{
+  if (dependency != Dependency::untracked) {
+    ++counts[static_cast<std::size_t>(dependency)];
+  }
+}
+}  // namespace openscenario_interpreter
@@ -0,0 +1,74 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iomanip>
+#include <openscenario_interpreter/error.hpp>
+#include <openscenario_interpreter/subscription_hub.hpp>
+#include <openscenario_interpreter/syntax/parameter_declaration.hpp>
+#include <openscenario_msgs/msg/parameter_declaration.hpp>
+
+namespace openscenario_interpreter
+{
+SubscriptionHub subscription_hub;
+
+auto SubscriptionHub::Value::get() const -> const Object &
+{
+  if (thrown) {
+    std::rethrow_exception(thrown);
+  } else {
+    return value;
+  }
+}
+
+auto SubscriptionHub::detach() -> void
+{
+  topics.clear();
+  callback_group.reset();
+  node_topics.reset();
+  node_base.reset();
+}
+
+auto SubscriptionHub::subscribe(const std::string & topic_name) -> std::shared_ptr<const Value>
+{
+  using Message = openscenario_msgs::msg::ParameterDeclaration;
+
+  if (const auto iter = topics.find(topic_name); iter != std::end(topics)) {
+    return std::get<1>(iter->second);
+  } else if (not node_topics) {
+    throw Error("No node to subscribe to topic ", std::quoted(topic_name), " with.");
+  } else {
+    auto value = std::make_shared<Value>();
+
+    rclcpp::SubscriptionOptions options;
+    options.callback_group = callback_group;
+
+    auto subscription = rclcpp::create_subscription<Message>(
+      node_topics.get(), topic_name, 1,
+      [value](const Message::SharedPtr message) {
+        try {
+          value->value =
+            message->value.empty() ? unspecified : ParameterDeclaration(*message).evaluate();
+          value->thrown = nullptr;
+        } catch (...) {
+          value->thrown = std::current_exception();  // NOTE: Rethrown by the condition.
+        }
+      },
+      options);
+
+    topics.emplace(topic_name, std::make_pair(subscription, value));
+
+    return value;
+  }
+}
+}  // namespace openscenario_interpreter
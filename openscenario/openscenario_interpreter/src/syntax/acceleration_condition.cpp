@@ -47,7 +47,7 @@ auto AccelerationCondition::evaluate() -> Object
   results.clear();
 
   return asBoolean(triggering_entities.apply([&](auto && triggering_entity) {
-    results.push_back(getEntityStatus(triggering_entity).action_status.accel.linear.x);
+    results.push_back(getEntityStatus(triggering_entity)->action_status.accel.linear.x);
     return compare(results.back(), value);
   }));
 }
@@ -47,7 +47,7 @@ auto Action::start() -> void
 auto Action::stop() -> void
 {
   if (overridden) {
-    current_state = complete_state;
+    transitionTo(complete_state);
   } else {
     overridden = true;
   }
@@ -13,30 +13,69 @@
 // limitations under the License.
 
 #include <boost/filesystem.hpp>
+#include <cstdint>
+#include <ctime>
+#include <memory>
 #include <openscenario_interpreter/reader/element.hpp>
-#include <openscenario_interpreter/syntax/catalog.hpp>
 #include <openscenario_interpreter/syntax/catalog_location.hpp>
 #include <openscenario_interpreter/syntax/directory.hpp>
-#include <openscenario_interpreter/syntax/openscenario.hpp>
+#include <openscenario_interpreter/utility/yaml.hpp>
+#include <string>
+#include <unordered_map>
 
 namespace openscenario_interpreter
 {
 inline namespace syntax
 {
-auto convertScenario(
-  const boost::filesystem::path & yaml_path, const boost::filesystem::path & output_dir)
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  A catalog file indexed by an earlier CatalogLocation of this process. It is
+ *  indexed again if its modification time or its size changed, since the
+ *  modification time alone has a resolution of one second.
+ *
+ * -------------------------------------------------------------------------- */
+struct CatalogFile
 {
-  std::stringstream command;
+  std::time_t last_write_time;
 
-  command << "python3 -c \"from openscenario_utility import conversion; conversion.main()\""
-          << " --input " << yaml_path  //
-          << " --output " << output_dir;
+  std::uintmax_t file_size;
 
-  if (std::system(command.str().c_str()) != 0) {
-    THROW_SYNTAX_ERROR("failed to convert sceanrio: " + yaml_path.string());
-  } else {
-    return output_dir / yaml_path.filename().stem().replace_extension(".xosc");
+  std::string catalog_name;
+
+  std::shared_ptr<pugi::xml_document> document;  // NOTE: nullptr until first loaded.
+};
+
+static auto catalogFiles() -> std::unordered_map<std::string, CatalogFile> &
+{
+  static std::unordered_map<std::string, CatalogFile> catalog_files;
+  return catalog_files;
+}
+
+static auto loadDocument(const boost::filesystem::path & path)
+{
+  auto document = std::make_shared<pugi::xml_document>();
+
+  if (path.extension() == ".yaml") {
+    loadYAML(path, *document);
+  } else if (const auto result = document->load_file(path.string().c_str()); not result) {
+    THROW_SYNTAX_ERROR("failed to load catalog ", path, ": ", result.description());
   }
+
+  return document;
+}
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Returns the name attribute of the Catalog element of the given XML file.
+ *  The file is parsed without its text, comments and processing instructions,
+ *  which are not needed to find the element, and the document is discarded.
+ *
+ * -------------------------------------------------------------------------- */
+static auto readCatalogName(const boost::filesystem::path & path) -> std::string
+{
+  pugi::xml_document document;
+  document.load_file(path.string().c_str(), pugi::parse_minimal | pugi::parse_escapes);
+  return document.child("OpenSCENARIO").child("Catalog").attribute("name").as_string();
 }
 
 CatalogLocation::CatalogLocation(const pugi::xml_node & node, Scope & scope)
@@ -49,30 +88,50 @@ CatalogLocation::CatalogLocation(const pugi::xml_node & node, Scope & scope)
     THROW_SYNTAX_ERROR(directory.path.string() + " is not directory");
   }
 
-  for (auto path : Directory::ls(directory)) {
-    if (path.extension() == ".yaml") {
-      path = convertScenario(
-        path, boost::filesystem::path("/tmp/converted_scenario") / directory.path.filename());
-    } else if (path.extension() != ".xosc") {
+  for (const auto & path : Directory::ls(directory)) {
+    if (path.extension() != ".xosc" and path.extension() != ".yaml") {
       continue;
     }
-    auto new_document = std::make_shared<pugi::xml_document>();
-    new_document->load_file(path.string().c_str());
-    catalog_files.emplace_back(std::move(new_document));
-  }
 
-  for (auto && xml : catalog_files) {
-    auto open_scenario = xml->child("OpenSCENARIO");
-    if (open_scenario) {
-      auto catalog = open_scenario.child("Catalog");
-      if (catalog) {
-        auto name = catalog.attribute("name");
-        if (name) {
-          emplace(name.as_string(), catalog);
-        }
+    const auto last_write_time = boost::filesystem::last_write_time(path);
+
+    const auto file_size = boost::filesystem::file_size(path);
+
+    auto && [iter, inserted] = catalogFiles().emplace(path.string(), CatalogFile());
+
+    if (auto & catalog_file = iter->second; inserted or
+                                            catalog_file.last_write_time != last_write_time or
+                                            catalog_file.file_size != file_size) {
+      catalog_file.last_write_time = last_write_time;
+      catalog_file.file_size = file_size;
+      if (path.extension() == ".yaml") {
+        // NOTE: YAML has no cheaper way to find the name than to read the whole file.
+        catalog_file.document = loadDocument(path);
+        catalog_file.catalog_name = catalog_file.document->child("OpenSCENARIO")
+                                      .child("Catalog")
+                                      .attribute("name")
+                                      .as_string();
+      } else {
+        catalog_file.document = nullptr;
+        catalog_file.catalog_name = readCatalogName(path);
       }
     }
+
+    if (not iter->second.catalog_name.empty()) {
+      emplace(iter->second.catalog_name, path);
+    }
   }
 }
+
+auto CatalogLocation::load(const boost::filesystem::path & path) -> pugi::xml_node
+{
+  auto & catalog_file = catalogFiles().at(path.string());
+
+  if (not catalog_file.document) {
+    catalog_file.document = loadDocument(path);
+  }
+
+  return catalog_file.document->child("OpenSCENARIO").child("Catalog");
+}
 }  // namespace syntax
 }  // namespace openscenario_interpreter
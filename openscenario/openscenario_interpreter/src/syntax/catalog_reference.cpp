@@ -123,7 +123,7 @@ auto CatalogReference::make(const pugi::xml_node & node, Scope & outer_scope) ->
         };
 
         return choice_by_attribute(
-          found_catalog->second, "name",
+          CatalogLocation::load(found_catalog->second), "name",
           std::make_pair(entry_name, [&](const pugi::xml_node & node) {
             auto iter = dispatcher.find(node.name());
             if (iter != std::end(dispatcher)) {
@@ -16,6 +16,7 @@
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/collision_condition.hpp>
 #include <openscenario_interpreter/syntax/entity_ref.hpp>
+#include <openscenario_interpreter/syntax/scenario_object.hpp>
 
 namespace openscenario_interpreter
 {
@@ -29,7 +30,8 @@ CollisionCondition::CollisionCondition(
     choice(node,
       std::make_pair("EntityRef", [&](auto && node) { return make<EntityRef>(node, scope); }),
       std::make_pair("ByType",    [&](auto && node) { throw UNSUPPORTED_ELEMENT_SPECIFIED(node.name()); return unspecified; }))),
-  triggering_entities(triggering_entities)
+  triggering_entities(triggering_entities),
+  another_given_scenario_object(another_given_entity.is<EntityRef>() ? global().entityRef(another_given_entity.as<EntityRef>()) : unspecified)
 // clang-format on
 {
 }
@@ -51,7 +53,7 @@ auto CollisionCondition::evaluate() const -> Object
 {
   if (
     another_given_entity.is<EntityRef>() and
-    global().isAddedEntity(another_given_entity.as<EntityRef>())) {
+    another_given_scenario_object.as<ScenarioObject>().is_added) {
     return asBoolean(triggering_entities.apply([&](auto && triggering_entity) {
       return evaluateCollisionCondition(triggering_entity, another_given_entity.as<EntityRef>());
     }));
@@ -12,11 +12,16 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/dirty_elements.hpp>
 #include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/by_entity_condition.hpp>
 #include <openscenario_interpreter/syntax/by_value_condition.hpp>
 #include <openscenario_interpreter/syntax/condition.hpp>
+#include <openscenario_interpreter/syntax/parameter_condition.hpp>
+#include <openscenario_interpreter/syntax/simulation_time_condition.hpp>
+#include <openscenario_interpreter/syntax/stand_still_condition.hpp>
+#include <openscenario_interpreter/syntax/storyboard_element_state_condition.hpp>
 #include <openscenario_interpreter/utility/demangle.hpp>
 
 namespace openscenario_interpreter
@@ -27,6 +32,34 @@ static_assert(std::is_standard_layout<ConditionEdge>::value, "");
 
 static_assert(std::is_trivial<ConditionEdge>::value, "");
 
+static auto dependencyOf(const Object & condition) -> Dependency
+{
+  if (condition.is<ByValueCondition>()) {
+    if (const auto & by_value_condition = condition.as<ByValueCondition>();
+        by_value_condition.is<ParameterCondition>()) {
+      return Dependency::parameter;
+    } else if (by_value_condition.is<StoryboardElementStateCondition>()) {
+      return Dependency::storyboard_element_state;
+    } else if (by_value_condition.is<SimulationTimeCondition>()) {
+      return Dependency::simulation_time;
+    }
+  } else if (condition.is<ByEntityCondition>()) {
+    if (not condition.as<ByEntityCondition>().is<StandStillCondition>()) {
+      return Dependency::entity_kinematics;
+    }
+  }
+  return Dependency::untracked;
+}
+
+static auto thresholdOf(const Object & condition) -> Double
+{
+  if (dependencyOf(condition) == Dependency::simulation_time) {
+    return condition.as<ByValueCondition>().as<SimulationTimeCondition>().value;
+  } else {
+    return Double();
+  }
+}
+
 Condition::Condition(const pugi::xml_node & node, Scope & scope)
 // clang-format off
 : ComplexType(
@@ -36,7 +69,9 @@ Condition::Condition(const pugi::xml_node & node, Scope & scope)
   name(readAttribute<String>("name", node, scope)),
   delay(readAttribute<Double>("delay", node, scope, Double())),
   condition_edge(readAttribute<ConditionEdge>("conditionEdge", node, scope)),
-  current_value(false)
+  current_value(false),
+  dependency(dependencyOf(*this)),
+  threshold(thresholdOf(*this))
 // clang-format on
 {
 }
@@ -45,7 +80,14 @@ auto Condition::evaluate() -> Object
 {
   if (condition_edge == ConditionEdge::sticky and current_value) {
     return true_v;
+  } else if (const auto current_revision = dependency == Dependency::simulation_time
+                                             ? revisions.of(threshold)
+                                             : revisions.of(dependency);
+             current_revision and current_revision == revision) {
+    return asBoolean(current_value);
   } else {
+    revision = current_revision;
+    dirty_elements.mark(this);
     return asBoolean(current_value = Object::evaluate().as<Boolean>());
   }
 }
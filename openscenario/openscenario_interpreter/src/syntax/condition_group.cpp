@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/dirty_elements.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/condition_group.hpp>
+#include <utility>
 
 namespace openscenario_interpreter
 {
@@ -27,12 +29,15 @@ ConditionGroup::ConditionGroup(const pugi::xml_node & node, Scope & scope) : cur
 auto ConditionGroup::evaluate() -> Object
 {
   // NOTE: Don't use std::all_of; Intentionally does not short-circuit evaluation.
-  return asBoolean(
-    current_value = std::accumulate(
-      std::begin(*this), std::end(*this), true, [&](auto && lhs, Condition & condition) {
-        const auto rhs = condition.evaluate();
-        return lhs and rhs.as<Boolean>();
-      }));
+  const auto value = std::accumulate(
+    std::begin(*this), std::end(*this), true, [&](auto && lhs, Condition & condition) {
+      const auto rhs = condition.evaluate();
+      return lhs and rhs.as<Boolean>();
+    });
+  if (std::exchange(current_value, value) != value) {
+    dirty_elements.mark(this);
+  }
+  return asBoolean(value);
 }
 
 auto operator<<(nlohmann::json & json, const ConditionGroup & datum) -> nlohmann::json &
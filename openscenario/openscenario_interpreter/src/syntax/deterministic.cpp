@@ -0,0 +1,47 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <openscenario_interpreter/syntax/deterministic.hpp>
+#include <openscenario_interpreter/syntax/deterministic_multi_parameter_distribution.hpp>
+#include <openscenario_interpreter/syntax/deterministic_single_parameter_distribution.hpp>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+Deterministic::Deterministic(const pugi::xml_node & node, Scope & scope)
+: std::vector<ParameterValueSet>(1)
+{
+  auto multiply = [this](const std::vector<ParameterValueSet> & distribution) {
+    std::vector<ParameterValueSet> product;
+    product.reserve(this->size() * distribution.size());
+    for (const auto & lhs : *this) {
+      for (const auto & rhs : distribution) {
+        product.push_back(lhs);
+        product.back().insert(std::end(product.back()), std::begin(rhs), std::end(rhs));
+      }
+    }
+    this->swap(product);
+  };
+
+  for (const auto & each : node.children()) {
+    if (each.name() == std::string("DeterministicMultiParameterDistribution")) {
+      multiply(DeterministicMultiParameterDistribution(each, scope));
+    } else if (each.name() == std::string("DeterministicSingleParameterDistribution")) {
+      multiply(DeterministicSingleParameterDistribution(each, scope));
+    }
+  }
+}
+}  // namespace syntax
+}  // namespace openscenario_interpreter
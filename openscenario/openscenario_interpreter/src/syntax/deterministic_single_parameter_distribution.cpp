@@ -0,0 +1,84 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <boost/lexical_cast.hpp>
+#include <cmath>
+#include <openscenario_interpreter/reader/attribute.hpp>
+#include <openscenario_interpreter/reader/element.hpp>
+#include <openscenario_interpreter/syntax/deterministic_single_parameter_distribution.hpp>
+#include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/range.hpp>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+DeterministicSingleParameterDistribution::DeterministicSingleParameterDistribution(
+  const pugi::xml_node & node, Scope & scope)
+: parameter_name(readAttribute<String>("parameterName", node, scope))
+{
+  auto assign = [this](const String & value) {
+    ParameterValueSet parameter_value_set;
+    parameter_value_set.emplace_back(parameter_name, value);
+    push_back(parameter_value_set);
+  };
+
+  if (const auto distribution_set = node.child("DistributionSet")) {
+    /* ---- DistributionSet ----------------------------------------------------
+     *
+     *  <xsd:complexType name="DistributionSet">
+     *    <xsd:sequence>
+     *      <xsd:element name="Element" type="DistributionSetElement" maxOccurs="unbounded"/>
+     *    </xsd:sequence>
+     *  </xsd:complexType>
+     *
+     * ---------------------------------------------------------------------- */
+    traverse<1, unbounded>(distribution_set, "Element", [&](auto && node) {
+      assign(readAttribute<String>("value", node, scope));
+    });
+  } else if (const auto distribution_range = node.child("DistributionRange")) {
+    /* ---- DistributionRange --------------------------------------------------
+     *
+     *  <xsd:complexType name="DistributionRange">
+     *    <xsd:all>
+     *      <xsd:element name="Range" type="Range"/>
+     *    </xsd:all>
+     *    <xsd:attribute name="stepWidth" type="Double" use="required"/>
+     *  </xsd:complexType>
+     *
+     * ---------------------------------------------------------------------- */
+    const auto step_width = readAttribute<Double>("stepWidth", distribution_range, scope);
+
+    const auto range = readElement<Range>("Range", distribution_range, scope);
+
+    if (not(0 < step_width)) {
+      THROW_SYNTAX_ERROR("DistributionRange requires positive stepWidth, but ", step_width);
+    }
+
+    // NOTE: The tolerance keeps upperLimit when it is a multiple of stepWidth.
+    const auto size = std::floor((range.upper_limit - range.lower_limit) / step_width + 1e-9) + 1;
+
+    for (auto i = 0.0; i < size; ++i) {
+      assign(boost::lexical_cast<String>(range.lower_limit + i * step_width));
+    }
+  } else if (const auto user_defined_distribution = node.child("UserDefinedDistribution")) {
+    throw UNSUPPORTED_ELEMENT_SPECIFIED(user_defined_distribution.name());
+  } else {
+    THROW_SYNTAX_ERROR(
+      "DeterministicSingleParameterDistribution requires one of DistributionSet, "
+      "DistributionRange or UserDefinedDistribution");
+  }
+}
+}  // namespace syntax
+}  // namespace openscenario_interpreter
@@ -174,28 +174,16 @@ auto DistanceCondition::distance<  //
   return apply<double>(
     overload(
       [&](const WorldPosition & position) {
-        if (global().entityRef(triggering_entity).as<ScenarioObject>().is_added) {
-          return getLongitudinalDistance(
-            triggering_entity, static_cast<traffic_simulator_msgs::msg::LaneletPose>(position));
-        } else {
-          return std::numeric_limits<double>::quiet_NaN();
-        }
+        return getLongitudinalDistance(
+          triggering_entity, static_cast<traffic_simulator_msgs::msg::LaneletPose>(position));
       },
       [&](const RelativeWorldPosition & position) {
-        if (global().entityRef(triggering_entity).as<ScenarioObject>().is_added) {
-          return getLongitudinalDistance(
-            triggering_entity, static_cast<traffic_simulator_msgs::msg::LaneletPose>(position));
-        } else {
-          return std::numeric_limits<double>::quiet_NaN();
-        }
+        return getLongitudinalDistance(
+          triggering_entity, static_cast<traffic_simulator_msgs::msg::LaneletPose>(position));
       },
       [&](const LanePosition & position) {
-        if (global().entityRef(triggering_entity).as<ScenarioObject>().is_added) {
-          return getLongitudinalDistance(
-            triggering_entity, static_cast<traffic_simulator_msgs::msg::LaneletPose>(position));
-        } else {
-          return std::numeric_limits<double>::quiet_NaN();
-        }
+        return getLongitudinalDistance(
+          triggering_entity, static_cast<traffic_simulator_msgs::msg::LaneletPose>(position));
       }),
     position);
 }
@@ -204,10 +192,15 @@ auto DistanceCondition::evaluate() -> Object
 {
   results.clear();
 
-  return asBoolean(triggering_entities.apply([&](auto && triggering_entity) {
-    results.push_back(distance(triggering_entity));
-    return rule(results.back(), value);
-  }));
+  return asBoolean(triggering_entities.applyWithEntity(
+    [&](const auto & triggering_entity, const auto & triggering_object) {
+      if (triggering_object.template as<ScenarioObject>().is_added) {
+        results.push_back(distance(triggering_entity));
+      } else {
+        results.push_back(Double::nan());
+      }
+      return rule(results.back(), value);
+    }));
 }
 }  // namespace syntax
 }  // namespace openscenario_interpreter
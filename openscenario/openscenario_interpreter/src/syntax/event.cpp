@@ -37,7 +37,7 @@ auto Event::start() -> void
   for (auto && element : elements) {
     assert(element.template is<Action>());
     assert(element.template is_also<StoryboardElement>());
-    element.template as<StoryboardElement>().current_state = start_transition;
+    element.template as<StoryboardElement>().transitionTo(start_transition);
   }
 }
 
@@ -40,7 +40,7 @@ auto ManeuverGroup::start() -> void
   for (auto && element : elements) {
     assert(element.template is<Maneuver>());
     assert(element.template is_also<StoryboardElement>());
-    element.template as<StoryboardElement>().current_state = start_transition;
+    element.template as<StoryboardElement>().transitionTo(start_transition);
   }
 }
 
@@ -30,6 +30,15 @@ OpenScenario::OpenScenario(const boost::filesystem::path & pathname)
 {
 }
 
+OpenScenario::OpenScenario(
+  const pugi::xml_document & document, const boost::filesystem::path & pathname)
+: Scope(pathname),
+  file_header(readElement<FileHeader>("FileHeader", load(document).child("OpenSCENARIO"), local())),
+  category(readElement<OpenScenarioCategory>("OpenSCENARIO", script, local())),
+  frame(0)
+{
+}
+
 auto OpenScenario::evaluate() -> Object
 {
   ++frame;
@@ -47,10 +56,14 @@ auto OpenScenario::load(const boost::filesystem::path & filepath) -> const pugi:
   }
 }
 
-auto operator<<(nlohmann::json & json, const OpenScenario & datum) -> nlohmann::json &
+auto OpenScenario::load(const pugi::xml_document & document) -> const pugi::xml_node &
 {
-  json["version"] = "1.0";
+  script.reset(document);
+  return script;
+}
 
+auto serializeFrame(nlohmann::json & json, const OpenScenario & datum) -> nlohmann::json &
+{
   json["frame"] = datum.frame;
 
   // clang-format off
@@ -61,6 +74,15 @@ auto operator<<(nlohmann::json & json, const OpenScenario & datum) -> nlohmann::
   json["CurrentStates"]["stopTransition"]  = openscenario_interpreter::stop_transition .use_count() - 1;
   // clang-format on
 
+  return json;
+}
+
+auto operator<<(nlohmann::json & json, const OpenScenario & datum) -> nlohmann::json &
+{
+  json["version"] = "1.0";
+
+  serializeFrame(json, datum);
+
   if (datum.category.is<ScenarioDefinition>()) {
     json["OpenSCENARIO"] << datum.category.as<ScenarioDefinition>();
   }
@@ -28,7 +28,8 @@ ParameterCondition::ParameterCondition(const pugi::xml_node & node, Scope & scop
 : Scope(scope),
   parameter_ref(readAttribute<String>("parameterRef", node, local())),
   value(readAttribute<String>("value", node, local())),
-  rule(readAttribute<Rule>("rule", node, local()))
+  rule(readAttribute<Rule>("rule", node, local())),
+  parameter(local(), parameter_ref)
 {
 }
 
@@ -63,7 +64,7 @@ auto ParameterCondition::description() const -> String
   std::stringstream description;
 
   description << "The value of parameter " << std::quoted(parameter_ref) << " = "
-              << local().ref(parameter_ref) << " " << rule << " " << value << "?";
+              << parameter.bind() << " " << rule << " " << value << "?";
 
   return description.str();
 }
@@ -71,11 +72,10 @@ auto ParameterCondition::description() const -> String
 auto ParameterCondition::evaluate() const -> Object
 {
   try {
-    const auto parameter = local().ref(parameter_ref);
-    if (not parameter) {
+    if (const auto & bound = parameter.bind(); not bound) {
       THROW_SYNTAX_ERROR(parameter_ref, " cannot be found from this scope");
     } else {
-      return asBoolean(compare(parameter, rule, value));
+      return asBoolean(compare(bound, rule, value));
     }
   } catch (const std::out_of_range &) {
     throw SemanticError("No such parameter ", std::quoted(parameter_ref));
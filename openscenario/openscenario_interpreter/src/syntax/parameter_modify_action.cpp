@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <openscenario_interpreter/reader/element.hpp>
+#include <openscenario_interpreter/revisions.hpp>
 #include <openscenario_interpreter/syntax/parameter_add_value_rule.hpp>
 #include <openscenario_interpreter/syntax/parameter_modify_action.hpp>
 #include <openscenario_interpreter/syntax/parameter_multiply_by_value_rule.hpp>
@@ -23,7 +24,10 @@ inline namespace syntax
 {
 ParameterModifyAction::ParameterModifyAction(
   const pugi::xml_node & node, Scope & scope, const String & parameter_ref)
-: Scope(scope), parameter_ref(parameter_ref), rule(readElement<ModifyRule>("Rule", node, local()))
+: Scope(scope),
+  parameter_ref(parameter_ref),
+  rule(readElement<ModifyRule>("Rule", node, local())),
+  parameter(local(), parameter_ref)
 {
 }
 
@@ -34,12 +38,13 @@ auto ParameterModifyAction::run() noexcept -> void {}
 auto ParameterModifyAction::start() const -> void
 {
   try {
-    const auto target = local().ref(parameter_ref);
+    const auto & target = parameter.bind();
     if (rule.is<ParameterAddValueRule>()) {
       rule.as<ParameterAddValueRule>()(target);
     } else {
       rule.as<ParameterMultiplyByValueRule>()(target);
     }
+    revisions.touch(Dependency::parameter);
   } catch (const std::out_of_range &) {
     throw SemanticError("No such parameter ", std::quoted(parameter_ref));
   }
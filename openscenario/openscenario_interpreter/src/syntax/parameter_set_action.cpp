@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <openscenario_interpreter/reader/attribute.hpp>
+#include <openscenario_interpreter/revisions.hpp>
 #include <openscenario_interpreter/syntax/parameter_set_action.hpp>
 #include <typeindex>
 #include <unordered_map>
@@ -23,7 +24,10 @@ inline namespace syntax
 {
 ParameterSetAction::ParameterSetAction(
   const pugi::xml_node & node, Scope & scope, const String & parameter_ref)
-: Scope(scope), parameter_ref(parameter_ref), value(readAttribute<String>("value", node, local()))
+: Scope(scope),
+  parameter_ref(parameter_ref),
+  value(readAttribute<String>("value", node, local())),
+  parameter(local(), parameter_ref)
 {
 }
 
@@ -36,6 +40,11 @@ auto ParameterSetAction::run() noexcept -> void {}
 
 auto ParameterSetAction::set(
   const Scope & scope, const String & parameter_ref, const String & value) -> void
+{
+  set(scope.ref(parameter_ref), value);
+}
+
+auto ParameterSetAction::set(const Object & parameter, const String & value) -> void
 {
   static const std::unordered_map<
     std::type_index, std::function<void(const Object &, const String &)>>
@@ -50,14 +59,14 @@ auto ParameterSetAction::set(
       // clang-format on
     };
 
-  const auto parameter = scope.ref(parameter_ref);
-
   overloads.at(parameter.type())(parameter, value);
+
+  revisions.touch(Dependency::parameter);
 }
 
 auto ParameterSetAction::start() const -> void  //
 {
-  set(local(), parameter_ref, value);
+  set(parameter.bind(), value);
 }
 }  // namespace syntax
 }  // namespace openscenario_interpreter
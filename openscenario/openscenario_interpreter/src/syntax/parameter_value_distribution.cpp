@@ -0,0 +1,92 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <iomanip>
+#include <openscenario_interpreter/reader/element.hpp>
+#include <openscenario_interpreter/syntax/deterministic.hpp>
+#include <openscenario_interpreter/syntax/openscenario.hpp>
+#include <openscenario_interpreter/syntax/parameter_value_distribution.hpp>
+#include <openscenario_interpreter/syntax/stochastic.hpp>
+#include <openscenario_interpreter/utility/yaml.hpp>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+static auto readScenarioFile(const pugi::xml_node & node, Scope & scope) -> File
+{
+  const auto scenario_file = readElement<File>("ScenarioFile", node, scope);
+
+  if (scenario_file.filepath.is_relative()) {
+    return File((scope.global().pathname.parent_path() / scenario_file.filepath).string());
+  } else {
+    return scenario_file;
+  }
+}
+
+static auto readDistributionDefinition(const pugi::xml_node & node, Scope & scope)
+  -> std::vector<ParameterValueSet>
+{
+  if (const auto deterministic = node.child("Deterministic")) {
+    return Deterministic(deterministic, scope);
+  } else if (const auto stochastic = node.child("Stochastic")) {
+    return Stochastic(stochastic, scope);
+  } else {
+    THROW_SYNTAX_ERROR("ParameterValueDistribution requires one of Deterministic or Stochastic");
+  }
+}
+
+ParameterValueDistribution::ParameterValueDistribution(const pugi::xml_node & node, Scope & scope)
+: scenario_file(readScenarioFile(node, scope)),
+  parameter_value_sets(readDistributionDefinition(node, scope))
+{
+  if (scenario_file.filepath.extension() == ".yaml") {
+    loadYAML(scenario_file, scenario);
+  } else if (const auto result = scenario.load_file(scenario_file.filepath.string().c_str());
+             not result) {
+    throw SyntaxError(result.description(), ": ", scenario_file.filepath);
+  }
+
+  if (not scenario.child("OpenSCENARIO").child("Storyboard")) {
+    THROW_SYNTAX_ERROR(
+      "ScenarioFile of ParameterValueDistribution must be a ScenarioDefinition, but ",
+      scenario_file.filepath, " is not");
+  }
+}
+
+auto ParameterValueDistribution::instantiate(const ParameterValueSet & parameter_value_set) const
+  -> std::shared_ptr<OpenScenario>
+{
+  pugi::xml_document variant;
+
+  variant.reset(scenario);
+
+  const auto parameter_declarations =
+    variant.child("OpenSCENARIO").child("ParameterDeclarations");
+
+  for (const auto & [parameter_ref, value] : parameter_value_set) {
+    if (auto parameter_declaration = parameter_declarations.find_child_by_attribute(
+          "ParameterDeclaration", "name", parameter_ref.c_str())) {
+      parameter_declaration.attribute("value").set_value(value.c_str());
+    } else {
+      THROW_SEMANTIC_ERROR(
+        "No parameter ", std::quoted(parameter_ref), " is declared in the ParameterDeclarations "
+        "of ", scenario_file.filepath);
+    }
+  }
+
+  return std::make_shared<OpenScenario>(variant, scenario_file);
+}
+}  // namespace syntax
+}  // namespace openscenario_interpreter
@@ -0,0 +1,38 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <openscenario_interpreter/reader/attribute.hpp>
+#include <openscenario_interpreter/syntax/range.hpp>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+Range::Range(const pugi::xml_node & node, Scope & scope)
+: lower_limit(readAttribute<Double>("lowerLimit", node, scope)),
+  upper_limit(readAttribute<Double>("upperLimit", node, scope))
+{
+  if (upper_limit < lower_limit) {
+    THROW_SYNTAX_ERROR(
+      "Range whose upperLimit (", upper_limit, ") is less than lowerLimit (", lower_limit,
+      ") was specified");
+  }
+}
+
+auto Range::contains(double value) const noexcept -> bool
+{
+  return lower_limit <= value and value <= upper_limit;
+}
+}  // namespace syntax
+}  // namespace openscenario_interpreter
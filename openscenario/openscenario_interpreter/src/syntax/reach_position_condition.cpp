@@ -16,6 +16,7 @@
 #include <openscenario_interpreter/reader/attribute.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/reach_position_condition.hpp>
+#include <openscenario_interpreter/syntax/scenario_object.hpp>
 #include <openscenario_interpreter/utility/overload.hpp>
 #include <openscenario_interpreter/utility/print.hpp>
 #include <traffic_simulator/helper/helper.hpp>
@@ -69,10 +70,15 @@ auto ReachPositionCondition::evaluate() -> Object
 
   results.clear();
 
-  return asBoolean(triggering_entities.apply([&](const auto & triggering_entity) {
-    results.push_back(apply<Double>(distance, position, triggering_entity));
-    return compare(results.back(), tolerance);
-  }));
+  return asBoolean(triggering_entities.applyWithEntity(
+    [&](const auto & triggering_entity, const auto & triggering_object) {
+      if (triggering_object.template as<ScenarioObject>().is_added) {
+        results.push_back(apply<Double>(distance, position, triggering_entity));
+      } else {
+        results.push_back(Double::nan());
+      }
+      return compare(results.back(), tolerance);
+    }));
 }
 }  // namespace syntax
 }  // namespace openscenario_interpreter
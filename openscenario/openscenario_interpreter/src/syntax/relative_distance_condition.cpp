@@ -33,6 +33,7 @@ RelativeDistanceCondition::RelativeDistanceCondition(
   rule(readAttribute<Rule>("rule", node, scope)),
   value(readAttribute<Double>("value", node, scope)),
   triggering_entities(triggering_entities),
+  entity(global().entityRef(entity_ref)),
   results(triggering_entities.entity_refs.size(), Double::nan())
 {
 }
@@ -56,13 +57,7 @@ auto RelativeDistanceCondition::distance<
   CoordinateSystem::entity, RelativeDistanceType::longitudinal, false>(
   const EntityRef & triggering_entity) -> double
 {
-  if (
-    global().entities.at(triggering_entity).as<ScenarioObject>().is_added and
-    global().entities.at(entity_ref).as<ScenarioObject>().is_added) {
-    return std::abs(getRelativePose(triggering_entity, entity_ref).position.x);
-  } else {
-    return Double::nan();
-  }
+  return std::abs(getRelativePose(triggering_entity, entity_ref).position.x);
 }
 
 template <>
@@ -70,13 +65,7 @@ auto RelativeDistanceCondition::distance<
   CoordinateSystem::entity, RelativeDistanceType::lateral, false>(
   const EntityRef & triggering_entity) -> double
 {
-  if (
-    global().entities.at(triggering_entity).as<ScenarioObject>().is_added and
-    global().entities.at(entity_ref).as<ScenarioObject>().is_added) {
-    return std::abs(getRelativePose(triggering_entity, entity_ref).position.y);
-  } else {
-    return Double::nan();
-  }
+  return std::abs(getRelativePose(triggering_entity, entity_ref).position.y);
 }
 
 template <>
@@ -84,13 +73,7 @@ auto RelativeDistanceCondition::distance<
   CoordinateSystem::entity, RelativeDistanceType::euclidianDistance, true>(
   const EntityRef & triggering_entity) -> double
 {
-  if (
-    global().entities.at(triggering_entity).as<ScenarioObject>().is_added and
-    global().entities.at(entity_ref).as<ScenarioObject>().is_added) {
-    return getBoundingBoxDistance(triggering_entity, entity_ref);
-  } else {
-    return Double::nan();
-  }
+  return getBoundingBoxDistance(triggering_entity, entity_ref);
 }
 
 template <>
@@ -98,15 +81,8 @@ auto RelativeDistanceCondition::distance<
   CoordinateSystem::entity, RelativeDistanceType::euclidianDistance, false>(
   const EntityRef & triggering_entity) -> double
 {
-  if (
-    global().entities.at(triggering_entity).as<ScenarioObject>().is_added and
-    global().entities.at(entity_ref).as<ScenarioObject>().is_added) {
-    return std::hypot(
-      getRelativePose(triggering_entity, entity_ref).position.x,
-      getRelativePose(triggering_entity, entity_ref).position.y);
-  } else {
-    return Double::nan();
-  }
+  const auto relative_pose = getRelativePose(triggering_entity, entity_ref);
+  return std::hypot(relative_pose.position.x, relative_pose.position.y);
 }
 
 template <>
@@ -114,13 +90,7 @@ auto RelativeDistanceCondition::distance<
   CoordinateSystem::lane, RelativeDistanceType::longitudinal, false>(
   const EntityRef & triggering_entity) -> double
 {
-  if (
-    global().entities.at(triggering_entity).as<ScenarioObject>().is_added and
-    global().entities.at(entity_ref).as<ScenarioObject>().is_added) {
-    return getLongitudinalDistance(triggering_entity, entity_ref);
-  } else {
-    return Double::nan();
-  }
+  return getLongitudinalDistance(triggering_entity, entity_ref);
 }
 
 #define DISTANCE(...) distance<__VA_ARGS__>(triggering_entity)
@@ -169,10 +139,17 @@ auto RelativeDistanceCondition::evaluate() -> Object
 {
   results.clear();
 
-  return asBoolean(triggering_entities.apply([&](const auto & triggering_entity) {
-    results.push_back(distance(triggering_entity));
-    return rule(results.back(), value);
-  }));
+  return asBoolean(triggering_entities.applyWithEntity(
+    [&](const auto & triggering_entity, const auto & triggering_object) {
+      if (
+        triggering_object.template as<ScenarioObject>().is_added and
+        entity.as<ScenarioObject>().is_added) {
+        results.push_back(distance(triggering_entity));
+      } else {
+        results.push_back(Double::nan());
+      }
+      return rule(results.back(), value);
+    }));
 }
 }  // namespace syntax
 }  // namespace openscenario_interpreter
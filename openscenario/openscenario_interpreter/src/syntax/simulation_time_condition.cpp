@@ -25,6 +25,7 @@ SimulationTimeCondition::SimulationTimeCondition(const pugi::xml_node & node, Sc
 : value(readAttribute<Double>("value", node, scope)),
   compare(readAttribute<Rule>("rule", node, scope))
 {
+  revisions.declare(value);
 }
 
 auto SimulationTimeCondition::description() const -> String
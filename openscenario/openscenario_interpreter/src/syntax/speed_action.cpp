@@ -46,21 +46,21 @@ auto SpeedAction::accomplished() -> bool
     if (speed_action_target.is<AbsoluteTargetSpeed>()) {
       return equal_to<double>()(
         speed_action_target.as<AbsoluteTargetSpeed>().value,
-        getEntityStatus(actor).action_status.twist.linear.x);
+        getEntityStatus(actor)->action_status.twist.linear.x);
     } else {
       switch (speed_action_target.as<RelativeTargetSpeed>().speed_target_value_type) {
         case SpeedTargetValueType::delta:
           return equal_to<double>()(
             getEntityStatus(speed_action_target.as<RelativeTargetSpeed>().entity_ref)
-                .action_status.twist.linear.x +
+                ->action_status.twist.linear.x +
               speed_action_target.as<RelativeTargetSpeed>().value,
-            getEntityStatus(actor).action_status.twist.linear.x);
+            getEntityStatus(actor)->action_status.twist.linear.x);
         case SpeedTargetValueType::factor:
           return equal_to<double>()(
             getEntityStatus(speed_action_target.as<RelativeTargetSpeed>().entity_ref)
-                .action_status.twist.linear.x *
+                ->action_status.twist.linear.x *
               speed_action_target.as<RelativeTargetSpeed>().value,
-            getEntityStatus(actor).action_status.twist.linear.x);
+            getEntityStatus(actor)->action_status.twist.linear.x);
         default:
           return false;
       }
@@ -0,0 +1,49 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <openscenario_interpreter/reader/attribute.hpp>
+#include <openscenario_interpreter/reader/element.hpp>
+#include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/stochastic.hpp>
+#include <openscenario_interpreter/syntax/stochastic_distribution.hpp>
+#include <openscenario_interpreter/syntax/unsigned_integer.hpp>
+#include <random>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+Stochastic::Stochastic(const pugi::xml_node & node, Scope & scope)
+{
+  const auto number_of_test_runs = readAttribute<UnsignedInteger>("numberOfTestRuns", node, scope);
+
+  auto engine = StochasticDistribution::Engine(
+    node.attribute("randomSeed")
+      ? static_cast<StochasticDistribution::Engine::result_type>(
+          readAttribute<Double>("randomSeed", node, scope))
+      : std::random_device()());
+
+  const auto distributions =
+    readElements<StochasticDistribution, 1>("StochasticDistribution", node, scope);
+
+  for (UnsignedInteger::value_type i = 0; i < number_of_test_runs; ++i) {
+    ParameterValueSet parameter_value_set;
+    for (const auto & distribution : distributions) {
+      parameter_value_set.emplace_back(distribution.parameter_name, distribution.sample(engine));
+    }
+    push_back(parameter_value_set);
+  }
+}
+}  // namespace syntax
+}  // namespace openscenario_interpreter
@@ -0,0 +1,174 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <boost/lexical_cast.hpp>
+#include <cmath>
+#include <cstdint>
+#include <openscenario_interpreter/reader/attribute.hpp>
+#include <openscenario_interpreter/reader/element.hpp>
+#include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/range.hpp>
+#include <openscenario_interpreter/syntax/stochastic_distribution.hpp>
+#include <vector>
+
+namespace openscenario_interpreter
+{
+inline namespace syntax
+{
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Draws from the given distribution until the value falls within the range,
+ *  which truncates the distribution to the range.
+ *
+ * -------------------------------------------------------------------------- */
+template <typename Distribution>
+static auto truncate(Distribution distribution, const Range & range)
+{
+  return [distribution, range](StochasticDistribution::Engine & engine) mutable {
+    for (auto attempts = 0; attempts < 10000; ++attempts) {
+      if (const double value = distribution(engine); range.contains(value)) {
+        return value;
+      }
+    }
+    THROW_SEMANTIC_ERROR(
+      "Failed to draw a value within [", range.lower_limit, ", ", range.upper_limit,
+      "] from the distribution");
+  };
+}
+
+static auto readDistribution(const pugi::xml_node & node, Scope & scope)
+  -> std::function<String(StochasticDistribution::Engine &)>
+{
+  auto format = [](auto && sample) {
+    return [sample](StochasticDistribution::Engine & engine) mutable {
+      return boost::lexical_cast<String>(sample(engine));
+    };
+  };
+
+  if (const auto probability_distribution_set = node.child("ProbabilityDistributionSet")) {
+    /* ---- ProbabilityDistributionSet -----------------------------------------
+     *
+     *  <xsd:complexType name="ProbabilityDistributionSet">
+     *    <xsd:sequence>
+     *      <xsd:element name="Element" type="ProbabilityDistributionSetElement" maxOccurs="unbounded"/>
+     *    </xsd:sequence>
+     *  </xsd:complexType>
+     *
+     * ---------------------------------------------------------------------- */
+    std::vector<String> values;
+    std::vector<double> weights;
+    traverse<1, unbounded>(probability_distribution_set, "Element", [&](auto && node) {
+      values.push_back(readAttribute<String>("value", node, scope));
+      weights.push_back(readAttribute<Double>("weight", node, scope));
+    });
+    return [values, distribution = std::discrete_distribution<std::size_t>(
+                      std::begin(weights), std::end(weights))](auto & engine) mutable {
+      return values[distribution(engine)];
+    };
+  } else if (const auto normal_distribution = node.child("NormalDistribution")) {
+    /* ---- NormalDistribution -------------------------------------------------
+     *
+     *  <xsd:complexType name="NormalDistribution">
+     *    <xsd:all>
+     *      <xsd:element name="Range" type="Range" minOccurs="0"/>
+     *    </xsd:all>
+     *    <xsd:attribute name="expectedValue" type="Double" use="required"/>
+     *    <xsd:attribute name="variance" type="Double" use="required"/>
+     *  </xsd:complexType>
+     *
+     * ---------------------------------------------------------------------- */
+    const auto distribution = std::normal_distribution<double>(
+      readAttribute<Double>("expectedValue", normal_distribution, scope),
+      std::sqrt(readAttribute<Double>("variance", normal_distribution, scope)));
+    if (normal_distribution.child("Range")) {
+      return format(truncate(distribution, Range(normal_distribution.child("Range"), scope)));
+    } else {
+      return format(distribution);
+    }
+  } else if (const auto uniform_distribution = node.child("UniformDistribution")) {
+    /* ---- UniformDistribution ------------------------------------------------
+     *
+     *  <xsd:complexType name="UniformDistribution">
+     *    <xsd:all>
+     *      <xsd:element name="Range" type="Range"/>
+     *    </xsd:all>
+     *  </xsd:complexType>
+     *
+     * ---------------------------------------------------------------------- */
+    const auto range = readElement<Range>("Range", uniform_distribution, scope);
+    return format(std::uniform_real_distribution<double>(range.lower_limit, range.upper_limit));
+  } else if (const auto poisson_distribution = node.child("PoissonDistribution")) {
+    /* ---- PoissonDistribution ------------------------------------------------
+     *
+     *  <xsd:complexType name="PoissonDistribution">
+     *    <xsd:all>
+     *      <xsd:element name="Range" type="Range" minOccurs="0"/>
+     *    </xsd:all>
+     *    <xsd:attribute name="expectedValue" type="Double" use="required"/>
+     *  </xsd:complexType>
+     *
+     * ---------------------------------------------------------------------- */
+    const auto distribution = std::poisson_distribution<std::uint64_t>(
+      readAttribute<Double>("expectedValue", poisson_distribution, scope));
+    if (poisson_distribution.child("Range")) {
+      return format(truncate(distribution, Range(poisson_distribution.child("Range"), scope)));
+    } else {
+      return format(distribution);
+    }
+  } else if (const auto histogram = node.child("Histogram")) {
+    /* ---- Histogram ----------------------------------------------------------
+     *
+     *  <xsd:complexType name="Histogram">
+     *    <xsd:sequence>
+     *      <xsd:element name="Bin" type="HistogramBin" maxOccurs="unbounded"/>
+     *    </xsd:sequence>
+     *  </xsd:complexType>
+     *
+     *  <xsd:complexType name="HistogramBin">
+     *    <xsd:all>
+     *      <xsd:element name="Range" type="Range"/>
+     *    </xsd:all>
+     *    <xsd:attribute name="weight" type="Double" use="required"/>
+     *  </xsd:complexType>
+     *
+     * ---------------------------------------------------------------------- */
+    std::vector<std::uniform_real_distribution<double>> bins;
+    std::vector<double> weights;
+    traverse<1, unbounded>(histogram, "Bin", [&](auto && node) {
+      const auto range = readElement<Range>("Range", node, scope);
+      bins.emplace_back(range.lower_limit, range.upper_limit);
+      weights.push_back(readAttribute<Double>("weight", node, scope));
+    });
+    return format([bins, distribution = std::discrete_distribution<std::size_t>(
+                           std::begin(weights), std::end(weights))](auto & engine) mutable {
+      return bins[distribution(engine)](engine);
+    });
+  } else if (const auto user_defined_distribution = node.child("UserDefinedDistribution")) {
+    THROW_SYNTAX_ERROR(
+      "Given class UserDefinedDistribution is valid OpenSCENARIO element of class "
+      "StochasticDistribution, but is not supported yet");
+  } else {
+    THROW_SYNTAX_ERROR(
+      "StochasticDistribution requires one of ProbabilityDistributionSet, NormalDistribution, "
+      "UniformDistribution, PoissonDistribution, Histogram or UserDefinedDistribution");
+  }
+}
+
+StochasticDistribution::StochasticDistribution(const pugi::xml_node & node, Scope & scope)
+: parameter_name(readAttribute<String>("parameterName", node, scope)),
+  sample(readDistribution(node, scope))
+{
+}
+}  // namespace syntax
+}  // namespace openscenario_interpreter
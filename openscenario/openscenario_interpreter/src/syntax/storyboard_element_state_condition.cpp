@@ -27,7 +27,8 @@ StoryboardElementStateCondition::StoryboardElementStateCondition(
   storyboard_element_type(
     readAttribute<StoryboardElementType>("storyboardElementType", node, local())),
   state(readAttribute<StoryboardElementState>("state", node, local())),
-  result(StoryboardElementState::standbyState)
+  result(StoryboardElementState::standbyState),
+  storyboard_element(local(), storyboard_element_ref)
 {
 }
 
@@ -44,10 +45,8 @@ auto StoryboardElementStateCondition::description() const -> String
 auto StoryboardElementStateCondition::evaluate() -> Object
 {
   try {
-    result = local()
-               .ref<StoryboardElement>(storyboard_element_ref)
-               .state()
-               .template as<StoryboardElementState>();
+    result =
+      storyboard_element.as<StoryboardElement>().state().template as<StoryboardElementState>();
     return asBoolean(result == state);
   } catch (const std::out_of_range &) {
     return false_v;
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <openscenario_interpreter/procedure.hpp>
+#include <openscenario_interpreter/syntax/scenario_object.hpp>
 #include <openscenario_interpreter/syntax/time_headway_condition.hpp>
 #include <openscenario_interpreter/utility/print.hpp>
 
@@ -28,6 +29,7 @@ TimeHeadwayCondition::TimeHeadwayCondition(
   along_route(readAttribute<Boolean>("alongRoute", node, scope)),
   compare(readAttribute<Rule>("rule", node, scope)),
   triggering_entities(triggering_entities),
+  entity(scope.global().entityRef(entity_ref)),
   results(triggering_entities.entity_refs.size(), Double::nan())
 {
 }
@@ -50,10 +52,17 @@ auto TimeHeadwayCondition::evaluate() -> Object
 {
   results.clear();
 
-  return asBoolean(triggering_entities.apply([&](auto && triggering_entity) {
-    results.push_back(getTimeHeadway(triggering_entity, entity_ref));
-    return compare(results.back(), value);
-  }));
+  return asBoolean(triggering_entities.applyWithEntity(
+    [&](const auto & triggering_entity, const auto & triggering_object) {
+      if (
+        triggering_object.template as<ScenarioObject>().is_added and
+        entity.as<ScenarioObject>().is_added) {
+        results.push_back(getTimeHeadway(triggering_entity, entity_ref));
+      } else {
+        results.push_back(Double::nan());
+      }
+      return compare(results.back(), value);
+    }));
 }
 }  // namespace syntax
 }  // namespace openscenario_interpreter
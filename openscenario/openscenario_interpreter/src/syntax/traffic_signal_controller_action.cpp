@@ -24,7 +24,8 @@ TrafficSignalControllerAction::TrafficSignalControllerAction(
   const pugi::xml_node & node, const Scope & scope)
 : Scope(scope),
   traffic_signal_controller_ref(readAttribute<String>("trafficSignalControllerRef", node, local())),
-  phase(readAttribute<String>("phase", node, local()))
+  phase(readAttribute<String>("phase", node, local())),
+  traffic_signal_controller(local(), traffic_signal_controller_ref)
 {
 }
 
@@ -36,7 +37,7 @@ auto TrafficSignalControllerAction::run() noexcept -> void {}
 
 auto TrafficSignalControllerAction::start() -> void
 {
-  local().ref<TrafficSignalController>(traffic_signal_controller_ref).changePhaseTo(phase);
+  traffic_signal_controller.as<TrafficSignalController>().changePhaseTo(phase);
 }
 }  // namespace syntax
 }  // namespace openscenario_interpreter
@@ -23,7 +23,7 @@ TrafficSignalControllerCondition::TrafficSignalControllerCondition(
   const pugi::xml_node & tree, const Scope & scope)
 : phase(readAttribute<String>("phase", tree, scope)),
   traffic_signal_controller_ref(readAttribute<String>("trafficSignalControllerRef", tree, scope)),
-  scope(scope)
+  traffic_signal_controller(scope, traffic_signal_controller_ref)
 {
 }
 
@@ -42,7 +42,7 @@ auto TrafficSignalControllerCondition::description() const -> String
 
 auto TrafficSignalControllerCondition::evaluate() -> Object
 {
-  const auto & controller = scope.ref<TrafficSignalController>(traffic_signal_controller_ref);
+  const auto & controller = traffic_signal_controller.as<TrafficSignalController>();
   current_phase_name = controller.currentPhaseName();
   current_phase_since = controller.currentPhaseSince();
   return asBoolean(current_phase_name == phase);
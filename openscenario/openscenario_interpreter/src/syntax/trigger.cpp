@@ -12,8 +12,10 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <openscenario_interpreter/dirty_elements.hpp>
 #include <openscenario_interpreter/reader/element.hpp>
 #include <openscenario_interpreter/syntax/trigger.hpp>
+#include <utility>
 
 namespace openscenario_interpreter
 {
@@ -35,13 +37,15 @@ auto Trigger::evaluate() -> Object
    *
    * ---------------------------------------------------------------------- */
   // NOTE: Don't use std::any_of; Intentionally does not short-circuit evaluation.
-  return asBoolean(
-    current_value = std::accumulate(
-      std::begin(*this), std::end(*this), false,
-      [&](auto && lhs, ConditionGroup & condition_group) {
-        const auto rhs = condition_group.evaluate();
-        return lhs or rhs.as<Boolean>();
-      }));
+  const auto value = std::accumulate(
+    std::begin(*this), std::end(*this), false, [&](auto && lhs, ConditionGroup & condition_group) {
+      const auto rhs = condition_group.evaluate();
+      return lhs or rhs.as<Boolean>();
+    });
+  if (std::exchange(current_value, value) != value) {
+    dirty_elements.mark(this);
+  }
+  return asBoolean(value);
 }
 
 auto operator<<(nlohmann::json & json, const Trigger & datum) -> nlohmann::json &
@@ -24,7 +24,14 @@ inline namespace syntax
 TriggeringEntities::TriggeringEntities(const pugi::xml_node & node, Scope & scope)
 : triggering_entities_rule(
     readAttribute<TriggeringEntitiesRule>("triggeringEntitiesRule", node, scope)),
-  entity_refs(readElements<EntityRef, 1>("EntityRef", node, scope))
+  entity_refs(readElements<EntityRef, 1>("EntityRef", node, scope)),
+  entities([&]() {
+    std::list<Object> entities;
+    for (const auto & entity_ref : entity_refs) {
+      entities.push_back(scope.global().entityRef(entity_ref));
+    }
+    return entities;
+  }())
 {
 }
 
@@ -14,8 +14,8 @@
 
 #include <openscenario_interpreter/error.hpp>
 #include <openscenario_interpreter/procedure.hpp>
+#include <openscenario_interpreter/subscription_hub.hpp>
 #include <openscenario_interpreter/syntax/parameter_condition.hpp>
-#include <openscenario_interpreter/syntax/parameter_declaration.hpp>
 #include <openscenario_interpreter/syntax/user_defined_value_condition.hpp>
 #include <regex>
 
@@ -23,47 +23,6 @@ namespace openscenario_interpreter
 {
 inline namespace syntax
 {
-template <typename T>
-struct MagicSubscription : private rclcpp::Node, public T
-{
-  std::promise<void> promise;
-
-  std::thread thread;
-
-  std::exception_ptr thrown;
-
-  typename rclcpp::Subscription<T>::SharedPtr subscription;
-
-public:
-  explicit MagicSubscription(const std::string & node_name, const std::string & topic_name)
-  : rclcpp::Node(node_name),
-    thread(
-      [this](auto future) {
-        while (rclcpp::ok() and
-               future.wait_for(std::chrono::milliseconds(1)) == std::future_status::timeout) {
-          try {
-            rclcpp::spin_some(get_node_base_interface());
-          } catch (...) {
-            thrown = std::current_exception();
-          }
-        }
-      },
-      std::move(promise.get_future())),
-    subscription(create_subscription<T>(topic_name, 1, [this](const typename T::SharedPtr message) {
-      static_cast<T &>(*this) = *message;
-    }))
-  {
-  }
-
-  ~MagicSubscription()
-  {
-    if (thread.joinable()) {
-      promise.set_value();
-      thread.join();
-    }
-  }
-};
-
 UserDefinedValueCondition::UserDefinedValueCondition(const pugi::xml_node & node, Scope & scope)
 : name(readAttribute<String>("name", node, scope)),
   value(readAttribute<String>("value", node, scope)),
@@ -81,17 +40,9 @@ UserDefinedValueCondition::UserDefinedValueCondition(const pugi::xml_node & node
     };
     evaluateValue = dispatch.at(result.str(2));  // XXX catch
   } else if (std::regex_match(name, result, std::regex(R"(^(?:\/[\w-]+)*\/([\w]+)$)"))) {
-    evaluateValue =
-      [&, result,
-       current_message =
-         std::make_shared<MagicSubscription<openscenario_msgs::msg::ParameterDeclaration>>(
-           result.str(1) + "_subscription", result.str(0))]() {
-        if (not current_message->value.empty()) {
-          return ParameterDeclaration(*current_message).evaluate();
-        } else {
-          return unspecified;
-        }
-      };
+    evaluateValue = [latest = subscription_hub.subscribe(result.str(0))]() {
+      return latest->get();
+    };
   } else {
     throw SyntaxError(__FILE__, ":", __LINE__);
   }
@@ -0,0 +1,249 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <openscenario_interpreter/error.hpp>
+#include <openscenario_interpreter/utility/yaml.hpp>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace openscenario_interpreter
+{
+inline namespace utility
+{
+// NOTE: conversion.py replaces True and False with true and false anywhere in the document.
+static auto lowercaseBooleans(std::string value) -> std::string
+{
+  for (const auto & [from, to] :
+       {std::make_pair("True", "true"), std::make_pair("False", "false")}) {
+    for (auto i = value.find(from); i != std::string::npos; i = value.find(from, i)) {
+      value.replace(i, std::string(from).size(), to);
+    }
+  }
+  return value;
+}
+
+// NOTE: Python's repr of a float, the shortest digits that read back as the same value.
+static auto reprFloat(double value) -> std::string
+{
+  if (std::isnan(value)) {
+    return "nan";
+  } else if (std::isinf(value)) {
+    return value < 0 ? "-inf" : "inf";
+  }
+
+  char buffer[32];
+  for (int precision = 0; precision < 17; ++precision) {
+    std::snprintf(buffer, sizeof(buffer), "%.*e", precision, value);
+    if (std::strtod(buffer, nullptr) == value) {
+      break;
+    }
+  }
+
+  const std::string scientific = buffer;
+  const auto e = scientific.find('e');
+  const auto exponent = std::stoi(scientific.substr(e + 1));
+  if (exponent < -4 or 16 <= exponent) {
+    return scientific;
+  }
+
+  const auto sign = std::signbit(value) ? std::string("-") : std::string();
+  auto digits = scientific.substr(sign.size(), e - sign.size());
+  if (const auto point = digits.find('.'); point != std::string::npos) {
+    digits.erase(point, 1);
+  }
+  if (exponent < 0) {
+    return sign + "0." + std::string(-exponent - 1, '0') + digits;
+  } else if (digits.size() <= static_cast<std::size_t>(exponent) + 1) {
+    return sign + digits + std::string(exponent + 1 - digits.size(), '0') + ".0";
+  } else {
+    return sign + digits.substr(0, exponent + 1) + "." + digits.substr(exponent + 1);
+  }
+}
+
+static auto withoutUnderscores(std::string value) -> std::string
+{
+  value.erase(std::remove(std::begin(value), std::end(value), '_'), std::end(value));
+  return value;
+}
+
+static auto reprInteger(const std::string & value) -> std::optional<std::string>
+{
+  auto digits = withoutUnderscores(value);
+  const auto negative = not digits.empty() and digits.front() == '-';
+  if (not digits.empty() and (digits.front() == '-' or digits.front() == '+')) {
+    digits.erase(0, 1);
+  }
+  try {
+    long long result = 0;
+    if (digits.find(':') != std::string::npos) {
+      std::stringstream ss(digits);
+      for (std::string part; std::getline(ss, part, ':');) {
+        result = result * 60 + std::stoll(part);
+      }
+    } else if (digits.rfind("0b", 0) == 0) {
+      result = std::stoll(digits.substr(2), nullptr, 2);
+    } else if (digits.rfind("0x", 0) == 0) {
+      result = std::stoll(digits.substr(2), nullptr, 16);
+    } else {
+      result = std::stoll(digits, nullptr, digits.size() > 1 and digits.front() == '0' ? 8 : 10);
+    }
+    return (negative ? "-" : "") + std::to_string(result);
+  } catch (const std::out_of_range &) {
+    return std::nullopt;  // NOTE: Python has no limit. Written as is.
+  }
+}
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  conversion.py reads YAML with PyYAML, which resolves each plain scalar to
+ *  a type of YAML 1.1, and writes attributes with Python's str(). Returns the
+ *  string conversion.py writes for a plain scalar that is not a string (e.g.
+ *  "8" for 010, "1.5" for 1.50, "True" for yes, "None" for ~), or nullopt if
+ *  the scalar is a string. Timestamps and sexagesimal floats are treated as
+ *  strings.
+ *
+ * -------------------------------------------------------------------------- */
+static auto resolve(const YAML::Node & yaml) -> std::optional<std::string>
+{
+  static const std::regex truth("yes|Yes|YES|true|True|TRUE|on|On|ON");
+
+  static const std::regex falsehood("no|No|NO|false|False|FALSE|off|Off|OFF");
+
+  static const std::regex integer(
+    "[-+]?0b[0-1_]+|[-+]?0[0-7_]+|[-+]?(0|[1-9][0-9_]*)|[-+]?0x[0-9a-fA-F_]+|"
+    "[-+]?[1-9][0-9_]*(:[0-5]?[0-9])+");
+
+  static const std::regex floating_point(
+    "[-+]?([0-9][0-9_]*)\\.[0-9_]*([eE][-+][0-9]+)?|\\.[0-9][0-9_]*([eE][-+][0-9]+)?");
+
+  static const std::regex infinity("([-+]?)\\.(inf|Inf|INF)");
+
+  static const std::regex nan("\\.(nan|NaN|NAN)");
+
+  if (yaml.IsNull()) {
+    return "None";
+  } else if (not yaml.IsScalar() or yaml.Tag() != "?") {
+    return std::nullopt;
+  } else if (const auto & value = yaml.Scalar(); std::regex_match(value, truth)) {
+    return "True";
+  } else if (std::regex_match(value, falsehood)) {
+    return "False";
+  } else if (std::regex_match(value, integer)) {
+    return reprInteger(value);
+  } else if (std::regex_match(value, floating_point)) {
+    return reprFloat(std::strtod(withoutUnderscores(value).c_str(), nullptr));
+  } else if (std::smatch match; std::regex_match(value, match, infinity)) {
+    return match.str(1) == "-" ? "-inf" : "inf";
+  } else if (std::regex_match(value, nan)) {
+    return "nan";
+  } else {
+    return std::nullopt;
+  }
+}
+
+// NOTE: The entries of a mapping after merging the mappings of its merge keys (<<) into it.
+static auto entries(const YAML::Node & yaml) -> std::vector<std::pair<std::string, YAML::Node>>
+{
+  std::vector<std::pair<std::string, YAML::Node>> merged, result;
+
+  auto insert = [](auto & entries, const auto & key, const auto & value) {
+    for (auto & entry : entries) {
+      if (entry.first == key) {
+        entry.second = value;
+        return;
+      }
+    }
+    entries.emplace_back(key, value);
+  };
+
+  for (const auto & each : yaml) {
+    if (each.first.Scalar() == "<<" and each.first.Tag() == "?") {
+      if (each.second.IsMap()) {
+        for (const auto & [key, value] : entries(each.second)) {
+          insert(merged, key, value);
+        }
+      } else {
+        for (auto i = each.second.size(); 0 < i; --i) {  // NOTE: Earlier mappings take precedence.
+          for (const auto & [key, value] : entries(each.second[i - 1])) {
+            insert(merged, key, value);
+          }
+        }
+      }
+    } else {
+      result.emplace_back(each.first.as<std::string>(), each.second);
+    }
+  }
+
+  for (const auto & [key, value] : result) {
+    insert(merged, key, value);
+  }
+
+  return merged;
+}
+
+static auto convert(const YAML::Node & yaml, pugi::xml_node node) -> void
+{
+  switch (yaml.Type()) {
+    case YAML::NodeType::Map:
+      for (const auto & [tag, value] : entries(yaml)) {
+        if (tag.empty() or tag == "ScenarioModifiers") {
+          continue;
+        } else if (value.IsSequence() and value.size() == 0) {
+          continue;  // NOTE: conversion.py omits empty sequences, even as attributes.
+        } else if (std::islower(static_cast<unsigned char>(tag.front()))) {
+          node.append_attribute(tag.c_str()) =
+            lowercaseBooleans(resolve(value).value_or(value.as<std::string>(""))).c_str();
+        } else if (value.IsSequence()) {
+          for (const auto & element : value) {
+            convert(element, node.append_child(tag.c_str()));
+          }
+        } else {
+          convert(value, node.append_child(tag.c_str()));
+        }
+      }
+      break;
+
+    case YAML::NodeType::Scalar:
+      if (not resolve(yaml)) {  // NOTE: conversion.py writes no text for a non-string scalar.
+        node.text() = lowercaseBooleans(yaml.Scalar()).c_str();
+      }
+      break;
+
+    default:
+      break;
+  }
+}
+
+auto loadYAML(const boost::filesystem::path & path, pugi::xml_document & document) -> void
+{
+  try {
+    convert(YAML::LoadFile(path.string()), document);
+  } catch (const YAML::Exception & error) {
+    throw SyntaxError("Failed to load ", path, ": ", error.what());
+  }
+}
+}  // namespace utility
+}  // namespace openscenario_interpreter
@@ -0,0 +1,208 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <openscenario_interpreter/procedure.hpp>
+#include <openscenario_interpreter/revisions.hpp>
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/condition.hpp>
+#include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/scenario_object.hpp>
+#include <pugixml.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/test/catalogs.hpp>
+#include <traffic_simulator/test/fixture.hpp>
+#include <utility>
+
+using namespace openscenario_interpreter;
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  1000 copies of a Condition whose dependency changes once every 100 frames,
+ *  as if by a ParameterSetAction or by a TeleportAction.
+ *
+ * -------------------------------------------------------------------------- */
+struct Conditions
+{
+  Scope scope{boost::filesystem::path("/tmp/benchmark_condition.xosc")};
+
+  std::list<Condition> conditions;
+
+  pugi::xml_document document;
+
+  const Dependency dependency;
+
+  explicit Conditions(const Dependency dependency) : dependency(dependency) {}
+
+  auto add(const char * condition, std::size_t size = 1000) -> void
+  {
+    document.load_string(condition);
+    for (std::size_t i = 0; i < size; ++i) {
+      conditions.emplace_back(document.document_element(), scope);
+    }
+  }
+
+  auto evaluate(std::size_t frame)
+  {
+    if (frame % 100 == 0) {
+      revisions.touch(dependency);
+    }
+    for (auto && condition : conditions) {
+      benchmark::DoNotOptimize(condition.evaluate());
+    }
+  }
+};
+
+struct ParameterConditions : public Conditions
+{
+  ParameterConditions() : Conditions(Dependency::parameter)
+  {
+    scope.insert("x", make<Double>(1.0));
+    add(R"(
+      <Condition name="" delay="0" conditionEdge="none">
+        <ByValueCondition>
+          <ParameterCondition parameterRef="x" value="1" rule="equalTo"/>
+        </ByValueCondition>
+      </Condition>)");
+  }
+};
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Conditions of the entity "back" on lanelet 34741, 20 m behind the entity
+ *  "front", both MiscObjects in a standalone simulation on kashiwanoha_map.
+ *  The entities are bound to the conditions when they are loaded.
+ *
+ * -------------------------------------------------------------------------- */
+struct EntityConditions : public Conditions
+{
+  explicit EntityConditions(const char * condition) : Conditions(Dependency::entity_kinematics)
+  {
+    auto configuration = makeConfiguration("kashiwanoha_map");
+    configuration.auto_sink = false;
+    configuration.standalone_mode = true;
+
+    connect(makeNode("benchmark_condition"), configuration);
+
+    initialize(1.0, 0.05);
+
+    pugi::xml_document entity;
+    entity.load_string(R"(
+      <ScenarioObject name="">
+        <MiscObject mass="1" name="" miscObjectCategory="obstacle">
+          <BoundingBox>
+            <Center x="0" y="0" z="0"/>
+            <Dimensions width="1" length="1" height="1"/>
+          </BoundingBox>
+          <Properties/>
+        </MiscObject>
+      </ScenarioObject>)");
+
+    for (const auto & [name, s] : {std::make_pair("back", 0.0), std::make_pair("front", 20.0)}) {
+      entity.document_element().attribute("name").set_value(name);
+      scope.global().entities.emplace(name, make<ScenarioObject>(entity.document_element(), scope));
+      connection->spawn(name, getMiscObjectParameters());
+      connection->setEntityStatus(
+        name, makeSpawnPose(s), traffic_simulator::helper::constructActionStatus());
+      scope.global().entities.at(name).as<ScenarioObject>().is_added = true;
+    }
+
+    add(condition);
+  }
+
+  ~EntityConditions() { disconnect(); }
+};
+
+struct TimeHeadwayConditions : public EntityConditions
+{
+  TimeHeadwayConditions()
+  : EntityConditions(R"(
+      <Condition name="" delay="0" conditionEdge="none">
+        <ByEntityCondition>
+          <TriggeringEntities triggeringEntitiesRule="any">
+            <EntityRef entityRef="back"/>
+          </TriggeringEntities>
+          <EntityCondition>
+            <TimeHeadwayCondition entityRef="front" value="1" freespace="false"
+              alongRoute="false" rule="lessThan"/>
+          </EntityCondition>
+        </ByEntityCondition>
+      </Condition>)")
+  {
+  }
+};
+
+struct ReachPositionConditions : public EntityConditions
+{
+  ReachPositionConditions()
+  : EntityConditions(R"(
+      <Condition name="" delay="0" conditionEdge="none">
+        <ByEntityCondition>
+          <TriggeringEntities triggeringEntitiesRule="any">
+            <EntityRef entityRef="back"/>
+          </TriggeringEntities>
+          <EntityCondition>
+            <ReachPositionCondition tolerance="1">
+              <Position>
+                <LanePosition roadId="" laneId="34741" s="10" offset="0">
+                  <Orientation type="relative" h="0" p="0" r="0"/>
+                </LanePosition>
+              </Position>
+            </ReachPositionCondition>
+          </EntityCondition>
+        </ByEntityCondition>
+      </Condition>)")
+  {
+  }
+};
+
+template <typename Scenario>
+static void EvaluateConditionsEveryFrame(benchmark::State & state)
+{
+  Scenario scenario;
+  revisions.tracking = false;
+  std::size_t frame = 0;
+  for (auto _ : state) {
+    scenario.evaluate(frame++);
+  }
+  revisions.tracking = true;
+}
+BENCHMARK_TEMPLATE(EvaluateConditionsEveryFrame, ParameterConditions);
+BENCHMARK_TEMPLATE(EvaluateConditionsEveryFrame, TimeHeadwayConditions);
+BENCHMARK_TEMPLATE(EvaluateConditionsEveryFrame, ReachPositionConditions);
+
+template <typename Scenario>
+static void EvaluateConditionsOnDependencyChange(benchmark::State & state)
+{
+  Scenario scenario;
+  std::size_t frame = 0;
+  for (auto _ : state) {
+    scenario.evaluate(frame++);
+  }
+}
+BENCHMARK_TEMPLATE(EvaluateConditionsOnDependencyChange, ParameterConditions);
+BENCHMARK_TEMPLATE(EvaluateConditionsOnDependencyChange, TimeHeadwayConditions);
+BENCHMARK_TEMPLATE(EvaluateConditionsOnDependencyChange, ReachPositionConditions);
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  rclcpp::shutdown();
+  return 0;
+}
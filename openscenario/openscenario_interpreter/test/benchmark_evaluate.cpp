@@ -0,0 +1,77 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <openscenario_interpreter/reader/evaluate.hpp>
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/integer.hpp>
+#include <string>
+#include <vector>
+
+using namespace openscenario_interpreter;
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Expressions of the kind scenarios use to place and pace entities: constant
+ *  arithmetic, references to parameters, and built-in functions.
+ *
+ * -------------------------------------------------------------------------- */
+static const std::vector<std::string> expressions{
+  "1.5 * 3.6",
+  "$speed / 3.6",
+  "$offset + $index * $interval",
+  "round($interval * 0.5) + floor($offset)",
+  "$initial_speed + $acceleration * pow($time, 2) / 2",
+};
+
+struct Parameters : public Scope
+{
+  Parameters() : Scope(boost::filesystem::path("/tmp/benchmark_evaluate.xosc"))
+  {
+    insert("speed", make<Double>(30.0));
+    insert("offset", make<Double>(12.5));
+    insert("index", make<Integer>(3));
+    insert("interval", make<Double>(8.0));
+    insert("initial_speed", make<Double>(5.0));
+    insert("acceleration", make<Double>(1.5));
+    insert("time", make<Double>(2.0));
+  }
+};
+
+static void EvaluateExpression(benchmark::State & state)
+{
+  Parameters parameters;
+  const auto & expression = expressions.at(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(evaluate(expression, parameters));
+  }
+  state.SetLabel(expression);
+}
+BENCHMARK(EvaluateExpression)->DenseRange(0, 4);
+
+static void ReevaluateCompiledExpression(benchmark::State & state)
+{
+  Parameters parameters;
+  const auto & expression = expressions.at(state.range(0));
+  CompiledExpression compiled_expression{expression, parameters};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(compiled_expression.evaluate());
+  }
+  state.SetLabel(expression);
+}
+BENCHMARK(ReevaluateCompiledExpression)->DenseRange(0, 4);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,113 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/boolean.hpp>
+#include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/parameter_condition.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
+#include <pugixml.hpp>
+#include <vector>
+
+using namespace openscenario_interpreter;
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  A synthetic storyboard of 10000 conditions and the values they compare,
+ *  which is the shape of what the interpreter walks through on every frame.
+ *
+ * -------------------------------------------------------------------------- */
+struct SyntheticStoryboard
+{
+  Scope scope{boost::filesystem::path("/tmp/benchmark_pointer.xosc")};
+
+  std::vector<Object> values;
+
+  std::vector<Object> conditions;
+
+  pugi::xml_document document;
+
+  explicit SyntheticStoryboard(std::size_t size = 10000)
+  {
+    scope.insert("x", make<Double>(1.0));
+
+    auto node = document.append_child("ParameterCondition");
+    node.append_attribute("parameterRef") = "x";
+    node.append_attribute("value") = "1";
+    node.append_attribute("rule") = "equalTo";
+
+    for (std::size_t i = 0; i < size; ++i) {
+      switch (i % 3) {
+        case 0:
+          values.push_back(make<Double>(i));
+          break;
+        case 1:
+          values.push_back(make<Boolean>(i % 2 == 0));
+          break;
+        default:
+          values.push_back(make<String>(std::to_string(i)));
+          break;
+      }
+      conditions.push_back(make<ParameterCondition>(node, scope));
+    }
+  }
+};
+
+static void TestExactType(benchmark::State & state)
+{
+  SyntheticStoryboard storyboard;
+  for (auto _ : state) {
+    for (const auto & value : storyboard.values) {
+      benchmark::DoNotOptimize(value.is<Double>());
+    }
+  }
+}
+BENCHMARK(TestExactType);
+
+static void TestBaseType(benchmark::State & state)
+{
+  SyntheticStoryboard storyboard;
+  for (auto _ : state) {
+    for (const auto & value : storyboard.values) {
+      benchmark::DoNotOptimize(value.is_also<Double>());
+    }
+  }
+}
+BENCHMARK(TestBaseType);
+
+static void CastToExactType(benchmark::State & state)
+{
+  SyntheticStoryboard storyboard;
+  for (auto _ : state) {
+    for (const auto & condition : storyboard.conditions) {
+      benchmark::DoNotOptimize(&condition.as<ParameterCondition>());
+    }
+  }
+}
+BENCHMARK(CastToExactType);
+
+static void EvaluateStoryboard(benchmark::State & state)
+{
+  SyntheticStoryboard storyboard;
+  for (auto _ : state) {
+    for (const auto & condition : storyboard.conditions) {
+      benchmark::DoNotOptimize(condition.evaluate());
+    }
+  }
+}
+BENCHMARK(EvaluateStoryboard);
+
+BENCHMARK_MAIN();
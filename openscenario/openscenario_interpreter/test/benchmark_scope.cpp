@@ -0,0 +1,86 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <list>
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/parameter_condition.hpp>
+#include <pugixml.hpp>
+#include <string>
+
+using namespace openscenario_interpreter;
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  1000 ParameterConditions in the innermost of 32 nested frames, all of which
+ *  refer to a parameter declared in the outermost frame. Every frame declares
+ *  a few other parameters, as Storyboard elements usually do.
+ *
+ * -------------------------------------------------------------------------- */
+struct NestedScenario
+{
+  std::list<Scope> scopes;
+
+  std::list<ParameterCondition> conditions;
+
+  pugi::xml_document document;
+
+  explicit NestedScenario(std::size_t depth = 32, std::size_t size = 1000)
+  {
+    scopes.emplace_back(boost::filesystem::path("/tmp/benchmark_scope.xosc"));
+    scopes.back().insert("x", make<Double>(1.0));
+
+    for (std::size_t i = 0; i < depth; ++i) {
+      scopes.emplace_back("", scopes.back());
+      for (std::size_t j = 0; j < 8; ++j) {
+        scopes.back().insert("y" + std::to_string(j), make<Double>(j));
+      }
+    }
+
+    auto node = document.append_child("ParameterCondition");
+    node.append_attribute("parameterRef") = "x";
+    node.append_attribute("value") = "1";
+    node.append_attribute("rule") = "equalTo";
+
+    for (std::size_t i = 0; i < size; ++i) {
+      conditions.emplace_back(node, scopes.back());
+    }
+  }
+};
+
+static void LookupParameterByName(benchmark::State & state)
+{
+  NestedScenario scenario;
+  for (auto _ : state) {
+    for (const auto & condition : scenario.conditions) {
+      benchmark::DoNotOptimize(scenario.scopes.back().ref(condition.parameter_ref));
+    }
+  }
+}
+BENCHMARK(LookupParameterByName);
+
+static void EvaluateBoundParameterConditions(benchmark::State & state)
+{
+  NestedScenario scenario;
+  for (auto _ : state) {
+    for (const auto & condition : scenario.conditions) {
+      benchmark::DoNotOptimize(condition.evaluate());
+    }
+  }
+}
+BENCHMARK(EvaluateBoundParameterConditions);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,521 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <nlohmann/json.hpp>
+#include <openscenario_interpreter/procedure.hpp>
+#include <openscenario_interpreter/revisions.hpp>
+#include <openscenario_interpreter/syntax/openscenario.hpp>
+#include <pugixml.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/test/fixture.hpp>
+#include <vector>
+
+using namespace openscenario_interpreter;
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  The ego vehicle runs at 5 m/s and is stopped at once (by a SpeedAction with
+ *  the step dynamics shape) after 1 second. After it stands still for 1
+ *  second, a parameter is set, and another parameter is set when the first
+ *  one is set and the stopping Event is complete. So every tracked dependency
+ *  of Conditions (parameters, StoryboardElement states, simulation time and
+ *  entity kinematics) changes during the scenario.
+ *
+ * -------------------------------------------------------------------------- */
+constexpr auto stopping_scenario = R"(<?xml version="1.0" encoding="UTF-8"?>
+<OpenSCENARIO>
+  <FileHeader revMajor="1" revMinor="0" date="1970-01-01T09:00:00+09:00" description="" author=""/>
+  <ParameterDeclarations>
+    <ParameterDeclaration name="phase" parameterType="integer" value="0"/>
+  </ParameterDeclarations>
+  <CatalogLocations/>
+  <RoadNetwork>
+    <LogicFile filepath="$(find-pkg-share kashiwanoha_map)/map/lanelet2_map.osm"/>
+    <SceneGraphFile filepath=""/>
+  </RoadNetwork>
+  <Entities>
+    <ScenarioObject name="ego">
+      <Vehicle name="" vehicleCategory="car">
+        <BoundingBox>
+          <Center x="0" y="0" z="0"/>
+          <Dimensions width="2" length="4" height="2.5"/>
+        </BoundingBox>
+        <Performance maxSpeed="30" maxAcceleration="INF" maxDeceleration="INF"/>
+        <Axles>
+          <FrontAxle maxSteering="3.1415" wheelDiameter="0.6" trackWidth="4"
+            positionX="1" positionZ="0.3"/>
+          <RearAxle maxSteering="3.1415" wheelDiameter="0.6" trackWidth="4"
+            positionX="-1" positionZ="0.3"/>
+        </Axles>
+        <Properties/>
+      </Vehicle>
+    </ScenarioObject>
+  </Entities>
+  <Storyboard>
+    <Init>
+      <Actions>
+        <Private entityRef="ego">
+          <PrivateAction>
+            <TeleportAction>
+              <Position>
+                <LanePosition roadId="" laneId="34513" s="10" offset="0">
+                  <Orientation type="relative" h="0" p="0" r="0"/>
+                </LanePosition>
+              </Position>
+            </TeleportAction>
+          </PrivateAction>
+          <PrivateAction>
+            <LongitudinalAction>
+              <SpeedAction>
+                <SpeedActionDynamics dynamicsShape="step" value="0" dynamicsDimension="time"/>
+                <SpeedActionTarget>
+                  <AbsoluteTargetSpeed value="5"/>
+                </SpeedActionTarget>
+              </SpeedAction>
+            </LongitudinalAction>
+          </PrivateAction>
+        </Private>
+      </Actions>
+    </Init>
+    <Story name="story">
+      <Act name="act">
+        <ManeuverGroup name="maneuver-group" maximumExecutionCount="1">
+          <Actors selectTriggeringEntities="false">
+            <EntityRef entityRef="ego"/>
+          </Actors>
+          <Maneuver name="maneuver">
+            <Event name="stop" priority="parallel">
+              <Action name="stop-at-once">
+                <PrivateAction>
+                  <LongitudinalAction>
+                    <SpeedAction>
+                      <SpeedActionDynamics dynamicsShape="step" value="0" dynamicsDimension="time"/>
+                      <SpeedActionTarget>
+                        <AbsoluteTargetSpeed value="0"/>
+                      </SpeedActionTarget>
+                    </SpeedAction>
+                  </LongitudinalAction>
+                </PrivateAction>
+              </Action>
+              <StartTrigger>
+                <ConditionGroup>
+                  <Condition name="running" delay="0" conditionEdge="none">
+                    <ByEntityCondition>
+                      <TriggeringEntities triggeringEntitiesRule="any">
+                        <EntityRef entityRef="ego"/>
+                      </TriggeringEntities>
+                      <EntityCondition>
+                        <SpeedCondition value="4" rule="greaterThan"/>
+                      </EntityCondition>
+                    </ByEntityCondition>
+                  </Condition>
+                  <Condition name="after-1-second" delay="0" conditionEdge="none">
+                    <ByValueCondition>
+                      <SimulationTimeCondition value="1" rule="greaterThan"/>
+                    </ByValueCondition>
+                  </Condition>
+                </ConditionGroup>
+              </StartTrigger>
+            </Event>
+            <Event name="standing-still" priority="parallel">
+              <Action name="set-phase-1">
+                <GlobalAction>
+                  <ParameterAction parameterRef="phase">
+                    <SetAction value="1"/>
+                  </ParameterAction>
+                </GlobalAction>
+              </Action>
+              <StartTrigger>
+                <ConditionGroup>
+                  <Condition name="stand-still" delay="0" conditionEdge="none">
+                    <ByEntityCondition>
+                      <TriggeringEntities triggeringEntitiesRule="any">
+                        <EntityRef entityRef="ego"/>
+                      </TriggeringEntities>
+                      <EntityCondition>
+                        <StandStillCondition duration="1"/>
+                      </EntityCondition>
+                    </ByEntityCondition>
+                  </Condition>
+                </ConditionGroup>
+              </StartTrigger>
+            </Event>
+            <Event name="stopped" priority="parallel">
+              <Action name="set-phase-2">
+                <GlobalAction>
+                  <ParameterAction parameterRef="phase">
+                    <SetAction value="2"/>
+                  </ParameterAction>
+                </GlobalAction>
+              </Action>
+              <StartTrigger>
+                <ConditionGroup>
+                  <Condition name="phase-1" delay="0" conditionEdge="none">
+                    <ByValueCondition>
+                      <ParameterCondition parameterRef="phase" value="1" rule="equalTo"/>
+                    </ByValueCondition>
+                  </Condition>
+                  <Condition name="stop-complete" delay="0" conditionEdge="none">
+                    <ByValueCondition>
+                      <StoryboardElementStateCondition storyboardElementType="event"
+                        storyboardElementRef="stop" state="completeState"/>
+                    </ByValueCondition>
+                  </Condition>
+                </ConditionGroup>
+              </StartTrigger>
+            </Event>
+          </Maneuver>
+        </ManeuverGroup>
+        <StartTrigger>
+          <ConditionGroup>
+            <Condition name="started" delay="0" conditionEdge="none">
+              <ByValueCondition>
+                <SimulationTimeCondition value="0" rule="greaterThan"/>
+              </ByValueCondition>
+            </Condition>
+          </ConditionGroup>
+        </StartTrigger>
+      </Act>
+    </Story>
+    <StopTrigger>
+      <ConditionGroup>
+        <Condition name="time-up" delay="0" conditionEdge="none">
+          <ByValueCondition>
+            <SimulationTimeCondition value="100" rule="greaterThan"/>
+          </ByValueCondition>
+        </Condition>
+      </ConditionGroup>
+      <ConditionGroup>
+        <Condition name="moving-backward" delay="0" conditionEdge="none">
+          <ByEntityCondition>
+            <TriggeringEntities triggeringEntitiesRule="any">
+              <EntityRef entityRef="ego"/>
+            </TriggeringEntities>
+            <EntityCondition>
+              <SpeedCondition value="0" rule="lessThan"/>
+            </EntityCondition>
+          </ByEntityCondition>
+        </Condition>
+      </ConditionGroup>
+    </StopTrigger>
+  </Storyboard>
+</OpenSCENARIO>
+)";
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Both vehicles stand still, so the status of no entity changes on most
+ *  frames. The ego vehicle is teleported next to the other one after 2
+ *  seconds, which makes it reach a position and approach the other one. The
+ *  simulation time is compared with rules other than greaterThan, including
+ *  equalTo a time on a frame.
+ *
+ * -------------------------------------------------------------------------- */
+constexpr auto teleporting_scenario = R"(<?xml version="1.0" encoding="UTF-8"?>
+<OpenSCENARIO>
+  <FileHeader revMajor="1" revMinor="0" date="1970-01-01T09:00:00+09:00" description="" author=""/>
+  <ParameterDeclarations>
+    <ParameterDeclaration name="early" parameterType="integer" value="0"/>
+    <ParameterDeclaration name="reached" parameterType="integer" value="0"/>
+  </ParameterDeclarations>
+  <CatalogLocations/>
+  <RoadNetwork>
+    <LogicFile filepath="$(find-pkg-share kashiwanoha_map)/map/lanelet2_map.osm"/>
+    <SceneGraphFile filepath=""/>
+  </RoadNetwork>
+  <Entities>
+    <ScenarioObject name="ego">
+      <Vehicle name="" vehicleCategory="car">
+        <BoundingBox>
+          <Center x="0" y="0" z="0"/>
+          <Dimensions width="2" length="4" height="2.5"/>
+        </BoundingBox>
+        <Performance maxSpeed="30" maxAcceleration="INF" maxDeceleration="INF"/>
+        <Axles>
+          <FrontAxle maxSteering="3.1415" wheelDiameter="0.6" trackWidth="4"
+            positionX="1" positionZ="0.3"/>
+          <RearAxle maxSteering="3.1415" wheelDiameter="0.6" trackWidth="4"
+            positionX="-1" positionZ="0.3"/>
+        </Axles>
+        <Properties/>
+      </Vehicle>
+    </ScenarioObject>
+    <ScenarioObject name="npc">
+      <Vehicle name="" vehicleCategory="car">
+        <BoundingBox>
+          <Center x="0" y="0" z="0"/>
+          <Dimensions width="2" length="4" height="2.5"/>
+        </BoundingBox>
+        <Performance maxSpeed="30" maxAcceleration="INF" maxDeceleration="INF"/>
+        <Axles>
+          <FrontAxle maxSteering="3.1415" wheelDiameter="0.6" trackWidth="4"
+            positionX="1" positionZ="0.3"/>
+          <RearAxle maxSteering="3.1415" wheelDiameter="0.6" trackWidth="4"
+            positionX="-1" positionZ="0.3"/>
+        </Axles>
+        <Properties/>
+      </Vehicle>
+    </ScenarioObject>
+  </Entities>
+  <Storyboard>
+    <Init>
+      <Actions>
+        <Private entityRef="ego">
+          <PrivateAction>
+            <TeleportAction>
+              <Position>
+                <LanePosition roadId="" laneId="34513" s="0" offset="0">
+                  <Orientation type="relative" h="0" p="0" r="0"/>
+                </LanePosition>
+              </Position>
+            </TeleportAction>
+          </PrivateAction>
+        </Private>
+        <Private entityRef="npc">
+          <PrivateAction>
+            <TeleportAction>
+              <Position>
+                <LanePosition roadId="" laneId="34513" s="40" offset="0">
+                  <Orientation type="relative" h="0" p="0" r="0"/>
+                </LanePosition>
+              </Position>
+            </TeleportAction>
+          </PrivateAction>
+        </Private>
+      </Actions>
+    </Init>
+    <Story name="story">
+      <Act name="act">
+        <ManeuverGroup name="maneuver-group" maximumExecutionCount="1">
+          <Actors selectTriggeringEntities="false">
+            <EntityRef entityRef="ego"/>
+          </Actors>
+          <Maneuver name="maneuver">
+            <Event name="teleport" priority="parallel">
+              <Action name="teleport-next-to-npc">
+                <PrivateAction>
+                  <TeleportAction>
+                    <Position>
+                      <LanePosition roadId="" laneId="34513" s="30" offset="0">
+                        <Orientation type="relative" h="0" p="0" r="0"/>
+                      </LanePosition>
+                    </Position>
+                  </TeleportAction>
+                </PrivateAction>
+              </Action>
+              <StartTrigger>
+                <ConditionGroup>
+                  <Condition name="after-2-seconds" delay="0" conditionEdge="none">
+                    <ByValueCondition>
+                      <SimulationTimeCondition value="2" rule="greaterThan"/>
+                    </ByValueCondition>
+                  </Condition>
+                </ConditionGroup>
+              </StartTrigger>
+            </Event>
+            <Event name="early" priority="parallel">
+              <Action name="set-early">
+                <GlobalAction>
+                  <ParameterAction parameterRef="early">
+                    <SetAction value="1"/>
+                  </ParameterAction>
+                </GlobalAction>
+              </Action>
+              <StartTrigger>
+                <ConditionGroup>
+                  <Condition name="before-1-second" delay="0" conditionEdge="none">
+                    <ByValueCondition>
+                      <SimulationTimeCondition value="1" rule="lessThan"/>
+                    </ByValueCondition>
+                  </Condition>
+                  <Condition name="at-half-a-second" delay="0" conditionEdge="none">
+                    <ByValueCondition>
+                      <SimulationTimeCondition value="0.5" rule="equalTo"/>
+                    </ByValueCondition>
+                  </Condition>
+                </ConditionGroup>
+              </StartTrigger>
+            </Event>
+            <Event name="reach" priority="parallel">
+              <Action name="set-reached">
+                <GlobalAction>
+                  <ParameterAction parameterRef="reached">
+                    <SetAction value="1"/>
+                  </ParameterAction>
+                </GlobalAction>
+              </Action>
+              <StartTrigger>
+                <ConditionGroup>
+                  <Condition name="reach-position" delay="0" conditionEdge="none">
+                    <ByEntityCondition>
+                      <TriggeringEntities triggeringEntitiesRule="any">
+                        <EntityRef entityRef="ego"/>
+                      </TriggeringEntities>
+                      <EntityCondition>
+                        <ReachPositionCondition tolerance="1">
+                          <Position>
+                            <LanePosition roadId="" laneId="34513" s="30" offset="0"/>
+                          </Position>
+                        </ReachPositionCondition>
+                      </EntityCondition>
+                    </ByEntityCondition>
+                  </Condition>
+                  <Condition name="close-to-npc" delay="0" conditionEdge="none">
+                    <ByEntityCondition>
+                      <TriggeringEntities triggeringEntitiesRule="any">
+                        <EntityRef entityRef="ego"/>
+                      </TriggeringEntities>
+                      <EntityCondition>
+                        <RelativeDistanceCondition entityRef="npc"
+                          relativeDistanceType="cartesianDistance" value="20" freespace="false"
+                          rule="lessThan"/>
+                      </EntityCondition>
+                    </ByEntityCondition>
+                  </Condition>
+                </ConditionGroup>
+              </StartTrigger>
+            </Event>
+          </Maneuver>
+        </ManeuverGroup>
+        <StartTrigger>
+          <ConditionGroup>
+            <Condition name="started" delay="0" conditionEdge="none">
+              <ByValueCondition>
+                <SimulationTimeCondition value="0" rule="greaterThan"/>
+              </ByValueCondition>
+            </Condition>
+          </ConditionGroup>
+        </StartTrigger>
+      </Act>
+    </Story>
+    <StopTrigger>
+      <ConditionGroup>
+        <Condition name="time-up" delay="0" conditionEdge="none">
+          <ByValueCondition>
+            <SimulationTimeCondition value="100" rule="greaterThan"/>
+          </ByValueCondition>
+        </Condition>
+      </ConditionGroup>
+    </StopTrigger>
+  </Storyboard>
+</OpenSCENARIO>
+)";
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  The name and the value of each Condition on each frame, and separately the
+ *  description of its evaluation, which shows the values it was evaluated
+ *  with and so stays the same while the Condition is not reevaluated.
+ *
+ * -------------------------------------------------------------------------- */
+struct Trace
+{
+  std::vector<std::vector<std::string>> values;
+
+  std::vector<std::vector<std::string>> evaluations;
+};
+
+auto collectConditions(const nlohmann::json & json, Trace & trace) -> void
+{
+  if (json.is_object() and json.contains("currentEvaluation")) {
+    trace.values.back().push_back(
+      json["name"].get<std::string>() + " = " + json["currentValue"].get<std::string>());
+    trace.evaluations.back().push_back(json["currentEvaluation"].get<std::string>());
+  } else if (json.is_structured()) {
+    for (const auto & value : json) {
+      collectConditions(value, trace);
+    }
+  }
+}
+
+auto runScenario(const char * scenario, const bool track_condition_dependencies) -> Trace
+{
+  revisions.tracking = track_condition_dependencies;
+
+  pugi::xml_document document;
+  document.load_string(scenario);
+
+  OpenScenario script{document, "/tmp/test_condition_dependencies.xosc"};
+
+  const auto node = makeNode("test_condition_dependencies");
+
+  auto configuration = makeConfiguration("kashiwanoha_map");
+  configuration.auto_sink = false;
+  configuration.standalone_mode = true;
+
+  connect(node, configuration);
+
+  initialize(1.0, 0.05);
+
+  Trace trace;
+
+  for (auto i = 0; i < 100; ++i) {
+    script.evaluate();
+    nlohmann::json json;
+    json << script;
+    trace.values.emplace_back();
+    trace.evaluations.emplace_back();
+    collectConditions(json, trace);
+  }
+
+  disconnect();
+
+  return trace;
+}
+
+// NOTE: The number of descriptions of evaluations which differ from the previous frame.
+auto countReevaluations(const Trace & trace)
+{
+  std::size_t count = 0;
+  for (std::size_t frame = 1; frame < trace.evaluations.size(); ++frame) {
+    for (std::size_t i = 0; i < trace.evaluations[frame].size(); ++i) {
+      if (
+        i < trace.evaluations[frame - 1].size() and
+        trace.evaluations[frame][i] != trace.evaluations[frame - 1][i]) {
+        ++count;
+      }
+    }
+  }
+  return count;
+}
+
+TEST(Condition, TrackDependencies)
+{
+  for (const auto scenario : {stopping_scenario, teleporting_scenario}) {
+    const auto untracked = runScenario(scenario, false);
+    const auto tracked = runScenario(scenario, true);
+
+    ASSERT_EQ(tracked.values.size(), untracked.values.size());
+
+    for (std::size_t frame = 0; frame < tracked.values.size(); ++frame) {
+      EXPECT_EQ(tracked.values[frame], untracked.values[frame]) << "frame " << frame;
+    }
+
+    EXPECT_NE(untracked.values.front(), untracked.values.back());
+
+    EXPECT_LT(countReevaluations(tracked), countReevaluations(untracked));
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+  const auto result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
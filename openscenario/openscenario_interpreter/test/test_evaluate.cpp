@@ -0,0 +1,167 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <openscenario_interpreter/reader/evaluate.hpp>
+#include <openscenario_interpreter/scope.hpp>
+#include <openscenario_interpreter/syntax/boolean.hpp>
+#include <openscenario_interpreter/syntax/double.hpp>
+#include <openscenario_interpreter/syntax/integer.hpp>
+#include <openscenario_interpreter/syntax/string.hpp>
+#include <openscenario_interpreter/syntax/unsigned_integer.hpp>
+#include <openscenario_interpreter/syntax/unsigned_short.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace openscenario_interpreter;
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  The expected results are the outputs of the boost::spirit grammar that the
+ *  compiled expressions replaced, so these cases pin down that both accept
+ *  the same expressions and give the same results.
+ *
+ * -------------------------------------------------------------------------- */
+struct Evaluate : public testing::Test
+{
+  Scope scope{boost::filesystem::path("/tmp/test_evaluate.xosc")};
+
+  Evaluate()
+  {
+    scope.insert("x", make<Double>(1.5));
+    scope.insert("i", make<Integer>(3));
+    scope.insert("u", make<UnsignedInteger>(4));
+    scope.insert("h", make<UnsignedShort>(5));
+    scope.insert("b", make<Boolean>(true));
+    scope.insert("s", make<String>("text"));
+  }
+
+  auto expectResults(const std::vector<std::pair<std::string, std::string>> & cases) const
+  {
+    for (const auto & [expression, result] : cases) {
+      EXPECT_EQ(evaluate(expression, scope), result) << expression;
+    }
+  }
+};
+
+TEST_F(Evaluate, Precedence)
+{
+  expectResults({
+    {"1 + 2 * 3", "7"},
+    {"(1 + 2) * 3", "9"},
+    {"10 - 4 - 3", "3"},
+    {"2 * 3 % 4", "2.000000"},
+    {"8 / 4 / 2", "1.000000"},
+    {"1 + 2 * 3 - 4 / 2", "5.000000"},
+    {"2 * pow(2, 3) + 1", "17.000000"},
+    {"true or false and false", "true"},
+    {"(true or false) and false", "false"},
+    {"not true or true", "true"},
+    {"not (true or true)", "false"},
+    {"$i + $i * $i", "12"},
+  });
+}
+
+TEST_F(Evaluate, UnaryMinus)
+{
+  expectResults({
+    {"-2 * 3", "-6"},
+    {"-(2 + 3)", "-5"},
+    {"2 * -3", "-6"},
+    {"1 - -1", "2"},
+    {"- -1", "1"},
+    {"-$x", "-1.500000"},
+    {"-$i * 2", "-6"},
+    {"-pow(2, 2)", "-4.000000"},
+  });
+}
+
+TEST_F(Evaluate, ResultType)
+{
+  expectResults({
+    {"1 + 2", "3"},
+    {"1.0 + 2", "3.000000"},
+    {"7 / 2", "3.500000"},
+    {"6 / 3", "2.000000"},
+    {"7 % 2", "1.000000"},
+    {"7.5 % 2", "1.500000"},
+    {"round(2.5)", "3"},
+    {"round(-2.5)", "-3"},
+    {"floor(-1.5)", "-2"},
+    {"ceil(1.2)", "2"},
+    {"sqrt(17)", "4"},
+    {"pow(2, 10)", "1024.000000"},
+    {"round(true)", "1"},
+    {"true and not false", "true"},
+    {"$i + 1", "4"},
+    {"$u + 1", "5"},
+    {"$h * 2", "10"},
+    {"$x * 2", "3.000000"},
+    {"$b or false", "true"},
+    {"not $b", "false"},
+    {"1e3", "1000.000000"},
+    {"1.5e-1", "0.150000"},
+    {".5", "0.500000"},
+    {"5.", "5.000000"},
+    {"+1", "1"},
+    {"2147483647", "2147483647"},
+    {"  1 +  2  ", "3"},
+    {"", "0"},
+  });
+}
+
+TEST_F(Evaluate, ParseError)
+{
+  for (const auto & expression :
+       {"1 +", "(1 + 2", "1 2", "1 + 2)", "*1", "1..5", "pow(2)", "99999999999", "$"}) {
+    EXPECT_THROW(evaluate(expression, scope), SyntaxError) << expression;
+  }
+}
+
+TEST_F(Evaluate, ReferenceError)
+{
+  EXPECT_THROW(evaluate("$undefined + 1", scope), SyntaxError);
+  EXPECT_THROW(evaluate("$s", scope), SyntaxError);
+}
+
+TEST_F(Evaluate, TypeError)
+{
+  EXPECT_THROW(evaluate("true + 1", scope), std::runtime_error);
+  EXPECT_THROW(evaluate("not 1", scope), std::runtime_error);
+}
+
+TEST_F(Evaluate, ReevaluateOnParameterChange)
+{
+  CompiledExpression expression{"$x * $i", scope};
+
+  EXPECT_EQ(expression.evaluate(), "4.500000");
+  EXPECT_EQ(expression.evaluate(), "4.500000");
+
+  scope.ref<Double>(std::string("x")) = 2.5;
+
+  EXPECT_EQ(expression.evaluate(), "7.500000");
+
+  scope.ref<Integer>(std::string("i")) = Integer(2);
+
+  EXPECT_EQ(expression.evaluate(), "5.000000");
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,409 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gtest/gtest.h>
+
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <boost/lexical_cast.hpp>
+#include <fstream>
+#include <memory>
+#include <openscenario_interpreter/syntax/openscenario.hpp>
+#include <openscenario_interpreter/syntax/parameter_value_distribution_definition.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace openscenario_interpreter;
+
+constexpr auto scenario = R"(<?xml version="1.0" encoding="UTF-8"?>
+<OpenSCENARIO>
+  <FileHeader revMajor="1" revMinor="0" date="1970-01-01T09:00:00+09:00" description="" author=""/>
+  <ParameterDeclarations>
+    <ParameterDeclaration name="start" parameterType="double" value="0"/>
+    <ParameterDeclaration name="stop" parameterType="double" value="1"/>
+  </ParameterDeclarations>
+  <CatalogLocations/>
+  <RoadNetwork>
+    <LogicFile filepath="$(find-pkg-share kashiwanoha_map)/map"/>
+  </RoadNetwork>
+  <Entities/>
+  <Storyboard>
+    <Init>
+      <Actions/>
+    </Init>
+    <Story name="">
+      <Act name="">
+        <ManeuverGroup name="" maximumExecutionCount="1">
+          <Actors selectTriggeringEntities="false"/>
+          <Maneuver name="">
+            <Event name="" priority="parallel">
+              <Action name="">
+                <UserDefinedAction>
+                  <CustomCommandAction type="exitSuccess"/>
+                </UserDefinedAction>
+              </Action>
+              <StartTrigger>
+                <ConditionGroup>
+                  <Condition name="" delay="0" conditionEdge="none">
+                    <ByValueCondition>
+                      <SimulationTimeCondition value="$stop" rule="greaterThan"/>
+                    </ByValueCondition>
+                  </Condition>
+                </ConditionGroup>
+              </StartTrigger>
+            </Event>
+          </Maneuver>
+        </ManeuverGroup>
+        <StartTrigger>
+          <ConditionGroup>
+            <Condition name="" delay="0" conditionEdge="none">
+              <ByValueCondition>
+                <SimulationTimeCondition value="$start" rule="greaterThan"/>
+              </ByValueCondition>
+            </Condition>
+          </ConditionGroup>
+        </StartTrigger>
+      </Act>
+    </Story>
+    <StopTrigger/>
+  </Storyboard>
+</OpenSCENARIO>
+)";
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Writes the given DistributionDefinition (Deterministic or Stochastic) into
+ *  a ParameterValueDistribution file next to the scenario above and loads it.
+ *
+ * -------------------------------------------------------------------------- */
+auto load(const std::string & distribution_definition)
+{
+  const auto directory = boost::filesystem::temp_directory_path() /
+                         boost::filesystem::unique_path("test_parameter_value_distribution-%%%%");
+
+  boost::filesystem::create_directory(directory);
+
+  std::ofstream((directory / "scenario.xosc").string()) << scenario;
+
+  std::ofstream((directory / "distribution.xosc").string())
+    << R"(<?xml version="1.0" encoding="UTF-8"?>
+<OpenSCENARIO>
+  <FileHeader revMajor="1" revMinor="1" date="1970-01-01T09:00:00+09:00" description="" author=""/>
+  <ParameterValueDistribution>
+    <ScenarioFile filepath="scenario.xosc"/>
+    )" << distribution_definition
+    << R"(
+  </ParameterValueDistribution>
+</OpenSCENARIO>
+)";
+
+  const auto script = std::make_shared<OpenScenario>(directory / "distribution.xosc");
+
+  boost::filesystem::remove_all(directory);
+
+  return script;
+}
+
+auto parameterValueSets(const std::string & distribution_definition)
+{
+  return load(distribution_definition)
+    ->category.as<ParameterValueDistributionDefinition>()
+    .parameter_value_sets;
+}
+
+auto values(const std::vector<ParameterValueSet> & parameter_value_sets, const String & name)
+{
+  std::vector<double> result;
+  for (const auto & parameter_value_set : parameter_value_sets) {
+    for (const auto & [parameter_name, value] : parameter_value_set) {
+      if (parameter_name == name) {
+        result.push_back(boost::lexical_cast<double>(value));
+      }
+    }
+  }
+  return result;
+}
+
+auto makeParameterValueSet(const std::vector<std::pair<String, String>> & assignments)
+{
+  ParameterValueSet parameter_value_set;
+  parameter_value_set.assign(std::begin(assignments), std::end(assignments));
+  return parameter_value_set;
+}
+
+TEST(ParameterValueDistribution, DistributionSet)
+{
+  const auto parameter_value_sets = parameterValueSets(R"(
+    <Deterministic>
+      <DeterministicSingleParameterDistribution parameterName="stop">
+        <DistributionSet>
+          <Element value="1"/>
+          <Element value="2"/>
+          <Element value="3"/>
+        </DistributionSet>
+      </DeterministicSingleParameterDistribution>
+    </Deterministic>)");
+
+  EXPECT_EQ(
+    parameter_value_sets,
+    (std::vector<ParameterValueSet>{
+      makeParameterValueSet({{"stop", "1"}}), makeParameterValueSet({{"stop", "2"}}),
+      makeParameterValueSet({{"stop", "3"}})}));
+}
+
+TEST(ParameterValueDistribution, DistributionRange)
+{
+  const auto parameter_value_sets = parameterValueSets(R"(
+    <Deterministic>
+      <DeterministicSingleParameterDistribution parameterName="stop">
+        <DistributionRange stepWidth="0.1">
+          <Range lowerLimit="1" upperLimit="2"/>
+        </DistributionRange>
+      </DeterministicSingleParameterDistribution>
+    </Deterministic>)");
+
+  const auto stops = values(parameter_value_sets, "stop");
+
+  ASSERT_EQ(stops.size(), 11U);  // NOTE: Both limits are included.
+  EXPECT_DOUBLE_EQ(stops.front(), 1.0);
+  EXPECT_NEAR(stops.back(), 2.0, 1e-9);
+}
+
+TEST(ParameterValueDistribution, DistributionRangeWithoutPositiveStepWidth)
+{
+  constexpr auto distribution_definition = R"(
+    <Deterministic>
+      <DeterministicSingleParameterDistribution parameterName="stop">
+        <DistributionRange stepWidth="0">
+          <Range lowerLimit="1" upperLimit="2"/>
+        </DistributionRange>
+      </DeterministicSingleParameterDistribution>
+    </Deterministic>)";
+
+  EXPECT_THROW(parameterValueSets(distribution_definition), SyntaxError);
+}
+
+TEST(ParameterValueDistribution, ValueSetDistribution)
+{
+  const auto parameter_value_sets = parameterValueSets(R"(
+    <Deterministic>
+      <DeterministicMultiParameterDistribution>
+        <ValueSetDistribution>
+          <ParameterValueSet>
+            <ParameterAssignment parameterRef="start" value="0"/>
+            <ParameterAssignment parameterRef="stop" value="1"/>
+          </ParameterValueSet>
+          <ParameterValueSet>
+            <ParameterAssignment parameterRef="start" value="2"/>
+            <ParameterAssignment parameterRef="stop" value="3"/>
+          </ParameterValueSet>
+        </ValueSetDistribution>
+      </DeterministicMultiParameterDistribution>
+    </Deterministic>)");
+
+  EXPECT_EQ(
+    parameter_value_sets,
+    (std::vector<ParameterValueSet>{
+      makeParameterValueSet({{"start", "0"}, {"stop", "1"}}),
+      makeParameterValueSet({{"start", "2"}, {"stop", "3"}})}));
+}
+
+TEST(ParameterValueDistribution, DeterministicCombinations)
+{
+  const auto parameter_value_sets = parameterValueSets(R"(
+    <Deterministic>
+      <DeterministicSingleParameterDistribution parameterName="start">
+        <DistributionSet>
+          <Element value="0"/>
+          <Element value="1"/>
+        </DistributionSet>
+      </DeterministicSingleParameterDistribution>
+      <DeterministicSingleParameterDistribution parameterName="stop">
+        <DistributionRange stepWidth="1">
+          <Range lowerLimit="2" upperLimit="4"/>
+        </DistributionRange>
+      </DeterministicSingleParameterDistribution>
+    </Deterministic>)");
+
+  // NOTE: Every combination, with the last distribution varying fastest.
+  EXPECT_EQ(
+    parameter_value_sets,
+    (std::vector<ParameterValueSet>{
+      makeParameterValueSet({{"start", "0"}, {"stop", "2"}}),
+      makeParameterValueSet({{"start", "0"}, {"stop", "3"}}),
+      makeParameterValueSet({{"start", "0"}, {"stop", "4"}}),
+      makeParameterValueSet({{"start", "1"}, {"stop", "2"}}),
+      makeParameterValueSet({{"start", "1"}, {"stop", "3"}}),
+      makeParameterValueSet({{"start", "1"}, {"stop", "4"}})}));
+}
+
+auto stochastic(const std::string & seed, const std::string & stochastic_distributions)
+{
+  return parameterValueSets(
+    R"(<Stochastic numberOfTestRuns="100" )" + seed + ">" + stochastic_distributions +
+    "</Stochastic>");
+}
+
+TEST(ParameterValueDistribution, ProbabilityDistributionSet)
+{
+  const auto parameter_value_sets = stochastic(R"(randomSeed="1")", R"(
+    <StochasticDistribution parameterName="stop">
+      <ProbabilityDistributionSet>
+        <Element value="1" weight="1"/>
+        <Element value="2" weight="0"/>
+        <Element value="3" weight="3"/>
+      </ProbabilityDistributionSet>
+    </StochasticDistribution>)");
+
+  ASSERT_EQ(parameter_value_sets.size(), 100U);
+  for (const auto stop : values(parameter_value_sets, "stop")) {
+    EXPECT_TRUE(stop == 1 or stop == 3) << stop;
+  }
+}
+
+TEST(ParameterValueDistribution, NormalDistribution)
+{
+  const auto parameter_value_sets = stochastic(R"(randomSeed="1")", R"(
+    <StochasticDistribution parameterName="stop">
+      <NormalDistribution expectedValue="2" variance="100">
+        <Range lowerLimit="1" upperLimit="3"/>
+      </NormalDistribution>
+    </StochasticDistribution>)");
+
+  ASSERT_EQ(parameter_value_sets.size(), 100U);
+  for (const auto stop : values(parameter_value_sets, "stop")) {
+    EXPECT_LE(1.0, stop);
+    EXPECT_LE(stop, 3.0);
+  }
+}
+
+TEST(ParameterValueDistribution, UniformDistribution)
+{
+  const auto parameter_value_sets = stochastic(R"(randomSeed="1")", R"(
+    <StochasticDistribution parameterName="stop">
+      <UniformDistribution>
+        <Range lowerLimit="1" upperLimit="3"/>
+      </UniformDistribution>
+    </StochasticDistribution>)");
+
+  ASSERT_EQ(parameter_value_sets.size(), 100U);
+  for (const auto stop : values(parameter_value_sets, "stop")) {
+    EXPECT_LE(1.0, stop);
+    EXPECT_LE(stop, 3.0);
+  }
+}
+
+TEST(ParameterValueDistribution, PoissonDistribution)
+{
+  const auto parameter_value_sets = stochastic(R"(randomSeed="1")", R"(
+    <StochasticDistribution parameterName="stop">
+      <PoissonDistribution expectedValue="2">
+        <Range lowerLimit="1" upperLimit="3"/>
+      </PoissonDistribution>
+    </StochasticDistribution>)");
+
+  ASSERT_EQ(parameter_value_sets.size(), 100U);
+  for (const auto stop : values(parameter_value_sets, "stop")) {
+    EXPECT_TRUE(stop == 1 or stop == 2 or stop == 3) << stop;
+  }
+}
+
+TEST(ParameterValueDistribution, Histogram)
+{
+  const auto parameter_value_sets = stochastic(R"(randomSeed="1")", R"(
+    <StochasticDistribution parameterName="stop">
+      <Histogram>
+        <Bin weight="1">
+          <Range lowerLimit="1" upperLimit="2"/>
+        </Bin>
+        <Bin weight="0">
+          <Range lowerLimit="5" upperLimit="6"/>
+        </Bin>
+      </Histogram>
+    </StochasticDistribution>)");
+
+  ASSERT_EQ(parameter_value_sets.size(), 100U);
+  for (const auto stop : values(parameter_value_sets, "stop")) {
+    EXPECT_LE(1.0, stop);
+    EXPECT_LE(stop, 2.0);
+  }
+}
+
+TEST(ParameterValueDistribution, RandomSeed)
+{
+  constexpr auto distributions = R"(
+    <StochasticDistribution parameterName="start">
+      <UniformDistribution>
+        <Range lowerLimit="0" upperLimit="1"/>
+      </UniformDistribution>
+    </StochasticDistribution>
+    <StochasticDistribution parameterName="stop">
+      <NormalDistribution expectedValue="2" variance="1"/>
+    </StochasticDistribution>)";
+
+  const auto parameter_value_sets = stochastic(R"(randomSeed="42")", distributions);
+
+  ASSERT_EQ(parameter_value_sets.size(), 100U);
+  for (const auto & parameter_value_set : parameter_value_sets) {
+    ASSERT_EQ(parameter_value_set.size(), 2U);
+    EXPECT_EQ(parameter_value_set[0].first, "start");
+    EXPECT_EQ(parameter_value_set[1].first, "stop");
+  }
+
+  EXPECT_EQ(stochastic(R"(randomSeed="42")", distributions), parameter_value_sets);
+  EXPECT_NE(stochastic(R"(randomSeed="43")", distributions), parameter_value_sets);
+}
+
+TEST(ParameterValueDistribution, Instantiate)
+{
+  const auto script = load(R"(
+    <Deterministic>
+      <DeterministicSingleParameterDistribution parameterName="stop">
+        <DistributionSet>
+          <Element value="2"/>
+          <Element value="3"/>
+        </DistributionSet>
+      </DeterministicSingleParameterDistribution>
+    </Deterministic>)");
+
+  const auto & definition = script->category.as<ParameterValueDistributionDefinition>();
+
+  ASSERT_EQ(definition.parameter_value_sets.size(), 2U);
+
+  for (const auto & parameter_value_set : definition.parameter_value_sets) {
+    const auto variant = definition.instantiate(parameter_value_set);
+    const auto parameter_declarations =
+      variant->script.child("OpenSCENARIO").child("ParameterDeclarations");
+    EXPECT_EQ(
+      String(parameter_declarations.find_child_by_attribute("ParameterDeclaration", "name", "stop")
+               .attribute("value")
+               .value()),
+      parameter_value_set.front().second);
+    EXPECT_EQ(
+      String(parameter_declarations.find_child_by_attribute("ParameterDeclaration", "name", "start")
+               .attribute("value")
+               .value()),
+      "0");
+  }
+
+  EXPECT_THROW(
+    definition.instantiate(makeParameterValueSet({{"undeclared", "0"}})), SemanticError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,307 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <openscenario_interpreter/utility/yaml.hpp>
+#include <pugixml.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/* ---- NOTE -------------------------------------------------------------------
+ *
+ *  Each expected document is what openscenario_utility's conversion.py made
+ *  of the YAML above it. conversion.py reorders elements to the order of the
+ *  schema, and loadYAML does not, so documents are compared with the
+ *  children of each element stably sorted by name. The order of elements of
+ *  the same name is compared as is.
+ *
+ * -------------------------------------------------------------------------- */
+auto canonical(const pugi::xml_node & node) -> std::string
+{
+  std::stringstream result;
+
+  result << "<" << node.name();
+  std::map<std::string, std::string> attributes;
+  for (const auto & attribute : node.attributes()) {
+    attributes.emplace(attribute.name(), attribute.value());
+  }
+  for (const auto & [name, value] : attributes) {
+    result << " " << name << "=" << std::quoted(value);
+  }
+  result << ">" << node.child_value() << "\n";
+
+  std::vector<pugi::xml_node> children;
+  for (const auto & child : node.children()) {
+    if (child.type() == pugi::node_element) {
+      children.push_back(child);
+    }
+  }
+  std::stable_sort(std::begin(children), std::end(children), [](auto && a, auto && b) {
+    return std::string(a.name()) < std::string(b.name());
+  });
+  for (const auto & child : children) {
+    result << canonical(child);
+  }
+
+  result << "</" << node.name() << ">\n";
+
+  return result.str();
+}
+
+auto loadYAML(const std::string & yaml)
+{
+  const auto path = boost::filesystem::temp_directory_path() /
+                    boost::filesystem::unique_path("test_yaml-%%%%-%%%%.yaml");
+  std::ofstream(path.string()) << yaml;
+  pugi::xml_document document;
+  openscenario_interpreter::loadYAML(path, document);
+  boost::filesystem::remove(path);
+  return canonical(document.document_element());
+}
+
+auto loadXML(const std::string & xml)
+{
+  pugi::xml_document document;
+  document.load_string(xml.c_str());
+  return canonical(document.document_element());
+}
+
+TEST(YAML, Catalog)
+{
+  const auto yaml = R"(OpenSCENARIO:
+  FileHeader:
+    revMajor: 1
+    revMinor: 0
+    date: "2021-06-21T07:36:35.584Z"
+    description: ""
+    author: ""
+  Catalog:
+    name: all-in-one-vehicle
+    Vehicle:
+      - name: ego-vehicle
+        vehicleCategory: car
+        BoundingBox:
+          Center:
+            x: 1.355
+            y: 0
+            z: 1.25
+          Dimensions:
+            width: 2.25
+            length: 4.77
+            height: 2.5
+        Performance:
+          maxSpeed: $maxSpeed
+          maxAcceleration: INF
+          maxDeceleration: INF
+        Axles:
+          FrontAxle:
+            maxSteering: 0.5236
+            wheelDiameter: 0.78
+            trackWidth: 1.63
+            positionX: 1.385
+            positionZ: 0.39
+          RearAxle:
+            maxSteering: 0.5236
+            wheelDiameter: 0.78
+            trackWidth: 1.63
+            positionX: -1.355
+            positionZ: 0.39
+        Properties:
+          Property: []
+      - name: default-vehicle
+        vehicleCategory: car
+        BoundingBox:
+          Center:
+            x: 0
+            y: 0
+            z: 1.25
+          Dimensions:
+            width: 1.8
+            length: 4
+            height: 2.5
+        Performance:
+          maxSpeed: 50
+          maxAcceleration: INF
+          maxDeceleration: INF
+        Axles:
+          FrontAxle:
+            maxSteering: 0.5236
+            wheelDiameter: 0.6
+            trackWidth: 1.8
+            positionX: 2
+            positionZ: 0.3
+          RearAxle:
+            maxSteering: 0.5236
+            wheelDiameter: 0.6
+            trackWidth: 1.8
+            positionX: 0
+            positionZ: 0.3
+        Properties:
+          Property: []
+)";
+
+  const auto xml = R"(<OpenSCENARIO>
+  <FileHeader revMajor="1" revMinor="0" date="2021-06-21T07:36:35.584Z" description="" author="" />
+  <Catalog name="all-in-one-vehicle">
+    <Vehicle name="ego-vehicle" vehicleCategory="car">
+      <BoundingBox>
+        <Center x="1.355" y="0" z="1.25" />
+        <Dimensions width="2.25" length="4.77" height="2.5" />
+      </BoundingBox>
+      <Performance maxSpeed="$maxSpeed" maxAcceleration="INF" maxDeceleration="INF" />
+      <Axles>
+        <FrontAxle maxSteering="0.5236"
+          wheelDiameter="0.78"
+          trackWidth="1.63"
+          positionX="1.385"
+          positionZ="0.39" />
+        <RearAxle maxSteering="0.5236"
+          wheelDiameter="0.78"
+          trackWidth="1.63"
+          positionX="-1.355"
+          positionZ="0.39" />
+      </Axles>
+      <Properties />
+    </Vehicle>
+    <Vehicle name="default-vehicle" vehicleCategory="car">
+      <BoundingBox>
+        <Center x="0" y="0" z="1.25" />
+        <Dimensions width="1.8" length="4" height="2.5" />
+      </BoundingBox>
+      <Performance maxSpeed="50" maxAcceleration="INF" maxDeceleration="INF" />
+      <Axles>
+        <FrontAxle maxSteering="0.5236"
+          wheelDiameter="0.6"
+          trackWidth="1.8"
+          positionX="2"
+          positionZ="0.3" />
+        <RearAxle maxSteering="0.5236"
+          wheelDiameter="0.6"
+          trackWidth="1.8"
+          positionX="0"
+          positionZ="0.3" />
+      </Axles>
+      <Properties />
+    </Vehicle>
+  </Catalog>
+</OpenSCENARIO>
+)";
+
+  EXPECT_EQ(loadYAML(yaml), loadXML(xml));
+}
+
+TEST(YAML, Scalars)
+{
+  const auto yaml = R"(ScenarioModifiers:
+  ScenarioModifier:
+    - name: SPEED
+      list: [1, 2]
+OpenSCENARIO:
+  FileHeader:
+    revMajor: 1
+    revMinor: 0
+    date: '2021-06-21T07:36:35.584Z'
+    description: "True to the original, False otherwise"
+    author: ''
+  ParameterDeclarations:
+    ParameterDeclaration:
+      - {name: a, parameterType: boolean, value: yes}
+      - {name: b, parameterType: boolean, value: Off}
+      - {name: c, parameterType: boolean, value: TRUE}
+      - {name: d, parameterType: boolean, value: 'TRUE'}
+      - {name: e, parameterType: integer, value: 010}
+      - {name: f, parameterType: integer, value: 0x1F}
+      - {name: g, parameterType: integer, value: -1_000}
+      - {name: h, parameterType: integer, value: 1:30}
+      - {name: i, parameterType: double, value: 0.10}
+      - {name: j, parameterType: double, value: 1.0e+3}
+      - {name: k, parameterType: double, value: -.inf}
+      - {name: l, parameterType: double, value: 1e3}
+      - {name: m, parameterType: double, value: 1.0e+20}
+      - {name: n, parameterType: double, value: 0.00001}
+      - {name: o, parameterType: string, value: ~}
+      - {name: p, parameterType: string, value: '010'}
+      - {name: q, parameterType: double, value: .5}
+      - {name: r, parameterType: double, value: -0.0}
+      - {name: s, parameterType: double, value: 123456789.123456789}
+  Empty: []
+  Text: some text
+  Number: 42
+  Nothing:
+  Base: &base
+    x: 1
+    y: 2
+    Child: {z: 3}
+  Merged:
+    <<: *base
+    y: 20
+  MergedSequence:
+    <<: [{x: first}, {x: second, w: second}]
+    v: 0
+)";
+
+  const auto xml = R"(<OpenSCENARIO>
+  <FileHeader revMajor="1"
+    revMinor="0"
+    date="2021-06-21T07:36:35.584Z"
+    description="true to the original, false otherwise"
+    author="" />
+  <ParameterDeclarations>
+    <ParameterDeclaration name="a" parameterType="boolean" value="true" />
+    <ParameterDeclaration name="b" parameterType="boolean" value="false" />
+    <ParameterDeclaration name="c" parameterType="boolean" value="true" />
+    <ParameterDeclaration name="d" parameterType="boolean" value="TRUE" />
+    <ParameterDeclaration name="e" parameterType="integer" value="8" />
+    <ParameterDeclaration name="f" parameterType="integer" value="31" />
+    <ParameterDeclaration name="g" parameterType="integer" value="-1000" />
+    <ParameterDeclaration name="h" parameterType="integer" value="90" />
+    <ParameterDeclaration name="i" parameterType="double" value="0.1" />
+    <ParameterDeclaration name="j" parameterType="double" value="1000.0" />
+    <ParameterDeclaration name="k" parameterType="double" value="-inf" />
+    <ParameterDeclaration name="l" parameterType="double" value="1e3" />
+    <ParameterDeclaration name="m" parameterType="double" value="1e+20" />
+    <ParameterDeclaration name="n" parameterType="double" value="1e-05" />
+    <ParameterDeclaration name="o" parameterType="string" value="None" />
+    <ParameterDeclaration name="p" parameterType="string" value="010" />
+    <ParameterDeclaration name="q" parameterType="double" value="0.5" />
+    <ParameterDeclaration name="r" parameterType="double" value="-0.0" />
+    <ParameterDeclaration name="s" parameterType="double" value="123456789.12345679" />
+  </ParameterDeclarations>
+  <Text>some text</Text>
+  <Number />
+  <Nothing />
+  <Base x="1" y="2">
+    <Child z="3" />
+  </Base>
+  <Merged x="1" y="20">
+    <Child z="3" />
+  </Merged>
+  <MergedSequence x="first" w="second" v="0" />
+</OpenSCENARIO>
+)";
+
+  EXPECT_EQ(loadYAML(yaml), loadXML(xml));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -20,9 +20,11 @@
 #endif
 
 #include <mutex>
+#include <nlohmann/json.hpp>
 #include <openscenario_interpreter_msgs/msg/context.hpp>
 #include <openscenario_visualization/context_panel_plugin.hpp>
 #include <rviz_common/panel.hpp>
+#include <std_srvs/srv/trigger.hpp>
 #include <string>
 #include <thread>
 #include <vector>
@@ -62,10 +64,12 @@ private:
   std::mutex topic_candidates_mutex_;
   bool selected_ = false;
   rclcpp::Subscription<openscenario_interpreter_msgs::msg::Context>::SharedPtr context_sub_;
+  rclcpp::Client<std_srvs::srv::Trigger>::SharedPtr snapshot_client_;
+  void requestSnapshot();
   void startSubscription();
   void contextCallback(const openscenario_interpreter_msgs::msg::Context::SharedPtr msg);
   void spin();
-  std::string context_;
+  nlohmann::json context_;
   double simulation_time_;
   std::vector<std::string> item_vec_;
   std::vector<std::vector<std::string>> condition_group_vec_;
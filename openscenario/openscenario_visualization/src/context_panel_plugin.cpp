@@ -53,9 +53,22 @@ void ContextPanel::onDisable()
 
 void ContextPanel::contextCallback(const openscenario_interpreter_msgs::msg::Context::SharedPtr msg)
 {
-  context_ = msg->data;
+  if (msg->type == openscenario_interpreter_msgs::msg::Context::SNAPSHOT) {
+    context_ = json::parse(msg->data);
+  } else if (context_.is_null()) {
+    requestSnapshot();  // patches are meaningless without the context they are based on
+    return;
+  } else {
+    try {
+      context_ = context_.patch(json::parse(msg->data));
+    } catch (const json::exception &) {
+      context_ = nullptr;  // a patch was lost; wait for a new snapshot
+      requestSnapshot();
+      return;
+    }
+  }
   simulation_time_ = msg->time;
-  json j_ = json::parse(context_);
+  json j_ = context_;
   condition_group_vec_.clear();
   item_vec_.clear();
   auto story_json = j_["OpenSCENARIO"]["Storyboard"]["Story"];
@@ -188,8 +201,17 @@ void ContextPanel::spin()
 void ContextPanel::startSubscription()
 {
   std::string topic = ui_->TopicSelect->currentText().toStdString();
+  context_ = nullptr;
   context_sub_ = node_->create_subscription<openscenario_interpreter_msgs::msg::Context>(
-    topic, 1, std::bind(&ContextPanel::contextCallback, this, std::placeholders::_1));
+    topic, 10, std::bind(&ContextPanel::contextCallback, this, std::placeholders::_1));
+  snapshot_client_ = node_->create_client<std_srvs::srv::Trigger>(topic + "/request_snapshot");
+}
+
+void ContextPanel::requestSnapshot()
+{
+  if (snapshot_client_->service_is_ready()) {
+    snapshot_client_->async_send_request(std::make_shared<std_srvs::srv::Trigger::Request>());
+  }
 }
 
 void ContextPanel::selectTopic(int)
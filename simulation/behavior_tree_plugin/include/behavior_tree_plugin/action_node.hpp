@@ -17,7 +17,9 @@
 
 #include <behaviortree_cpp_v3/action_node.h>
 
+#include <any>
 #include <boost/algorithm/clamp.hpp>
+#include <boost/optional.hpp>
 #include <memory>
 #include <string>
 #include <traffic_simulator/data_type/data_types.hpp>
@@ -68,6 +70,13 @@ public:
 
   void halt() override final { setStatus(BT::NodeStatus::IDLE); }
 
+  /// state of the derived class that survives between ticks, for world snapshots.
+  virtual std::any makeSnapshot() const { return {}; }
+  virtual void restore(const std::any &) {}
+
+  /// while set, executeTick returns the given status without ticking.
+  void replay(const boost::optional<BT::NodeStatus> & status) { replayed_status_ = status; }
+
   static BT::PortsList providedPorts()
   {
     return {
@@ -109,6 +118,9 @@ public:
     double length_extension_rear = 0.0);
 
 private:
+  boost::optional<BT::NodeStatus> replayed_status_;
+  const char * profile_name_ = nullptr;  // interned registration name, for PROFILE_SCOPE.
+  const char * getProfileName();
   boost::optional<double> getDistanceToTargetEntityOnCrosswalk(
     const traffic_simulator::math::CatmullRomSplineInterface & spline,
     const traffic_simulator_msgs::msg::EntityStatus & status);
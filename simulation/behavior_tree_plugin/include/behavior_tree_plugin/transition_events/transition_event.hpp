@@ -20,6 +20,7 @@
 #include <functional>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
+#include <string>
 
 namespace behavior_tree_plugin
 {
@@ -27,6 +28,7 @@ class TransitionEvent
 {
 public:
   TransitionEvent(BT::TreeNode * root_node);
+  void setCurrentAction(const std::string & current_action) { current_action_ = current_action; }
 
 protected:
   virtual void callback(
@@ -0,0 +1,49 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BEHAVIOR_TREE_PLUGIN__TREE_SNAPSHOT_HPP_
+#define BEHAVIOR_TREE_PLUGIN__TREE_SNAPSHOT_HPP_
+
+#include <behaviortree_cpp_v3/bt_factory.h>
+
+#include <any>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace behavior_tree_plugin
+{
+/**
+ * @brief state of a behavior tree between two ticks.
+ * @note node statuses and action states are stored in the order of BT::applyRecursiveVisitor.
+ */
+struct TreeSnapshot
+{
+  std::unordered_map<std::string, BT::Any> blackboard;
+  std::vector<BT::NodeStatus> statuses;
+  std::vector<std::any> actions;
+  std::string current_action;
+};
+
+TreeSnapshot makeTreeSnapshot(BT::Tree & tree, const std::string & current_action);
+
+/**
+ * @brief rewind the tree to the snapshot.
+ * @note control nodes keep the index of their running child privately, so the snapshot is
+ *       replayed through the tree once instead of being assigned.
+ */
+void restoreTreeSnapshot(BT::Tree & tree, const TreeSnapshot & snapshot);
+}  // namespace behavior_tree_plugin
+
+#endif  // BEHAVIOR_TREE_PLUGIN__TREE_SNAPSHOT_HPP_
@@ -19,6 +19,7 @@
 #include <behaviortree_cpp_v3/loggers/bt_cout_logger.h>
 
 #include <behavior_tree_plugin/transition_events/transition_events.hpp>
+#include <behavior_tree_plugin/tree_snapshot.hpp>
 #include <functional>
 #include <geometry_msgs/msg/point.hpp>
 #include <map>
@@ -40,6 +41,8 @@ public:
   void update(double current_time, double step_time) override;
   void configure(const rclcpp::Logger & logger) override;
   const std::string & getCurrentAction() const override;
+  std::any makeSnapshot() override;
+  void restore(const std::any & snapshot) override;
 #define DEFINE_GETTER_SETTER(NAME, TYPE)                                                    \
   TYPE get##NAME() override { return tree_.rootBlackboard()->get<TYPE>(get##NAME##Key()); } \
   void set##NAME(const TYPE & value) override                                               \
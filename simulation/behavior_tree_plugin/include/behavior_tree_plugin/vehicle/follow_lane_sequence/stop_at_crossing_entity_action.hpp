@@ -44,6 +44,11 @@ public:
   const traffic_simulator_msgs::msg::WaypointsArray calculateWaypoints() override;
   const boost::optional<traffic_simulator_msgs::msg::Obstacle> calculateObstacle(
     const traffic_simulator_msgs::msg::WaypointsArray & waypoints) override;
+  std::any makeSnapshot() const override { return in_stop_sequence_; }
+  void restore(const std::any & snapshot) override
+  {
+    in_stop_sequence_ = std::any_cast<bool>(snapshot);
+  }
 
 private:
   boost::optional<double> distance_to_stop_target_;
@@ -44,6 +44,8 @@ public:
   const traffic_simulator_msgs::msg::WaypointsArray calculateWaypoints() override;
   const boost::optional<traffic_simulator_msgs::msg::Obstacle> calculateObstacle(
     const traffic_simulator_msgs::msg::WaypointsArray & waypoints) override;
+  std::any makeSnapshot() const override { return stopped_; }
+  void restore(const std::any & snapshot) override { stopped_ = std::any_cast<bool>(snapshot); }
 
 private:
   bool stopped_;
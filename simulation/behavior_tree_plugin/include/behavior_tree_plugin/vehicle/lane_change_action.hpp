@@ -49,8 +49,18 @@ public:
   const boost::optional<traffic_simulator_msgs::msg::Obstacle> calculateObstacle(
     const traffic_simulator_msgs::msg::WaypointsArray & waypoints) override;
   void getBlackBoardValues();
+  std::any makeSnapshot() const override;
+  void restore(const std::any & snapshot) override;
 
 private:
+  struct Snapshot
+  {
+    boost::optional<traffic_simulator::math::HermiteCurve> curve;
+    double current_s;
+    double target_s;
+    double lane_change_velocity;
+    boost::optional<traffic_simulator::lane_change::Parameter> lane_change_parameters;
+  };
   boost::optional<traffic_simulator::math::HermiteCurve> curve_;
   double current_s_;
   double target_s_;
@@ -20,6 +20,7 @@
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
 #include <set>
+#include <simple_profiler/profiler.hpp>
 #include <string>
 #include <traffic_simulator/math/bounding_box.hpp>
 #include <unordered_map>
@@ -33,7 +34,23 @@ ActionNode::ActionNode(const std::string & name, const BT::NodeConfiguration & c
 {
 }
 
-BT::NodeStatus ActionNode::executeTick() { return BT::ActionNodeBase::executeTick(); }
+BT::NodeStatus ActionNode::executeTick()
+{
+  if (replayed_status_) {
+    setStatus(replayed_status_.get());
+    return replayed_status_.get();
+  }
+  PROFILE_SCOPE(getProfileName());
+  return BT::ActionNodeBase::executeTick();
+}
+
+const char * ActionNode::getProfileName()
+{
+  if (!profile_name_) {
+    profile_name_ = common::profiler::intern("ActionNode::executeTick(" + registrationName() + ")");
+  }
+  return profile_name_;
+}
 
 void ActionNode::getBlackBoardValues()
 {
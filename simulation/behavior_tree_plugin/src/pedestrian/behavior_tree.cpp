@@ -42,6 +42,19 @@ const std::string & PedestrianBehaviorTree::getCurrentAction() const
   return logging_event_ptr_->getCurrentAction();
 }
 
+std::any PedestrianBehaviorTree::makeSnapshot()
+{
+  return behavior_tree_plugin::makeTreeSnapshot(tree_, getCurrentAction());
+}
+
+void PedestrianBehaviorTree::restore(const std::any & snapshot)
+{
+  const auto & tree_snapshot = std::any_cast<const behavior_tree_plugin::TreeSnapshot &>(snapshot);
+  behavior_tree_plugin::restoreTreeSnapshot(tree_, tree_snapshot);
+  logging_event_ptr_->setCurrentAction(tree_snapshot.current_action);
+  reset_request_event_ptr_->setCurrentAction(tree_snapshot.current_action);
+}
+
 void PedestrianBehaviorTree::update(double current_time, double step_time)
 {
   tickOnce(current_time, step_time);
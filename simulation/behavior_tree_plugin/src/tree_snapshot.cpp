@@ -0,0 +1,82 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <behavior_tree_plugin/action_node.hpp>
+#include <behavior_tree_plugin/tree_snapshot.hpp>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <vector>
+
+namespace behavior_tree_plugin
+{
+TreeSnapshot makeTreeSnapshot(BT::Tree & tree, const std::string & current_action)
+{
+  TreeSnapshot snapshot;
+  for (const auto & key : tree.rootBlackboard()->getKeys()) {
+    const std::string name(key.data(), key.size());
+    if (const auto value = tree.rootBlackboard()->getAny(name)) {
+      snapshot.blackboard.emplace(name, *value);
+    }
+  }
+  BT::applyRecursiveVisitor(tree.rootNode(), [&](BT::TreeNode * node) {
+    snapshot.statuses.push_back(node->status());
+    if (const auto action = dynamic_cast<entity_behavior::ActionNode *>(node)) {
+      snapshot.actions.push_back(action->makeSnapshot());
+    } else {
+      snapshot.actions.emplace_back();
+    }
+  });
+  snapshot.current_action = current_action;
+  return snapshot;
+}
+
+void restoreTreeSnapshot(BT::Tree & tree, const TreeSnapshot & snapshot)
+{
+  std::vector<BT::TreeNode *> nodes;
+  BT::applyRecursiveVisitor(tree.rootNode(), [&](BT::TreeNode * node) { nodes.push_back(node); });
+  if (nodes.size() != snapshot.statuses.size()) {
+    THROW_SIMULATION_ERROR("Snapshot does not match the structure of the behavior tree.");
+  }
+
+  tree.haltTree();
+
+  if (snapshot.statuses.front() == BT::NodeStatus::RUNNING) {
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+      if (const auto action = dynamic_cast<entity_behavior::ActionNode *>(nodes[i])) {
+        action->replay(
+          snapshot.statuses[i] == BT::NodeStatus::IDLE ? BT::NodeStatus::FAILURE
+                                                       : snapshot.statuses[i]);
+      }
+    }
+    tree.rootNode()->executeTick();
+    for (const auto node : nodes) {
+      if (const auto action = dynamic_cast<entity_behavior::ActionNode *>(node)) {
+        action->replay(boost::none);
+      }
+    }
+  }
+
+  for (std::size_t i = 0; i < nodes.size(); ++i) {
+    if (const auto action = dynamic_cast<entity_behavior::ActionNode *>(nodes[i])) {
+      action->restore(snapshot.actions[i]);
+    }
+  }
+
+  for (const auto & [key, value] : snapshot.blackboard) {
+    if (const auto entry = tree.rootBlackboard()->getAny(key)) {
+      *entry = value;
+    }
+  }
+}
+}  // namespace behavior_tree_plugin
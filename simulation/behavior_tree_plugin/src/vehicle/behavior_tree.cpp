@@ -66,6 +66,19 @@ const std::string & VehicleBehaviorTree::getCurrentAction() const
   return logging_event_ptr_->getCurrentAction();
 }
 
+std::any VehicleBehaviorTree::makeSnapshot()
+{
+  return behavior_tree_plugin::makeTreeSnapshot(tree_, getCurrentAction());
+}
+
+void VehicleBehaviorTree::restore(const std::any & snapshot)
+{
+  const auto & tree_snapshot = std::any_cast<const behavior_tree_plugin::TreeSnapshot &>(snapshot);
+  behavior_tree_plugin::restoreTreeSnapshot(tree_, tree_snapshot);
+  logging_event_ptr_->setCurrentAction(tree_snapshot.current_action);
+  reset_request_event_ptr_->setCurrentAction(tree_snapshot.current_action);
+}
+
 void VehicleBehaviorTree::update(double current_time, double step_time)
 {
   tickOnce(current_time, step_time);
@@ -28,7 +28,10 @@ namespace entity_behavior
 namespace vehicle
 {
 LaneChangeAction::LaneChangeAction(const std::string & name, const BT::NodeConfiguration & config)
-: entity_behavior::VehicleActionNode(name, config), current_s_(0)
+: entity_behavior::VehicleActionNode(name, config),
+  current_s_(0),
+  target_s_(0),
+  lane_change_velocity_(0)
 {
 }
 
@@ -76,6 +79,21 @@ const traffic_simulator_msgs::msg::WaypointsArray LaneChangeAction::calculateWay
   }
 }
 
+std::any LaneChangeAction::makeSnapshot() const
+{
+  return Snapshot{curve_, current_s_, target_s_, lane_change_velocity_, lane_change_parameters_};
+}
+
+void LaneChangeAction::restore(const std::any & snapshot)
+{
+  const auto & lane_change_snapshot = std::any_cast<const Snapshot &>(snapshot);
+  curve_ = lane_change_snapshot.curve;
+  current_s_ = lane_change_snapshot.current_s;
+  target_s_ = lane_change_snapshot.target_s;
+  lane_change_velocity_ = lane_change_snapshot.lane_change_velocity;
+  lane_change_parameters_ = lane_change_snapshot.lane_change_parameters;
+}
+
 void LaneChangeAction::getBlackBoardValues()
 {
   VehicleActionNode::getBlackBoardValues();
@@ -0,0 +1,156 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/api/api.hpp>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/test/catalogs.hpp>
+#include <traffic_simulator/test/fixture.hpp>
+#include <vector>
+
+using traffic_simulator::entity::EntityManager;
+using traffic_simulator::entity::VehicleEntity;
+
+class Snapshot : public testing::Test
+{
+protected:
+  static constexpr double step_time = 0.05;
+
+  const std::shared_ptr<EntityManager> entity_manager =
+    std::make_shared<EntityManager>(makeNode("snapshot"), makeConfiguration());
+
+  double current_time = 0;
+
+  void SetUp() override
+  {
+    spawn("npc0", 10.0, 10.0);
+    spawn("npc1", 40.0, 3.0);
+  }
+
+  void spawn(const std::string & name, const double s, const double target_speed)
+  {
+    entity_manager->spawnEntity<VehicleEntity>(name, getVehicleParameters());
+    entity_manager->setEntityStatus(
+      name, makeSpawnStatus(*entity_manager, s, getVehicleParameters().bounding_box));
+    entity_manager->requestSpeedChange(name, target_speed, true);
+  }
+
+  auto run(const std::size_t steps) -> std::vector<traffic_simulator_msgs::msg::EntityStatus>
+  {
+    std::vector<traffic_simulator_msgs::msg::EntityStatus> trajectory;
+    for (std::size_t i = 0; i < steps; ++i) {
+      entity_manager->update(current_time, step_time);
+      current_time += step_time;
+      for (const auto & name : {"npc0", "npc1"}) {
+        if (entity_manager->entityExists(name)) {
+          trajectory.push_back(*entity_manager->getEntityStatus(name));
+        }
+      }
+    }
+    return trajectory;
+  }
+};
+
+TEST_F(Snapshot, restoredWorldReplaysIdentically)
+{
+  run(40);
+  const auto snapshot = entity_manager->makeSnapshot();
+  const auto time_on_snapshot = current_time;
+  const auto expected = run(100);
+
+  entity_manager->restore(snapshot);
+  current_time = time_on_snapshot;
+  const auto actual = run(100);
+
+  ASSERT_EQ(actual.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(actual[i], expected[i]) << "at frame " << i / 2;
+  }
+}
+
+TEST_F(Snapshot, restoreResurrectsDespawnedEntity)
+{
+  run(40);
+  const auto snapshot = entity_manager->makeSnapshot();
+  const auto time_on_snapshot = current_time;
+  const auto expected = run(100);
+
+  entity_manager->restore(snapshot);
+  current_time = time_on_snapshot;
+  run(20);
+  entity_manager->despawnEntity("npc1");
+  EXPECT_FALSE(entity_manager->entityExists("npc1"));
+
+  entity_manager->restore(snapshot);
+  current_time = time_on_snapshot;
+  EXPECT_TRUE(entity_manager->entityExists("npc1"));
+  EXPECT_EQ(run(100), expected);
+}
+
+/**
+ * @brief API::restore rewinds the simulation clock and the traffic lights, and brings back the ego
+ * entity despawned since the snapshot with its status on the snapshot.
+ */
+TEST(ApiSnapshot, restoreRewindsClockTrafficLightsAndEgo)
+{
+  auto configuration = makeConfiguration();
+  configuration.standalone_mode = true;
+
+  traffic_simulator::API api(makeNode("api_snapshot"), configuration);
+
+  ASSERT_TRUE(api.initialize(1.0, 0.05));
+  ASSERT_TRUE(
+    api.spawn("ego", getVehicleParameters(), traffic_simulator::VehicleBehavior::autoware()));
+  ASSERT_TRUE(api.setEntityStatus(
+    "ego", makeSpawnPose(), traffic_simulator::helper::constructActionStatus(3)));
+  api.getTrafficLight(34802).set("green solidOn circle");
+
+  for (auto frame = 0; frame < 20; ++frame) {
+    ASSERT_TRUE(api.updateFrame());
+  }
+
+  const auto snapshot = api.makeSnapshot();
+  const auto time_on_snapshot = api.getCurrentTime();
+  const auto ego_status_on_snapshot = *api.getEntityStatus("ego");
+
+  api.getTrafficLight(34802).set("red solidOn circle");
+  for (auto frame = 0; frame < 20; ++frame) {
+    ASSERT_TRUE(api.updateFrame());
+  }
+  ASSERT_TRUE(api.despawn("ego"));
+  ASSERT_LT(time_on_snapshot, api.getCurrentTime());
+
+  ASSERT_TRUE(api.restore(snapshot));
+  EXPECT_DOUBLE_EQ(api.getCurrentTime(), time_on_snapshot);
+  EXPECT_TRUE(api.getTrafficLight(34802).contains("green solidOn circle"));
+  EXPECT_FALSE(api.getTrafficLight(34802).contains("red solidOn circle"));
+  ASSERT_TRUE(api.entityExists("ego"));
+  EXPECT_EQ(api.getEntityStatus("ego")->type.type, traffic_simulator_msgs::msg::EntityType::EGO);
+  EXPECT_EQ(*api.getEntityStatus("ego"), ego_status_on_snapshot);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  // NOTE: The ego entity spawned by the test must not launch Autoware.
+  std::vector<const char *> arguments(argv, argv + argc);
+  arguments.insert(arguments.end(), {"--ros-args", "-p", "launch_autoware:=false"});
+  rclcpp::init(arguments.size(), arguments.data());
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,93 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_SENSOR_SIMULATOR__SCENARIO_SIMULATOR_CORE_HPP_
+#define SIMPLE_SENSOR_SIMULATOR__SCENARIO_SIMULATOR_CORE_HPP_
+
+#include <simulation_api_schema.pb.h>
+
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <vector>
+
+namespace simple_sensor_simulator
+{
+class SensorSimulation;
+
+/**
+ * @brief the state and the request handlers of the simple sensor simulator, apart from the
+ * transport.
+ *
+ * ScenarioSimulator serves them over ZeroMQ, and traffic_simulator calls them directly when
+ * Configuration::in_process_simulator is true. Sensors publish through the node given on
+ * construction, which must outlive this object.
+ */
+class ScenarioSimulatorCore
+{
+public:
+  explicit ScenarioSimulatorCore(rclcpp::Node &);
+
+  ~ScenarioSimulatorCore();
+
+  void call(
+    const simulation_api_schema::InitializeRequest & req,
+    simulation_api_schema::InitializeResponse & res);
+  void call(
+    const simulation_api_schema::UpdateFrameRequest & req,
+    simulation_api_schema::UpdateFrameResponse & res);
+  void call(
+    const simulation_api_schema::UpdateSensorFrameRequest & req,
+    simulation_api_schema::UpdateSensorFrameResponse & res);
+  void call(
+    const simulation_api_schema::SpawnVehicleEntityRequest & req,
+    simulation_api_schema::SpawnVehicleEntityResponse & res);
+  void call(
+    const simulation_api_schema::SpawnPedestrianEntityRequest & req,
+    simulation_api_schema::SpawnPedestrianEntityResponse & res);
+  void call(
+    const simulation_api_schema::SpawnMiscObjectEntityRequest & req,
+    simulation_api_schema::SpawnMiscObjectEntityResponse & res);
+  void call(
+    const simulation_api_schema::DespawnEntityRequest & req,
+    simulation_api_schema::DespawnEntityResponse & res);
+  void call(
+    const simulation_api_schema::UpdateEntityStatusRequest & req,
+    simulation_api_schema::UpdateEntityStatusResponse & res);
+  void call(
+    const simulation_api_schema::AttachLidarSensorRequest & req,
+    simulation_api_schema::AttachLidarSensorResponse & res);
+  void call(
+    const simulation_api_schema::AttachDetectionSensorRequest & req,
+    simulation_api_schema::AttachDetectionSensorResponse & res);
+  void call(
+    const simulation_api_schema::UpdateTrafficLightsRequest & req,
+    simulation_api_schema::UpdateTrafficLightsResponse & res);
+
+private:
+  rclcpp::Node & node_;
+  const std::unique_ptr<SensorSimulation> sensor_sim_;
+  std::vector<traffic_simulator_msgs::VehicleParameters> ego_vehicles_;
+  std::vector<traffic_simulator_msgs::VehicleParameters> vehicles_;
+  std::vector<traffic_simulator_msgs::PedestrianParameters> pedestrians_;
+  std::vector<traffic_simulator_msgs::MiscObjectParameters> misc_objects_;
+  double realtime_factor_ = 1.0;
+  double step_time_ = 0.0;
+  double current_time_ = 0.0;
+  rclcpp::Time current_ros_time_;
+  bool initialized_ = false;
+  std::vector<traffic_simulator_msgs::EntityStatus> entity_status_;
+};
+}  // namespace simple_sensor_simulator
+
+#endif  // SIMPLE_SENSOR_SIMULATOR__SCENARIO_SIMULATOR_CORE_HPP_
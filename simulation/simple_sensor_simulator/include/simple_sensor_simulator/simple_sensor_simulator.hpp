@@ -15,22 +15,9 @@
 #ifndef SIMPLE_SENSOR_SIMULATOR__SIMPLE_SENSOR_SIMULATOR_HPP_
 #define SIMPLE_SENSOR_SIMULATOR__SIMPLE_SENSOR_SIMULATOR_HPP_
 
-#include <tf2/LinearMath/Quaternion.h>
-#include <tf2_ros/transform_broadcaster.h>
-
-#include <geometry_msgs/msg/pose_stamped.hpp>
-#include <geometry_msgs/msg/transform_stamped.hpp>
-#include <map>
-#include <memory>
 #include <rclcpp/rclcpp.hpp>
-#include <simple_sensor_simulator/sensor_simulation/lidar/lidar_sensor.hpp>
-#include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
-#include <simple_sensor_simulator/sensor_simulation/sensor_simulation.hpp>
+#include <simple_sensor_simulator/scenario_simulator_core.hpp>
 #include <simulation_interface/zmq_multi_server.hpp>
-#include <string>
-#include <thread>
-#include <vector>
-#include <visualization_msgs/msg/marker_array.hpp>
 
 #if __cplusplus
 extern "C" {
@@ -85,50 +72,7 @@ public:
   ~ScenarioSimulator();
 
 private:
-  SensorSimulation sensor_sim_;
-  void initialize(
-    const simulation_api_schema::InitializeRequest & req,
-    simulation_api_schema::InitializeResponse & res);
-  void updateFrame(
-    const simulation_api_schema::UpdateFrameRequest & req,
-    simulation_api_schema::UpdateFrameResponse & res);
-  void updateEntityStatus(
-    const simulation_api_schema::UpdateEntityStatusRequest & req,
-    simulation_api_schema::UpdateEntityStatusResponse & res);
-  void spawnVehicleEntity(
-    const simulation_api_schema::SpawnVehicleEntityRequest & req,
-    simulation_api_schema::SpawnVehicleEntityResponse & res);
-  void spawnPedestrianEntity(
-    const simulation_api_schema::SpawnPedestrianEntityRequest & req,
-    simulation_api_schema::SpawnPedestrianEntityResponse & res);
-  void spawnMiscObjectEntity(
-    const simulation_api_schema::SpawnMiscObjectEntityRequest &,
-    simulation_api_schema::SpawnMiscObjectEntityResponse &);
-  void despawnEntity(
-    const simulation_api_schema::DespawnEntityRequest & req,
-    simulation_api_schema::DespawnEntityResponse & res);
-  void attachDetectionSensor(
-    const simulation_api_schema::AttachDetectionSensorRequest & req,
-    simulation_api_schema::AttachDetectionSensorResponse & res);
-  void attachLidarSensor(
-    const simulation_api_schema::AttachLidarSensorRequest & req,
-    simulation_api_schema::AttachLidarSensorResponse & res);
-  void updateSensorFrame(
-    const simulation_api_schema::UpdateSensorFrameRequest & req,
-    simulation_api_schema::UpdateSensorFrameResponse & res);
-  void updateTrafficLights(
-    const simulation_api_schema::UpdateTrafficLightsRequest & req,
-    simulation_api_schema::UpdateTrafficLightsResponse & res);
-  std::vector<traffic_simulator_msgs::VehicleParameters> ego_vehicles_;
-  std::vector<traffic_simulator_msgs::VehicleParameters> vehicles_;
-  std::vector<traffic_simulator_msgs::PedestrianParameters> pedestrians_;
-  std::vector<traffic_simulator_msgs::MiscObjectParameters> misc_objects_;
-  double realtime_factor_;
-  double step_time_;
-  double current_time_;
-  rclcpp::Time current_ros_time_;
-  bool initialized_;
-  std::vector<traffic_simulator_msgs::EntityStatus> entity_status_;
+  ScenarioSimulatorCore core_;
   zeromq::MultiServer server_;
 };
 }  // namespace simple_sensor_simulator
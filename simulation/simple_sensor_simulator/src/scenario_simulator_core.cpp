@@ -0,0 +1,199 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <simple_sensor_simulator/exception.hpp>
+#include <simple_sensor_simulator/scenario_simulator_core.hpp>
+#include <simple_sensor_simulator/sensor_simulation/sensor_simulation.hpp>
+#include <simulation_interface/conversions.hpp>
+#include <string>
+#include <vector>
+
+namespace simple_sensor_simulator
+{
+ScenarioSimulatorCore::ScenarioSimulatorCore(rclcpp::Node & node)
+: node_(node), sensor_sim_(std::make_unique<SensorSimulation>())
+{
+}
+
+ScenarioSimulatorCore::~ScenarioSimulatorCore() = default;
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::InitializeRequest & req,
+  simulation_api_schema::InitializeResponse & res)
+{
+  initialized_ = true;
+  realtime_factor_ = req.realtime_factor();
+  step_time_ = req.step_time();
+  res = simulation_api_schema::InitializeResponse();
+  res.mutable_result()->set_success(true);
+  res.mutable_result()->set_description("succeed to initialize simulation");
+  ego_vehicles_ = {};
+  vehicles_ = {};
+  pedestrians_ = {};
+}
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::UpdateFrameRequest & req,
+  simulation_api_schema::UpdateFrameResponse & res)
+{
+  res = simulation_api_schema::UpdateFrameResponse();
+  if (!initialized_) {
+    res.mutable_result()->set_description("simulator have not initialized yet.");
+    res.mutable_result()->set_success(false);
+    return;
+  }
+  current_time_ = req.current_time();
+  builtin_interfaces::msg::Time t;
+  simulation_interface::toMsg(req.current_ros_time(), t);
+  current_ros_time_ = t;
+  res.mutable_result()->set_success(true);
+  res.mutable_result()->set_description("succeed to update frame");
+}
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::UpdateEntityStatusRequest & req,
+  simulation_api_schema::UpdateEntityStatusResponse & res)
+{
+  entity_status_.assign(req.status().begin(), req.status().end());
+  res = simulation_api_schema::UpdateEntityStatusResponse();
+  res.mutable_result()->set_success(true);
+  res.mutable_result()->set_description("");
+}
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::SpawnVehicleEntityRequest & req,
+  simulation_api_schema::SpawnVehicleEntityResponse & res)
+{
+  if (ego_vehicles_.size() != 0 && req.is_ego()) {
+    throw SimulationRuntimeError("multi ego does not support");
+  }
+  if (req.is_ego()) {
+    ego_vehicles_.emplace_back(req.parameters());
+  } else {
+    vehicles_.emplace_back(req.parameters());
+  }
+  res = simulation_api_schema::SpawnVehicleEntityResponse();
+  res.mutable_result()->set_success(true);
+  res.mutable_result()->set_description("");
+}
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::SpawnPedestrianEntityRequest & req,
+  simulation_api_schema::SpawnPedestrianEntityResponse & res)
+{
+  pedestrians_.emplace_back(req.parameters());
+  res = simulation_api_schema::SpawnPedestrianEntityResponse();
+  res.mutable_result()->set_success(true);
+  res.mutable_result()->set_description("");
+}
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::SpawnMiscObjectEntityRequest & req,
+  simulation_api_schema::SpawnMiscObjectEntityResponse & res)
+{
+  misc_objects_.emplace_back(req.parameters());
+  res = simulation_api_schema::SpawnMiscObjectEntityResponse();
+  res.mutable_result()->set_success(true);
+  res.mutable_result()->set_description("");
+}
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::DespawnEntityRequest & req,
+  simulation_api_schema::DespawnEntityResponse & res)
+{
+  bool found = false;
+  res = simulation_api_schema::DespawnEntityResponse();
+  std::vector<traffic_simulator_msgs::VehicleParameters> vehicles;
+  for (const auto vehicle : vehicles_) {
+    if (vehicle.name() != req.name()) {
+      vehicles.emplace_back(vehicle);
+    } else {
+      found = true;
+    }
+  }
+  vehicles_ = vehicles;
+  std::vector<traffic_simulator_msgs::PedestrianParameters> pedestrians;
+  for (const auto pedestrian : pedestrians_) {
+    if (pedestrian.name() != req.name()) {
+      pedestrians.emplace_back(pedestrian);
+    } else {
+      found = true;
+    }
+  }
+  pedestrians_ = pedestrians;
+  std::vector<traffic_simulator_msgs::MiscObjectParameters> misc_objects;
+  for (const auto misc_object : misc_objects_) {
+    if (misc_object.name() != req.name()) {
+      misc_objects.emplace_back(misc_object);
+    } else {
+      found = true;
+    }
+  }
+  misc_objects_ = misc_objects;
+  if (found) {
+    res.mutable_result()->set_success(true);
+  } else {
+    res.mutable_result()->set_success(false);
+  }
+}
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::AttachDetectionSensorRequest & req,
+  simulation_api_schema::AttachDetectionSensorResponse & res)
+{
+  sensor_sim_->attachDetectionSensor(current_time_, req.configuration(), node_);
+  res = simulation_api_schema::AttachDetectionSensorResponse();
+  res.mutable_result()->set_success(true);
+}
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::AttachLidarSensorRequest & req,
+  simulation_api_schema::AttachLidarSensorResponse & res)
+{
+  sensor_sim_->attachLidarSensor(current_time_, req.configuration(), node_);
+  res = simulation_api_schema::AttachLidarSensorResponse();
+  res.mutable_result()->set_success(true);
+}
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::UpdateSensorFrameRequest & req,
+  simulation_api_schema::UpdateSensorFrameResponse & res)
+{
+  constexpr double e = std::numeric_limits<double>::epsilon();
+  if (std::abs(req.current_time() - current_time_) > e) {
+    res.mutable_result()->set_success(false);
+    res.mutable_result()->set_description("timestamp does not match");
+  }
+  builtin_interfaces::msg::Time t;
+  simulation_interface::toMsg(req.current_ros_time(), t);
+  current_ros_time_ = t;
+  sensor_sim_->updateSensorFrame(current_time_, current_ros_time_, entity_status_);
+  res = simulation_api_schema::UpdateSensorFrameResponse();
+  res.mutable_result()->set_success(true);
+}
+
+void ScenarioSimulatorCore::call(
+  const simulation_api_schema::UpdateTrafficLightsRequest & req,
+  simulation_api_schema::UpdateTrafficLightsResponse & res)
+{
+  // TODO: handle traffic lights in simple simulator
+  (void)req;
+  res = simulation_api_schema::UpdateTrafficLightsResponse();
+  res.mutable_result()->set_success(true);
+}
+}  // namespace simple_sensor_simulator
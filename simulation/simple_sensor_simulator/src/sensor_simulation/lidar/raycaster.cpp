@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <iostream>
+#include <simple_profiler/profiler.hpp>
 #include <simple_sensor_simulator/sensor_simulation/lidar/lidar_sensor.hpp>
 #include <simple_sensor_simulator/sensor_simulation/lidar/raycaster.hpp>
 #include <string>
@@ -65,6 +66,7 @@ const sensor_msgs::msg::PointCloud2 Raycaster::raycast(
   std::string frame_id, const rclcpp::Time & stamp, geometry_msgs::msg::Pose origin,
   std::vector<geometry_msgs::msg::Quaternion> directions, double max_distance, double min_distance)
 {
+  PROFILE_SCOPE("simple_sensor_simulator::Raycaster::raycast");
   detected_objects_ = {};
   std::vector<unsigned int> detected_ids = {};
   scene_ = rtcNewScene(device_);
@@ -29,6 +29,10 @@ std::string enumToString(const HostName & hostname);
 
 const TransportProtocol protocol = TransportProtocol::TCP;
 
+/**
+ * @brief MultiServer and MultiClient add a port offset to these, so that several simulators can run
+ * on one host.
+ */
 namespace ports
 {
 const unsigned int initialize = 5555;
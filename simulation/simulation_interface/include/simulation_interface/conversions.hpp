@@ -54,23 +54,23 @@
 
 namespace zeromq
 {
+/**
+ * @brief serialize into the given buffer, whose capacity is reused by the next message.
+ */
 template <typename Proto>
-zmqpp::message toZMQ(const Proto & proto)
+zmqpp::message toZMQ(const Proto & proto, std::string & buffer)
 {
+  proto.SerializeToString(&buffer);
   zmqpp::message msg;
-  std::string serialized_str = "";
-  proto.SerializeToString(&serialized_str);
-  msg << serialized_str;
+  msg.add_raw(buffer.data(), buffer.size());
   return msg;
 }
 
+// NOTE: Parses into the message given, which may be allocated on an arena.
 template <typename Proto>
-Proto toProto(const zmqpp::message & msg)
+bool toProto(const zmqpp::message & msg, Proto & proto)
 {
-  std::string serialized_str = msg.get(0);
-  Proto proto;
-  proto.ParseFromString(serialized_str);
-  return proto;
+  return proto.ParseFromArray(msg.raw_data(0), static_cast<int>(msg.size(0)));
 }
 }  // namespace zeromq
 
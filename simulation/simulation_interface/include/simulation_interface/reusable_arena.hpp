@@ -0,0 +1,63 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMULATION_INTERFACE__REUSABLE_ARENA_HPP_
+#define SIMULATION_INTERFACE__REUSABLE_ARENA_HPP_
+
+#include <google/protobuf/arena.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace simulation_interface
+{
+/**
+ * @brief a protobuf arena for the messages of one request, reset before the next one.
+ *
+ * Its first block is kept across resets, so messages fitting in initial_block_size bytes are
+ * created without heap allocation; larger ones spill into blocks freed on reset. Messages are valid
+ * until the next reset.
+ */
+class ReusableArena
+{
+public:
+  explicit ReusableArena(std::size_t initial_block_size = 1 << 20)
+  : initial_block_(initial_block_size), arena_(makeOptions(initial_block_))
+  {
+  }
+
+  template <typename Message>
+  auto create() -> Message &
+  {
+    return *google::protobuf::Arena::CreateMessage<Message>(&arena_);
+  }
+
+  auto reset() -> void { arena_.Reset(); }
+
+private:
+  static auto makeOptions(std::vector<char> & initial_block) -> google::protobuf::ArenaOptions
+  {
+    google::protobuf::ArenaOptions options;
+    options.initial_block = initial_block.data();
+    options.initial_block_size = initial_block.size();
+    return options;
+  }
+
+  std::vector<char> initial_block_;
+
+  google::protobuf::Arena arena_;
+};
+}  // namespace simulation_interface
+
+#endif  // SIMULATION_INTERFACE__REUSABLE_ARENA_HPP_
@@ -33,7 +33,8 @@ class MultiClient
 {
 public:
   explicit MultiClient(
-    const simulation_interface::TransportProtocol & protocol, const std::string & hostname);
+    const simulation_interface::TransportProtocol & protocol, const std::string & hostname,
+    const unsigned int port_offset = 0);
   ~MultiClient();
 
   void call(
@@ -74,6 +75,9 @@ public:
   const std::string hostname;
 
 private:
+  template <typename Request, typename Response>
+  void exchange(zmqpp::socket & socket, const Request & req, Response & res);
+
   zmqpp::context context_;
   const zmqpp::socket_type type_;
   zmqpp::socket socket_initialize_;
@@ -88,6 +92,8 @@ private:
   zmqpp::socket socket_attach_detection_sensor_;
   zmqpp::socket socket_update_traffic_lights_;
 
+  std::string buffer_;
+
   bool is_running = true;
 };
 }  // namespace zeromq
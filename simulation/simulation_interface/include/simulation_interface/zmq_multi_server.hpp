@@ -21,6 +21,7 @@
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
 #include <simulation_interface/constants.hpp>
+#include <simulation_interface/reusable_arena.hpp>
 #include <string>
 #include <thread>
 #include <zmqpp/zmqpp.hpp>
@@ -76,16 +77,21 @@ public:
     std::function<void(
       const simulation_api_schema::UpdateTrafficLightsRequest &,
       simulation_api_schema::UpdateTrafficLightsResponse &)>
-      update_traffic_lights_func);
+      update_traffic_lights_func,
+    const unsigned int port_offset = 0);
   ~MultiServer();
 
 private:
-  void poll();
+  bool poll();
   void start_poll();
+  template <typename Request, typename Response>
+  void serve(
+    zmqpp::socket & socket, const std::function<void(const Request &, Response &)> & handler);
   std::thread thread_;
   const zmqpp::context context_;
   const zmqpp::socket_type type_;
   zmqpp::poller poller_;
+  zmqpp::socket control_sock_;
   zmqpp::socket initialize_sock_;
   std::function<void(
     const simulation_api_schema::InitializeRequest &, simulation_api_schema::InitializeResponse &)>
@@ -140,6 +146,8 @@ private:
     const simulation_api_schema::UpdateTrafficLightsRequest &,
     simulation_api_schema::UpdateTrafficLightsResponse &)>
     update_traffic_lights_func_;
+  simulation_interface::ReusableArena arena_;
+  std::string buffer_;
 };
 }  // namespace zeromq
 
@@ -13,13 +13,15 @@
 // limitations under the License.
 
 #include <rclcpp/utilities.hpp>
+#include <simple_profiler/profiler.hpp>
 #include <simulation_interface/conversions.hpp>
 #include <simulation_interface/zmq_multi_client.hpp>
 #include <string>
 namespace zeromq
 {
 MultiClient::MultiClient(
-  const simulation_interface::TransportProtocol & protocol, const std::string & hostname)
+  const simulation_interface::TransportProtocol & protocol, const std::string & hostname,
+  const unsigned int port_offset)
 : protocol(protocol),
   hostname(hostname),
   context_(zmqpp::context()),
@@ -36,32 +38,48 @@ MultiClient::MultiClient(
   socket_attach_detection_sensor_(context_, type_),
   socket_update_traffic_lights_(context_, type_)
 {
-  socket_initialize_.connect(
-    simulation_interface::getEndPoint(protocol, hostname, simulation_interface::ports::initialize));
+  socket_initialize_.connect(simulation_interface::getEndPoint(
+    protocol, hostname, simulation_interface::ports::initialize + port_offset));
   socket_update_frame_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_frame));
+    protocol, hostname, simulation_interface::ports::update_frame + port_offset));
   socket_update_sensor_frame_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_sensor_frame));
+    protocol, hostname, simulation_interface::ports::update_sensor_frame + port_offset));
   socket_spawn_vehicle_entity_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_vehicle_entity));
+    protocol, hostname, simulation_interface::ports::spawn_vehicle_entity + port_offset));
   socket_spawn_pedestrian_entity_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_pedestrian_entity));
+    protocol, hostname, simulation_interface::ports::spawn_pedestrian_entity + port_offset));
   socket_spawn_misc_object_entity_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_misc_object_entity));
+    protocol, hostname, simulation_interface::ports::spawn_misc_object_entity + port_offset));
   socket_despawn_entity_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::despawn_entity));
+    protocol, hostname, simulation_interface::ports::despawn_entity + port_offset));
   socket_update_entity_status_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_entity_status));
+    protocol, hostname, simulation_interface::ports::update_entity_status + port_offset));
   socket_attach_lidar_sensor_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::attach_lidar_sensor));
+    protocol, hostname, simulation_interface::ports::attach_lidar_sensor + port_offset));
   socket_attach_detection_sensor_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::attach_detection_sensor));
+    protocol, hostname, simulation_interface::ports::attach_detection_sensor + port_offset));
   socket_update_traffic_lights_.connect(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_traffic_lights));
+    protocol, hostname, simulation_interface::ports::update_traffic_lights + port_offset));
 
   rclcpp::on_shutdown([this] { is_running = false; });
 }
 
+/**
+ * @brief serialize every request into the same buffer and parse the response into the caller's
+ * message.
+ */
+template <typename Request, typename Response>
+void MultiClient::exchange(zmqpp::socket & socket, const Request & req, Response & res)
+{
+  if (is_running) {
+    zmqpp::message message = toZMQ(req, buffer_);
+    socket.send(message);
+    zmqpp::message reply;
+    socket.receive(reply);
+    toProto(reply, res);
+  }
+}
+
 MultiClient::~MultiClient()
 {
   socket_initialize_.close();
@@ -81,132 +99,77 @@ void MultiClient::call(
   const simulation_api_schema::InitializeRequest & req,
   simulation_api_schema::InitializeResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_initialize_.send(message);
-    zmqpp::message buffer;
-    socket_initialize_.receive(buffer);
-    res = toProto<simulation_api_schema::InitializeResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(Initialize)");
+  exchange(socket_initialize_, req, res);
 }
 void MultiClient::call(
   const simulation_api_schema::UpdateFrameRequest & req,
   simulation_api_schema::UpdateFrameResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_update_frame_.send(message);
-    zmqpp::message buffer;
-    socket_update_frame_.receive(buffer);
-    res = toProto<simulation_api_schema::UpdateFrameResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(UpdateFrame)");
+  exchange(socket_update_frame_, req, res);
 }
 void MultiClient::call(
   const simulation_api_schema::UpdateSensorFrameRequest & req,
   simulation_api_schema::UpdateSensorFrameResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_update_sensor_frame_.send(message);
-    zmqpp::message buffer;
-    socket_update_sensor_frame_.receive(buffer);
-    res = toProto<simulation_api_schema::UpdateSensorFrameResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(UpdateSensorFrame)");
+  exchange(socket_update_sensor_frame_, req, res);
 }
 void MultiClient::call(
   const simulation_api_schema::SpawnVehicleEntityRequest & req,
   simulation_api_schema::SpawnVehicleEntityResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_spawn_vehicle_entity_.send(message);
-    zmqpp::message buffer;
-    socket_spawn_vehicle_entity_.receive(buffer);
-    res = toProto<simulation_api_schema::SpawnVehicleEntityResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(SpawnVehicleEntity)");
+  exchange(socket_spawn_vehicle_entity_, req, res);
 }
 void MultiClient::call(
   const simulation_api_schema::SpawnPedestrianEntityRequest & req,
   simulation_api_schema::SpawnPedestrianEntityResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_spawn_pedestrian_entity_.send(message);
-    zmqpp::message buffer;
-    socket_spawn_pedestrian_entity_.receive(buffer);
-    res = toProto<simulation_api_schema::SpawnPedestrianEntityResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(SpawnPedestrianEntity)");
+  exchange(socket_spawn_pedestrian_entity_, req, res);
 }
 void MultiClient::call(
   const simulation_api_schema::SpawnMiscObjectEntityRequest & req,
   simulation_api_schema::SpawnMiscObjectEntityResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_spawn_misc_object_entity_.send(message);
-    zmqpp::message buffer;
-    socket_spawn_misc_object_entity_.receive(buffer);
-    res = toProto<simulation_api_schema::SpawnMiscObjectEntityResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(SpawnMiscObjectEntity)");
+  exchange(socket_spawn_misc_object_entity_, req, res);
 }
 void MultiClient::call(
   const simulation_api_schema::DespawnEntityRequest & req,
   simulation_api_schema::DespawnEntityResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_despawn_entity_.send(message);
-    zmqpp::message buffer;
-    socket_despawn_entity_.receive(buffer);
-    res = toProto<simulation_api_schema::DespawnEntityResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(DespawnEntity)");
+  exchange(socket_despawn_entity_, req, res);
 }
 void MultiClient::call(
   const simulation_api_schema::UpdateEntityStatusRequest & req,
   simulation_api_schema::UpdateEntityStatusResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_update_entity_status_.send(message);
-    zmqpp::message buffer;
-    socket_update_entity_status_.receive(buffer);
-    res = toProto<simulation_api_schema::UpdateEntityStatusResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(UpdateEntityStatus)");
+  exchange(socket_update_entity_status_, req, res);
 }
 void MultiClient::call(
   const simulation_api_schema::AttachLidarSensorRequest & req,
   simulation_api_schema::AttachLidarSensorResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_attach_lidar_sensor_.send(message);
-    zmqpp::message buffer;
-    socket_attach_lidar_sensor_.receive(buffer);
-    res = toProto<simulation_api_schema::AttachLidarSensorResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(AttachLidarSensor)");
+  exchange(socket_attach_lidar_sensor_, req, res);
 }
 void MultiClient::call(
   const simulation_api_schema::AttachDetectionSensorRequest & req,
   simulation_api_schema::AttachDetectionSensorResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_attach_detection_sensor_.send(message);
-    zmqpp::message buffer;
-    socket_attach_detection_sensor_.receive(buffer);
-    res = toProto<simulation_api_schema::AttachDetectionSensorResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(AttachDetectionSensor)");
+  exchange(socket_attach_detection_sensor_, req, res);
 }
 void MultiClient::call(
   const simulation_api_schema::UpdateTrafficLightsRequest & req,
   simulation_api_schema::UpdateTrafficLightsResponse & res)
 {
-  if (is_running) {
-    zmqpp::message message = toZMQ(req);
-    socket_update_traffic_lights_.send(message);
-    zmqpp::message buffer;
-    socket_update_traffic_lights_.receive(buffer);
-    res = toProto<simulation_api_schema::UpdateTrafficLightsResponse>(buffer);
-  }
+  PROFILE_SCOPE("zeromq::MultiClient::call(UpdateTrafficLights)");
+  exchange(socket_update_traffic_lights_, req, res);
 }
 }  // namespace zeromq
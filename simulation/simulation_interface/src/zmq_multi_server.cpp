@@ -16,6 +16,12 @@
 #include <simulation_interface/zmq_multi_server.hpp>
 #include <string>
 
+namespace
+{
+// NOTE: inproc endpoints are local to each context, and each MultiServer has a context of its own.
+constexpr auto control_endpoint = "inproc://control";
+}  // namespace
+
 namespace zeromq
 {
 MultiServer::MultiServer(
@@ -63,9 +69,11 @@ MultiServer::MultiServer(
   std::function<void(
     const simulation_api_schema::UpdateTrafficLightsRequest &,
     simulation_api_schema::UpdateTrafficLightsResponse &)>
-    update_traffic_lights_func)
+    update_traffic_lights_func,
+  const unsigned int port_offset)
 : context_(zmqpp::context()),
   type_(zmqpp::socket_type::reply),
+  control_sock_(context_, zmqpp::socket_type::pair),
   initialize_sock_(context_, type_),
   initialize_func_(initialize_func),
   update_frame_sock_(context_, type_),
@@ -89,28 +97,30 @@ MultiServer::MultiServer(
   update_traffic_lights_sock_(context_, type_),
   update_traffic_lights_func_(update_traffic_lights_func)
 {
-  initialize_sock_.bind(
-    simulation_interface::getEndPoint(protocol, hostname, simulation_interface::ports::initialize));
+  initialize_sock_.bind(simulation_interface::getEndPoint(
+    protocol, hostname, simulation_interface::ports::initialize + port_offset));
   update_entity_status_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_entity_status));
+    protocol, hostname, simulation_interface::ports::update_entity_status + port_offset));
   update_frame_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_frame));
+    protocol, hostname, simulation_interface::ports::update_frame + port_offset));
   spawn_vehicle_entity_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_vehicle_entity));
+    protocol, hostname, simulation_interface::ports::spawn_vehicle_entity + port_offset));
   spawn_pedestrian_entity_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_pedestrian_entity));
+    protocol, hostname, simulation_interface::ports::spawn_pedestrian_entity + port_offset));
   spawn_misc_object_entity_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::spawn_misc_object_entity));
+    protocol, hostname, simulation_interface::ports::spawn_misc_object_entity + port_offset));
   despawn_entity_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::despawn_entity));
+    protocol, hostname, simulation_interface::ports::despawn_entity + port_offset));
   update_sensor_frame_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_sensor_frame));
+    protocol, hostname, simulation_interface::ports::update_sensor_frame + port_offset));
   attach_lidar_sensor_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::attach_lidar_sensor));
+    protocol, hostname, simulation_interface::ports::attach_lidar_sensor + port_offset));
   attach_detection_sensor_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::attach_detection_sensor));
+    protocol, hostname, simulation_interface::ports::attach_detection_sensor + port_offset));
   update_traffic_lights_sock_.bind(simulation_interface::getEndPoint(
-    protocol, hostname, simulation_interface::ports::update_traffic_lights));
+    protocol, hostname, simulation_interface::ports::update_traffic_lights + port_offset));
+  control_sock_.bind(control_endpoint);
+  poller_.add(control_sock_);
   poller_.add(initialize_sock_);
   poller_.add(update_frame_sock_);
   poller_.add(update_sensor_frame_sock_);
@@ -125,113 +135,81 @@ MultiServer::MultiServer(
   thread_ = std::thread(&MultiServer::start_poll, this);
 }
 
-MultiServer::~MultiServer() { thread_.join(); }
+/**
+ * @brief serve a request on a ReusableArena, serializing the response into the same buffer every
+ * time.
+ */
+template <typename Request, typename Response>
+void MultiServer::serve(
+  zmqpp::socket & socket, const std::function<void(const Request &, Response &)> & handler)
+{
+  zmqpp::message message;
+  socket.receive(message);
+  arena_.reset();
+  auto & request = arena_.create<Request>();
+  toProto(message, request);
+  auto & response = arena_.create<Response>();
+  handler(request, response);
+  zmqpp::message reply = toZMQ(response, buffer_);
+  socket.send(reply);
+}
 
-void MultiServer::poll()
+/**
+ * @brief stop the serving thread, blocked in poll, by a message to the control socket.
+ */
+MultiServer::~MultiServer()
 {
-  constexpr long timeout_ms = 1L;
-  poller_.poll(timeout_ms);
+  zmqpp::socket control_sock(context_, zmqpp::socket_type::pair);
+  control_sock.connect(control_endpoint);
+  control_sock.send("stop");
+  thread_.join();
+}
+
+bool MultiServer::poll()
+{
+  poller_.poll(zmqpp::poller::wait_forever);
+  if (poller_.has_input(control_sock_)) {
+    return false;
+  }
   if (poller_.has_input(initialize_sock_)) {
-    zmqpp::message request;
-    initialize_sock_.receive(request);
-    simulation_api_schema::InitializeResponse response;
-    initialize_func_(toProto<simulation_api_schema::InitializeRequest>(request), response);
-    auto msg = toZMQ(response);
-    initialize_sock_.send(msg);
+    serve(initialize_sock_, initialize_func_);
   }
   if (poller_.has_input(update_frame_sock_)) {
-    zmqpp::message request;
-    update_frame_sock_.receive(request);
-    simulation_api_schema::UpdateFrameResponse response;
-    update_frame_func_(toProto<simulation_api_schema::UpdateFrameRequest>(request), response);
-    auto msg = toZMQ(response);
-    update_frame_sock_.send(msg);
+    serve(update_frame_sock_, update_frame_func_);
   }
   if (poller_.has_input(update_sensor_frame_sock_)) {
-    zmqpp::message request;
-    update_sensor_frame_sock_.receive(request);
-    simulation_api_schema::UpdateSensorFrameResponse response;
-    update_sensor_frame_func_(
-      toProto<simulation_api_schema::UpdateSensorFrameRequest>(request), response);
-    auto msg = toZMQ(response);
-    update_sensor_frame_sock_.send(msg);
+    serve(update_sensor_frame_sock_, update_sensor_frame_func_);
   }
   if (poller_.has_input(spawn_vehicle_entity_sock_)) {
-    zmqpp::message request;
-    spawn_vehicle_entity_sock_.receive(request);
-    simulation_api_schema::SpawnVehicleEntityResponse response;
-    spawn_vehicle_entity_func_(
-      toProto<simulation_api_schema::SpawnVehicleEntityRequest>(request), response);
-    auto msg = toZMQ(response);
-    spawn_vehicle_entity_sock_.send(msg);
+    serve(spawn_vehicle_entity_sock_, spawn_vehicle_entity_func_);
   }
   if (poller_.has_input(spawn_pedestrian_entity_sock_)) {
-    zmqpp::message request;
-    spawn_pedestrian_entity_sock_.receive(request);
-    simulation_api_schema::SpawnPedestrianEntityResponse response;
-    spawn_pedestrian_entity_func_(
-      toProto<simulation_api_schema::SpawnPedestrianEntityRequest>(request), response);
-    auto msg = toZMQ(response);
-    spawn_pedestrian_entity_sock_.send(msg);
+    serve(spawn_pedestrian_entity_sock_, spawn_pedestrian_entity_func_);
   }
   if (poller_.has_input(spawn_misc_object_entity_sock_)) {
-    zmqpp::message request;
-    spawn_misc_object_entity_sock_.receive(request);
-    simulation_api_schema::SpawnMiscObjectEntityResponse response;
-    spawn_misc_object_entity_func_(
-      toProto<simulation_api_schema::SpawnMiscObjectEntityRequest>(request), response);
-    auto msg = toZMQ(response);
-    spawn_misc_object_entity_sock_.send(msg);
+    serve(spawn_misc_object_entity_sock_, spawn_misc_object_entity_func_);
   }
   if (poller_.has_input(despawn_entity_sock_)) {
-    zmqpp::message request;
-    despawn_entity_sock_.receive(request);
-    simulation_api_schema::DespawnEntityResponse response;
-    despawn_entity_func_(toProto<simulation_api_schema::DespawnEntityRequest>(request), response);
-    auto msg = toZMQ(response);
-    despawn_entity_sock_.send(msg);
+    serve(despawn_entity_sock_, despawn_entity_func_);
   }
   if (poller_.has_input(update_entity_status_sock_)) {
-    zmqpp::message request;
-    update_entity_status_sock_.receive(request);
-    simulation_api_schema::UpdateEntityStatusResponse response;
-    update_entity_status_func_(
-      toProto<simulation_api_schema::UpdateEntityStatusRequest>(request), response);
-    auto msg = toZMQ(response);
-    update_entity_status_sock_.send(msg);
+    serve(update_entity_status_sock_, update_entity_status_func_);
   }
   if (poller_.has_input(attach_lidar_sensor_sock_)) {
-    zmqpp::message request;
-    attach_lidar_sensor_sock_.receive(request);
-    simulation_api_schema::AttachLidarSensorResponse response;
-    attach_lidar_sensor_func_(
-      toProto<simulation_api_schema::AttachLidarSensorRequest>(request), response);
-    auto msg = toZMQ(response);
-    attach_lidar_sensor_sock_.send(msg);
+    serve(attach_lidar_sensor_sock_, attach_lidar_sensor_func_);
   }
   if (poller_.has_input(attach_detection_sensor_sock_)) {
-    zmqpp::message request;
-    attach_detection_sensor_sock_.receive(request);
-    simulation_api_schema::AttachDetectionSensorResponse response;
-    attach_detection_sensor_func_(
-      toProto<simulation_api_schema::AttachDetectionSensorRequest>(request), response);
-    auto msg = toZMQ(response);
-    attach_detection_sensor_sock_.send(msg);
+    serve(attach_detection_sensor_sock_, attach_detection_sensor_func_);
   }
   if (poller_.has_input(update_traffic_lights_sock_)) {
-    zmqpp::message request;
-    update_traffic_lights_sock_.receive(request);
-    simulation_api_schema::UpdateTrafficLightsResponse response;
-    update_traffic_lights_func_(
-      toProto<simulation_api_schema::UpdateTrafficLightsRequest>(request), response);
-    auto msg = toZMQ(response);
-    update_traffic_lights_sock_.send(msg);
+    serve(update_traffic_lights_sock_, update_traffic_lights_func_);
   }
+  return true;
 }
+
 void MultiServer::start_poll()
 {
-  while (rclcpp::ok()) {
-    poll();
+  while (poll()) {
   }
 }
 }  // namespace zeromq
@@ -0,0 +1,89 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+#include <simulation_api_schema.pb.h>
+
+#include <cstddef>
+#include <simulation_interface/reusable_arena.hpp>
+#include <string>
+
+void fill(simulation_api_schema::UpdateEntityStatusRequest & request, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    auto & status = *request.add_status();
+    status.set_name("entity" + std::to_string(i));
+    status.set_time(0.05 * i);
+    status.mutable_type()->set_type(traffic_simulator_msgs::EntityType::VEHICLE);
+    status.mutable_bounding_box()->mutable_dimensions()->set_x(4.0);
+    status.mutable_action_status()->mutable_twist()->mutable_linear()->set_x(10.0);
+    status.mutable_pose()->mutable_position()->set_x(i);
+    status.mutable_lanelet_pose()->set_lanelet_id(i);
+    status.set_lanelet_pose_valid(true);
+  }
+}
+
+static void BuildRequestOnHeap(benchmark::State & state)
+{
+  std::string buffer;
+  for (auto _ : state) {
+    simulation_api_schema::UpdateEntityStatusRequest request;
+    fill(request, state.range(0));
+    request.SerializeToString(&buffer);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+}
+BENCHMARK(BuildRequestOnHeap)->Arg(100)->Arg(500);
+
+static void BuildRequestOnArena(benchmark::State & state)
+{
+  simulation_interface::ReusableArena arena;
+  std::string buffer;
+  for (auto _ : state) {
+    arena.reset();
+    auto & request = arena.create<simulation_api_schema::UpdateEntityStatusRequest>();
+    fill(request, state.range(0));
+    request.SerializeToString(&buffer);
+    benchmark::DoNotOptimize(buffer.data());
+  }
+}
+BENCHMARK(BuildRequestOnArena)->Arg(100)->Arg(500);
+
+static void ParseRequestOnHeap(benchmark::State & state)
+{
+  simulation_api_schema::UpdateEntityStatusRequest source;
+  fill(source, state.range(0));
+  const auto buffer = source.SerializeAsString();
+  for (auto _ : state) {
+    simulation_api_schema::UpdateEntityStatusRequest request;
+    benchmark::DoNotOptimize(request.ParseFromString(buffer));
+  }
+}
+BENCHMARK(ParseRequestOnHeap)->Arg(100)->Arg(500);
+
+static void ParseRequestOnArena(benchmark::State & state)
+{
+  simulation_api_schema::UpdateEntityStatusRequest source;
+  fill(source, state.range(0));
+  const auto buffer = source.SerializeAsString();
+  simulation_interface::ReusableArena arena;
+  for (auto _ : state) {
+    arena.reset();
+    auto & request = arena.create<simulation_api_schema::UpdateEntityStatusRequest>();
+    benchmark::DoNotOptimize(request.ParseFromString(buffer));
+  }
+}
+BENCHMARK(ParseRequestOnArena)->Arg(100)->Arg(500);
+
+BENCHMARK_MAIN();
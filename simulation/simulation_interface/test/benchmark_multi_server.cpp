@@ -0,0 +1,83 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <rclcpp/rclcpp.hpp>
+#include <simulation_interface/zmq_multi_client.hpp>
+#include <simulation_interface/zmq_multi_server.hpp>
+#include <string>
+
+constexpr unsigned int port_offset = 200;
+
+const auto succeed = [](const auto &, auto & response) {
+  response.mutable_result()->set_success(true);
+};
+
+/**
+ * @brief a MultiServer answering every request with success and a MultiClient on localhost,
+ * measuring the round trip of a request only.
+ */
+struct Connection
+{
+  zeromq::MultiServer server;
+
+  zeromq::MultiClient client;
+
+  Connection()
+  : server(
+      simulation_interface::protocol, simulation_interface::HostName::ANY, succeed, succeed,
+      succeed, succeed, succeed, succeed, succeed, succeed, succeed, succeed, succeed, port_offset),
+    client(simulation_interface::protocol, "localhost", port_offset)
+  {
+  }
+};
+
+static void UpdateFrameRoundTrip(benchmark::State & state)
+{
+  Connection connection;
+  simulation_api_schema::UpdateFrameRequest request;
+  simulation_api_schema::UpdateFrameResponse response;
+  for (auto _ : state) {
+    request.set_current_time(request.current_time() + 0.05);
+    connection.client.call(request, response);
+    benchmark::DoNotOptimize(response.result().success());
+  }
+}
+BENCHMARK(UpdateFrameRoundTrip)->Unit(benchmark::kMicrosecond);
+
+static void UpdateEntityStatusRoundTrip(benchmark::State & state)
+{
+  Connection connection;
+  simulation_api_schema::UpdateEntityStatusRequest request;
+  for (std::int64_t i = 0; i < state.range(0); ++i) {
+    request.add_status()->set_name("entity" + std::to_string(i));
+  }
+  simulation_api_schema::UpdateEntityStatusResponse response;
+  for (auto _ : state) {
+    connection.client.call(request, response);
+    benchmark::DoNotOptimize(response.result().success());
+  }
+}
+BENCHMARK(UpdateEntityStatusRoundTrip)->Arg(10)->Arg(100)->Unit(benchmark::kMicrosecond);
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  rclcpp::shutdown();
+  return 0;
+}
@@ -0,0 +1,112 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+#include <simulation_api_schema.pb.h>
+
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+#include <simulation_interface/reusable_arena.hpp>
+#include <string>
+
+/**
+ * @brief the global operator new is replaced to count the heap allocations while counting.
+ */
+static bool counting = false;
+
+static std::size_t allocation_count = 0;
+
+void * operator new(std::size_t size)
+{
+  if (counting) {
+    ++allocation_count;
+  }
+  if (void * pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  } else {
+    throw std::bad_alloc();
+  }
+}
+
+void operator delete(void * pointer) noexcept { std::free(pointer); }
+
+void operator delete(void * pointer, std::size_t) noexcept { std::free(pointer); }
+
+template <typename Thunk>
+std::size_t countAllocations(Thunk && thunk)
+{
+  allocation_count = 0;
+  counting = true;
+  thunk();
+  counting = false;
+  return allocation_count;
+}
+
+void fill(simulation_api_schema::UpdateEntityStatusRequest & request, std::size_t size)
+{
+  for (std::size_t i = 0; i < size; ++i) {
+    auto & status = *request.add_status();
+    status.set_name("entity" + std::to_string(i));
+    status.set_time(0.05 * i);
+    status.mutable_type()->set_type(traffic_simulator_msgs::EntityType::VEHICLE);
+    status.mutable_bounding_box()->mutable_dimensions()->set_x(4.0);
+    status.mutable_action_status()->mutable_twist()->mutable_linear()->set_x(10.0);
+    status.mutable_pose()->mutable_position()->set_x(i);
+    status.mutable_lanelet_pose()->set_lanelet_id(i);
+    status.set_lanelet_pose_valid(true);
+  }
+}
+
+TEST(ReusableArena, HeapRequestAllocates)
+{
+  EXPECT_GT(countAllocations([] {
+              simulation_api_schema::UpdateEntityStatusRequest request;
+              fill(request, 100);
+            }),
+            100U);
+}
+
+TEST(ReusableArena, ArenaRequestDoesNotAllocateAfterReset)
+{
+  simulation_interface::ReusableArena arena;
+  fill(arena.create<simulation_api_schema::UpdateEntityStatusRequest>(), 100);
+  EXPECT_EQ(countAllocations([&] {
+              arena.reset();
+              fill(arena.create<simulation_api_schema::UpdateEntityStatusRequest>(), 100);
+            }),
+            0U);
+}
+
+TEST(ReusableArena, ParseIntoArenaDoesNotAllocate)
+{
+  simulation_api_schema::UpdateEntityStatusRequest request;
+  fill(request, 100);
+  std::string buffer;
+  request.SerializeToString(&buffer);
+  simulation_interface::ReusableArena arena;
+  arena.create<simulation_api_schema::UpdateEntityStatusRequest>().ParseFromString(buffer);
+  EXPECT_EQ(countAllocations([&] {
+              arena.reset();
+              auto & parsed = arena.create<simulation_api_schema::UpdateEntityStatusRequest>();
+              EXPECT_TRUE(parsed.ParseFromArray(buffer.data(), buffer.size()));
+            }),
+            0U);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
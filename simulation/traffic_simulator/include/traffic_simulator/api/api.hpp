@@ -24,10 +24,12 @@
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
 #include <rosgraph_msgs/msg/clock.hpp>
-#include <simulation_interface/zmq_multi_client.hpp>
+#include <simple_profiler/profiler.hpp>
+#include <simulation_interface/reusable_arena.hpp>
 #include <stdexcept>
 #include <string>
 #include <traffic_simulator/api/configuration.hpp>
+#include <traffic_simulator/api/simulator_client.hpp>
 #include <traffic_simulator/data_type/data_types.hpp>
 #include <traffic_simulator/entity/entity_base.hpp>
 #include <traffic_simulator/entity/entity_manager.hpp>
@@ -36,9 +38,11 @@
 #include <traffic_simulator/metrics/metrics_manager.hpp>
 #include <traffic_simulator/simulation_clock/simulation_clock.hpp>
 #include <traffic_simulator/traffic/traffic_controller.hpp>
+#include <traffic_simulator/traffic/traffic_source.hpp>
 #include <traffic_simulator/traffic_lights/traffic_light.hpp>
 #include <traffic_simulator_msgs/msg/driver_model.hpp>
 #include <utility>
+#include <vector>
 
 namespace traffic_simulator
 {
@@ -61,9 +65,11 @@ class API
 
 public:
   template <class NodeT, class AllocatorT = std::allocator<void>>
-  explicit API(NodeT && node, const Configuration & configuration = Configuration())
+  explicit API(
+    NodeT && node, const Configuration & configuration = Configuration(),
+    const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils_ptr = nullptr)
   : configuration(configuration),
-    entity_manager_ptr_(std::make_shared<EntityManager>(node, configuration)),
+    entity_manager_ptr_(std::make_shared<EntityManager>(node, configuration, hdmap_utils_ptr)),
     traffic_controller_ptr_(std::make_shared<traffic_simulator::traffic::TrafficController>(
       entity_manager_ptr_->getHdmapUtils(), [this]() { return API::getEntityNames(); },
       [this](const auto & name) { return API::getEntityPose(name); },
@@ -74,12 +80,18 @@ public:
       rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
     debug_marker_pub_(rclcpp::create_publisher<visualization_msgs::msg::MarkerArray>(
       node, "debug_marker", rclcpp::QoS(100), rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
-    zeromq_client_(simulation_interface::protocol, configuration.simulator_host)
+    clock_(RCL_ROS_TIME, configuration.use_raw_clock),
+    simulator_client_(node, configuration)
   {
     metrics_manager_.setEntityManager(entity_manager_ptr_);
     setVerbose(configuration.verbose);
+    if (not configuration.profile_path.empty()) {
+      common::profiler::enable();
+    }
   }
 
+  ~API();
+
   template <typename T, typename... Ts>
   void addMetric(const std::string & name, Ts &&... xs)
   {
@@ -106,7 +118,20 @@ public:
 
   bool despawn(const std::string & name);
 
-  traffic_simulator_msgs::msg::EntityStatus getEntityStatus(const std::string & name);
+  /**
+   * @brief add a source spawning vehicles named "<name>_<index>" at the lanelet pose.
+   * @note The vehicles are kept after they are despawned and reused by later spawns of the source.
+   */
+  void addTrafficSource(
+    const std::string & name, const traffic_simulator_msgs::msg::LaneletPose &,
+    const traffic::TrafficSource::Parameters &,
+    const traffic_simulator_msgs::msg::VehicleParameters &,
+    const std::string & = VehicleBehavior::defaultBehavior());
+
+  auto getEntityStatus(const std::string & name)
+    -> std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus>;
+  auto getEntityStatus(const traffic_simulator::entity::EntityHandle &)
+    -> std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus>;
 
   geometry_msgs::msg::Pose getEntityPose(const std::string & name);
 
@@ -133,6 +158,9 @@ public:
       traffic_simulator::helper::constructActionStatus());
 
   boost::optional<double> getTimeHeadway(const std::string & from, const std::string & to);
+  boost::optional<double> getTimeHeadway(
+    const traffic_simulator::entity::EntityHandle & from,
+    const traffic_simulator::entity::EntityHandle & to);
 
   bool reachPosition(
     const std::string & name, const geometry_msgs::msg::Pose & target_pose, const double tolerance);
@@ -153,6 +181,17 @@ public:
 
   bool updateFrame();
 
+  struct Snapshot
+  {
+    EntityManager::Snapshot world;
+
+    double simulation_time;
+  };
+
+  auto makeSnapshot() const -> Snapshot;
+
+  auto restore(const Snapshot &) -> bool;
+
   double getCurrentTime() const noexcept { return clock_.getCurrentSimulationTime(); }
 
   void requestLaneChange(const std::string & name, const std::int64_t & lanelet_id);
@@ -186,12 +225,16 @@ public:
   FORWARD_TO_ENTITY_MANAGER(checkCollision);
   FORWARD_TO_ENTITY_MANAGER(engage);
   FORWARD_TO_ENTITY_MANAGER(entityExists);
+  FORWARD_TO_ENTITY_MANAGER(entityStatusSet);
   FORWARD_TO_ENTITY_MANAGER(getBoundingBoxDistance);
   FORWARD_TO_ENTITY_MANAGER(getCurrentAction);
   FORWARD_TO_ENTITY_MANAGER(getDriverModel);
   FORWARD_TO_ENTITY_MANAGER(getEgoName);
   FORWARD_TO_ENTITY_MANAGER(getEmergencyStateString);
+  FORWARD_TO_ENTITY_MANAGER(getEntityHandle);
+  FORWARD_TO_ENTITY_MANAGER(getEntityName);
   FORWARD_TO_ENTITY_MANAGER(getEntityNames);
+  FORWARD_TO_ENTITY_MANAGER(getHdmapUtils);
   FORWARD_TO_ENTITY_MANAGER(getLinearJerk);
   FORWARD_TO_ENTITY_MANAGER(getLongitudinalDistance);
   FORWARD_TO_ENTITY_MANAGER(getRelativePose);
@@ -216,6 +259,15 @@ public:
 #undef FORWARD_TO_ENTITY_MANAGER
 
 private:
+  bool registerToEnvironmentSimulator(
+    const std::string & name, const traffic_simulator_msgs::msg::VehicleParameters &,
+    const bool is_ego);
+  bool registerToEnvironmentSimulator(
+    const std::string & name, const traffic_simulator_msgs::msg::PedestrianParameters &);
+  bool registerToEnvironmentSimulator(
+    const std::string & name, const traffic_simulator_msgs::msg::MiscObjectParameters &);
+
+  void publishDebugMarker();
   bool updateSensorFrame();
   bool updateEntityStatusInSim();
   bool updateTrafficLightsInSim();
@@ -232,9 +284,13 @@ private:
 
   const rclcpp::Publisher<visualization_msgs::msg::MarkerArray>::SharedPtr debug_marker_pub_;
 
+  std::size_t debug_marker_frame_count_ = 0;
+
   traffic_simulator::SimulationClock clock_;
 
-  zeromq::MultiClient zeromq_client_;
+  SimulatorClient simulator_client_;
+
+  simulation_interface::ReusableArena entity_status_arena_;
 };
 }  // namespace traffic_simulator
 
@@ -40,8 +40,31 @@ struct Configuration
 
   double initialize_duration = 0;
 
+  /**
+   * @brief if true, /clock is the wall clock time, otherwise the simulation time from the wall
+   * clock time on initialization.
+   */
+  bool use_raw_clock = true;
+
+  /**
+   * @brief entity/status and debug_marker are published every N-th frame, and only while
+   * subscribed.
+   */
+  std::size_t entity_status_publish_decimation = 1;
+
+  std::size_t debug_marker_publish_decimation = 1;
+
+  /**
+   * @brief if true, the simple sensor simulator is called in this process instead of over ZeroMQ.
+   *
+   * simulator_host and simulator_port_offset are then ignored. No effect in standalone mode.
+   */
+  bool in_process_simulator = false;
+
   std::string simulator_host = "localhost";
 
+  unsigned int simulator_port_offset = 0;  // NOTE: Added to each of simulation_interface::ports.
+
   /* ---- NOTE -----------------------------------------------------------------
    *
    *  This setting comes from the argument of the same name (= `map_path`) in
@@ -63,7 +86,21 @@ struct Configuration
 
   Pathname scenario_path = "";
 
-  Pathname metrics_log_path = "/tmp/metrics.json";
+  /**
+   * @brief metrics are written here in JSON Lines (see metrics::MetricsManager).
+   *
+   * The extension differs from the former /tmp/metrics.json so that readers of the old single JSON
+   * document do not misread it.
+   */
+  Pathname metrics_log_path = "/tmp/metrics.jsonl";
+
+  /**
+   * @brief if not empty, profiling spans are written here in the Chrome trace event format when the
+   * API is destroyed.
+   *
+   * Spans are recorded only if built with SIMPLE_PROFILER_ENABLED=ON.
+   */
+  Pathname profile_path = "";
 
   Pathname rviz_config_path =  //
     ament_index_cpp::get_package_share_directory("traffic_simulator") +
@@ -0,0 +1,79 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__API__SIMULATOR_CLIENT_HPP_
+#define TRAFFIC_SIMULATOR__API__SIMULATOR_CLIENT_HPP_
+
+#include <simulation_api_schema.pb.h>
+
+#include <memory>
+#include <rclcpp/node_interfaces/get_node_base_interface.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <simple_sensor_simulator/scenario_simulator_core.hpp>
+#include <simulation_interface/zmq_multi_client.hpp>
+#include <traffic_simulator/api/configuration.hpp>
+
+namespace traffic_simulator
+{
+/**
+ * @brief the connection to the environment simulator, over ZeroMQ or, if
+ * Configuration::in_process_simulator, in this process.
+ *
+ * Both receive the same protobuf messages. The in-process simulator has a node of its own, named
+ * and namespaced as simple_sensor_simulator would be beside the given node.
+ */
+class SimulatorClient
+{
+public:
+  template <typename NodeT>
+  explicit SimulatorClient(NodeT && node, const Configuration & configuration)
+  : simulator_node_(
+      configuration.in_process_simulator
+        ? std::make_shared<rclcpp::Node>(
+            "simple_sensor_simulator",
+            rclcpp::node_interfaces::get_node_base_interface(node)->get_namespace(),
+            rclcpp::NodeOptions().use_global_arguments(false))
+        : nullptr),
+    simulator_core_(
+      simulator_node_
+        ? std::make_unique<simple_sensor_simulator::ScenarioSimulatorCore>(*simulator_node_)
+        : nullptr),
+    zeromq_client_(
+      simulator_node_ ? nullptr
+                      : std::make_unique<zeromq::MultiClient>(
+                          simulation_interface::protocol, configuration.simulator_host,
+                          configuration.simulator_port_offset))
+  {
+  }
+
+  template <typename Request, typename Response>
+  auto call(const Request & request, Response & response) -> void
+  {
+    if (simulator_core_) {
+      simulator_core_->call(request, response);
+    } else {
+      zeromq_client_->call(request, response);
+    }
+  }
+
+private:
+  const std::shared_ptr<rclcpp::Node> simulator_node_;
+
+  const std::unique_ptr<simple_sensor_simulator::ScenarioSimulatorCore> simulator_core_;
+
+  const std::unique_ptr<zeromq::MultiClient> zeromq_client_;
+};
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__API__SIMULATOR_CLIENT_HPP_
@@ -15,6 +15,7 @@
 #ifndef TRAFFIC_SIMULATOR__BEHAVIOR__BEHAVIOR_PLUGIN_BASE_HPP_
 #define TRAFFIC_SIMULATOR__BEHAVIOR__BEHAVIOR_PLUGIN_BASE_HPP_
 
+#include <any>
 #include <boost/optional.hpp>
 #include <string>
 #include <traffic_simulator/data_type/data_types.hpp>
@@ -40,6 +41,14 @@ public:
   virtual void update(double current_time, double step_time) = 0;
   virtual const std::string & getCurrentAction() const = 0;
 
+  /**
+   * @brief an opaque copy of everything the plugin carries over from one update to the next.
+   *
+   * Restoring it must make the following updates bit-identical to the ones after it was made.
+   */
+  virtual std::any makeSnapshot() = 0;
+  virtual void restore(const std::any & snapshot) = 0;
+
   typedef std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> EntityTypeDict;
   typedef std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus>
     EntityStatusDict;
@@ -59,13 +59,22 @@ class EgoEntity : public VehicleEntity
 
   const VehicleModelType vehicle_model_type_;
 
-  const std::shared_ptr<SimModelInterface> vehicle_model_ptr_;
+  std::shared_ptr<SimModelInterface> vehicle_model_ptr_;
 
   boost::optional<geometry_msgs::msg::Pose> initial_pose_;
 
   boost::optional<double> previous_linear_velocity_, previous_angular_velocity_;
 
 public:
+  struct Snapshot : public VehicleEntity::Snapshot
+  {
+    std::shared_ptr<const SimModelInterface> vehicle_model;
+
+    boost::optional<geometry_msgs::msg::Pose> initial_pose;
+
+    boost::optional<double> previous_linear_velocity, previous_angular_velocity;
+  };
+
   explicit EgoEntity() = delete;
 
   explicit EgoEntity(
@@ -107,10 +116,14 @@ public:
 
   auto getEmergencyStateString() const -> std::string override;
 
+  auto makeSnapshot() const -> std::shared_ptr<const EntityBase::Snapshot> override;
+
   void onUpdate(double current_time, double step_time) override;
 
   auto ready() const -> bool override;
 
+  auto restore(const EntityBase::Snapshot &) -> void override;
+
   void requestAcquirePosition(const traffic_simulator_msgs::msg::LaneletPose &) override;
 
   void requestAcquirePosition(const geometry_msgs::msg::Pose & map_pose) override;
@@ -141,6 +154,9 @@ public:
     const speed_change::RelativeTargetSpeed & target_speed, bool continuous) override;
 
   auto setVelocityLimit(double) -> void override;
+
+protected:
+  auto save(Snapshot &) const -> void;
 };
 }  // namespace entity
 }  // namespace traffic_simulator
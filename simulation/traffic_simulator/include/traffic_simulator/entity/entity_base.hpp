@@ -51,11 +51,49 @@ public:
 
   virtual ~EntityBase() = default;
 
+  /**
+   * @brief the state an entity carries over from one frame to the next, extended by derived
+   * entities.
+   *
+   * A snapshot is immutable and can be restored any number of times.
+   */
+  struct Snapshot
+  {
+    virtual ~Snapshot() = default;
+
+    boost::optional<traffic_simulator_msgs::msg::LaneletPose> next_waypoint;
+    boost::optional<traffic_simulator_msgs::msg::EntityStatus> status;
+    boost::optional<traffic_simulator_msgs::msg::EntityStatus> status_before_update;
+
+    std::queue<traffic_simulator_msgs::msg::LaneletPose> waypoints;
+
+    std::shared_ptr<traffic_simulator::math::CatmullRomSpline> spline;
+
+    bool visibility;
+
+    std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> other_status;
+    std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> entity_type_list;
+
+    boost::optional<double> linear_jerk;
+    boost::optional<double> stand_still_duration;
+
+    boost::optional<double> target_speed;
+    traffic_simulator::job::JobList job_list;
+  };
+
 public:
   virtual void appendDebugMarker(visualization_msgs::msg::MarkerArray & marker_array);
 
   virtual void engage() {}
 
+  /**
+   * @brief finalize the status others see in the current frame, stamped with the time of the frame.
+   *
+   * EntityManager calls this once per frame after updating every entity. A status changed in
+   * between (e.g. by setStatus) is finalized again on next read.
+   */
+  /*   */ auto finalizeStatus(const double current_time) -> void;
+
   virtual auto getBoundingBox() const -> const traffic_simulator_msgs::msg::BoundingBox = 0;
 
   virtual auto getCurrentAction() const -> const std::string = 0;
@@ -70,6 +108,9 @@ public:
 
   /*   */ auto getEntityType() const -> const auto & { return entity_type_; }
 
+  /*   */ auto getFinalizedStatus() const
+    -> const std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus> &;
+
   virtual auto getEntityTypename() const -> const std::string & = 0;
 
   /*   */ auto getLinearJerk() const { return linear_jerk_; }
@@ -78,7 +119,7 @@ public:
 
   virtual auto getRouteLanelets(const double horizon = 100) -> std::vector<std::int64_t> = 0;
 
-  /*   */ auto getStatus() const -> const traffic_simulator_msgs::msg::EntityStatus;
+  /*   */ auto getStatus() const -> const traffic_simulator_msgs::msg::EntityStatus &;
 
   /*   */ auto getStandStillDuration() const -> boost::optional<double>;
 
@@ -96,6 +137,8 @@ public:
 
   virtual auto getWaypoints() -> const traffic_simulator_msgs::msg::WaypointsArray = 0;
 
+  virtual auto makeSnapshot() const -> std::shared_ptr<const Snapshot>;
+
   virtual auto getGoalPoses() -> std::vector<traffic_simulator_msgs::msg::LaneletPose> = 0;
 
   virtual auto getDriverModel() const -> traffic_simulator_msgs::msg::DriverModel = 0;
@@ -139,6 +182,8 @@ public:
 
   virtual auto ready() const -> bool { return static_cast<bool>(status_); }
 
+  virtual auto restore(const Snapshot &) -> void;
+
   virtual void requestAcquirePosition(
     const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose) = 0;
 
@@ -196,6 +241,10 @@ public:
   }
 
 protected:
+  /*   */ auto invalidateFinalizedStatus() noexcept -> void { finalized_status_.reset(); }
+
+  /*   */ auto save(Snapshot &) const -> void;
+
   boost::optional<traffic_simulator_msgs::msg::LaneletPose> next_waypoint_;
   boost::optional<traffic_simulator_msgs::msg::EntityStatus> status_;
   boost::optional<traffic_simulator_msgs::msg::EntityStatus> status_before_update_;
@@ -221,6 +270,11 @@ protected:
 
   boost::optional<double> target_speed_;
   traffic_simulator::job::JobList job_list_;
+
+private:
+  double finalized_time_ = 0;
+
+  mutable std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus> finalized_status_;
 };
 }  // namespace entity
 }  // namespace traffic_simulator
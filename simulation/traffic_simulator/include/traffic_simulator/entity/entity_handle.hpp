@@ -0,0 +1,57 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__ENTITY__ENTITY_HANDLE_HPP_
+#define TRAFFIC_SIMULATOR__ENTITY__ENTITY_HANDLE_HPP_
+
+#include <cstdint>
+#include <limits>
+#include <ostream>
+
+namespace traffic_simulator
+{
+namespace entity
+{
+/**
+ * @brief stable reference to an entity, assigned by EntityManager on spawn.
+ *
+ * index is the slot in the entity table and generation tells apart the entities occupying it one
+ * after another, so a handle never refers to an entity spawned later with the same name. A default
+ * constructed handle refers to no entity.
+ */
+struct EntityHandle
+{
+  std::uint32_t index = std::numeric_limits<std::uint32_t>::max();
+
+  std::uint32_t generation = 0;
+
+  friend constexpr auto operator==(const EntityHandle & lhs, const EntityHandle & rhs) -> bool
+  {
+    return lhs.index == rhs.index and lhs.generation == rhs.generation;
+  }
+
+  friend constexpr auto operator!=(const EntityHandle & lhs, const EntityHandle & rhs) -> bool
+  {
+    return not (lhs == rhs);
+  }
+
+  friend auto operator<<(std::ostream & os, const EntityHandle & handle) -> std::ostream &
+  {
+    return os << "#" << handle.index << "." << handle.generation;
+  }
+};
+}  // namespace entity
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__ENTITY__ENTITY_HANDLE_HPP_
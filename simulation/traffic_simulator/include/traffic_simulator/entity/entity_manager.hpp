@@ -21,7 +21,9 @@
 #include <tf2_ros/transform_broadcaster.h>
 
 #include <boost/optional.hpp>
+#include <cstdint>
 #include <memory>
+#include <optional>
 #include <rclcpp/node_interfaces/get_node_topics_interface.hpp>
 #include <rclcpp/node_interfaces/node_topics_interface.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -32,6 +34,7 @@
 #include <traffic_simulator/data_type/data_types.hpp>
 #include <traffic_simulator/entity/ego_entity.hpp>
 #include <traffic_simulator/entity/entity_base.hpp>
+#include <traffic_simulator/entity/entity_handle.hpp>
 #include <traffic_simulator/entity/misc_object_entity.hpp>
 #include <traffic_simulator/entity/pedestrian_entity.hpp>
 #include <traffic_simulator/entity/vehicle_entity.hpp>
@@ -75,7 +78,77 @@ class EntityManager
 
   const rclcpp::Clock::SharedPtr clock_ptr_;
 
-  std::unordered_map<std::string, std::unique_ptr<traffic_simulator::entity::EntityBase>> entities_;
+  /**
+   * @brief an entry of the dense entity table indexed by EntityHandle::index.
+   *
+   * The slot of a despawned entity is reused by a later spawn with a new generation. entity_names_
+   * and entity_types_ keep the living entities in spawn order and are rebuilt on spawn and despawn
+   * only.
+   */
+  struct EntitySlot
+  {
+    std::string name;
+
+    std::shared_ptr<traffic_simulator::entity::EntityBase> entity;  // nullptr if the slot is free
+
+    std::uint32_t generation = 0;
+  };
+
+  std::vector<EntitySlot> entity_slots_;
+
+  std::vector<std::uint32_t> free_entity_slots_;
+
+  std::unordered_map<std::string, EntityHandle> entity_handles_;
+
+  std::vector<std::string> entity_names_;
+
+  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> entity_types_;
+
+  /**
+   * @brief an entity of spawnPooledEntity with a snapshot of it as spawned, kept while despawned so
+   * that spawning it again restores the snapshot instead of constructing it.
+   */
+  struct PooledEntity
+  {
+    std::shared_ptr<traffic_simulator::entity::EntityBase> entity;
+
+    std::shared_ptr<const traffic_simulator::entity::EntityBase::Snapshot> snapshot;
+  };
+
+  std::unordered_map<std::string, PooledEntity> entity_pool_;
+
+  std::uint32_t last_generation_ = 0;  // never restored, so that a handle never aliases
+
+  /**
+   * @brief map poses of the goals of an entity slot, converted again only when the goals change.
+   */
+  struct GoalPoseCache
+  {
+    std::uint32_t generation = 0;
+
+    std::vector<traffic_simulator_msgs::msg::LaneletPose> goals;
+
+    std::vector<geometry_msgs::msg::Pose> goal_poses;
+  };
+
+  std::vector<GoalPoseCache> goal_pose_caches_;
+
+  /**
+   * @brief waypoints and obstacle of an entity slot, requested at most once between two updates of
+   * the entity (or a restore).
+   */
+  struct PlanCache
+  {
+    std::uint32_t generation = 0;
+
+    std::optional<traffic_simulator_msgs::msg::WaypointsArray> waypoints;
+
+    std::optional<boost::optional<traffic_simulator_msgs::msg::Obstacle>> obstacle;
+  };
+
+  std::vector<PlanCache> plan_caches_;
+
+  std::size_t entity_status_frame_count_ = 0;
 
   double step_time_;
 
@@ -130,8 +203,15 @@ public:
     }
   }
 
+  /**
+   * @param hdmap_utils_ptr map already loaded from configuration.lanelet2_map_path() with the
+   *        origin of the node, e.g. by the previous variant of a parameter sweep. If it is null,
+   *        the map is loaded from the file.
+   */
   template <class NodeT, class AllocatorT = std::allocator<void>>
-  explicit EntityManager(NodeT && node, const Configuration & configuration)
+  explicit EntityManager(
+    NodeT && node, const Configuration & configuration,
+    const std::shared_ptr<hdmap_utils::HdMapUtils> & hdmap_utils_ptr = nullptr)
   : configuration(configuration),
     node_topics_interface(rclcpp::node_interfaces::get_node_topics_interface(node)),
     broadcaster_(node),
@@ -144,8 +224,10 @@ public:
     lanelet_marker_pub_ptr_(rclcpp::create_publisher<MarkerArray>(
       node, "lanelet/marker", LaneletMarkerQoS(),
       rclcpp::PublisherOptionsWithAllocator<AllocatorT>())),
-    hdmap_utils_ptr_(std::make_shared<hdmap_utils::HdMapUtils>(
-      configuration.lanelet2_map_path(), getOrigin(*node))),
+    hdmap_utils_ptr_(
+      hdmap_utils_ptr ? hdmap_utils_ptr
+                      : std::make_shared<hdmap_utils::HdMapUtils>(
+                          configuration.lanelet2_map_path(), getOrigin(*node))),
     markers_raw_(hdmap_utils_ptr_->generateMarker()),
     traffic_light_manager_ptr_(makeTrafficLightManager(hdmap_utils_ptr_, node))
   {
@@ -186,14 +268,17 @@ public:
 
 #undef FORWARD_TO_HDMAP_UTILS
 
-#define FORWARD_TO_ENTITY(IDENTIFIER, ...)                                     \
-  template <typename... Ts>                                                    \
-  decltype(auto) IDENTIFIER(const std::string & name, Ts &&... xs) __VA_ARGS__ \
-  try {                                                                        \
-    return entities_.at(name)->IDENTIFIER(std::forward<decltype(xs)>(xs)...);  \
-  } catch (const std::out_of_range &) {                                        \
-    THROW_SEMANTIC_ERROR("entity : ", name, "does not exist");                 \
-  }                                                                            \
+#define FORWARD_TO_ENTITY(IDENTIFIER, ...)                                         \
+  template <typename... Ts>                                                        \
+  decltype(auto) IDENTIFIER(const std::string & name, Ts &&... xs) __VA_ARGS__     \
+  {                                                                                \
+    return getEntity(name)->IDENTIFIER(std::forward<decltype(xs)>(xs)...);         \
+  }                                                                                \
+  template <typename... Ts>                                                        \
+  decltype(auto) IDENTIFIER(const EntityHandle & handle, Ts &&... xs) __VA_ARGS__  \
+  {                                                                                \
+    return getEntity(handle)->IDENTIFIER(std::forward<decltype(xs)>(xs)...);       \
+  }                                                                                \
   static_assert(true, "")
 
   FORWARD_TO_ENTITY(cancelRequest, );
@@ -255,6 +340,8 @@ public:
 
   bool entityExists(const std::string & name);
 
+  auto entityExists(const EntityHandle &) const noexcept -> bool;
+
   bool laneMatchingSucceed(const std::string & name);
 
   // TODO (yamacir-kit) Rename to 'hasEntityStatus'
@@ -263,6 +350,9 @@ public:
   auto getBoundingBoxDistance(const std::string & from, const std::string & to)
     -> boost::optional<double>;
 
+  auto getBoundingBoxDistance(const EntityHandle & from, const EntityHandle & to)
+    -> boost::optional<double>;
+
   auto getCurrentTime() const noexcept -> double;
 
   auto getDistanceToCrosswalk(const std::string & name, const std::int64_t target_crosswalk_id)
@@ -271,13 +361,30 @@ public:
   auto getDistanceToStopLine(const std::string & name, const std::int64_t target_stop_line_id)
     -> boost::optional<double>;
 
-  auto getEntityNames() const -> const std::vector<std::string>;
+  auto getEntityNames() const noexcept -> const std::vector<std::string> &;
+
+  auto getEntity(const std::string & name) const
+    -> const std::shared_ptr<traffic_simulator::entity::EntityBase> &;
+
+  auto getEntity(const EntityHandle &) const
+    -> const std::shared_ptr<traffic_simulator::entity::EntityBase> &;
 
+  auto getEntityHandle(const std::string & name) const -> EntityHandle;
+
+  auto getEntityName(const EntityHandle &) const -> const std::string &;
+
+  /**
+   * @brief Status of the entity finalized in the current frame. The object pointed to is shared
+   *        by every caller and is never modified; a status changed later is a new object.
+   */
   auto getEntityStatus(const std::string & name) const
-    -> const boost::optional<traffic_simulator_msgs::msg::EntityStatus>;
+    -> std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus>;
 
-  auto getEntityTypeList() const
-    -> const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>;
+  auto getEntityStatus(const EntityHandle &) const
+    -> std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus>;
+
+  auto getEntityTypeList() const noexcept
+    -> const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> &;
 
   auto getHdmapUtils() -> const std::shared_ptr<hdmap_utils::HdMapUtils> &;
 
@@ -289,6 +396,9 @@ public:
   auto getLongitudinalDistance(const LaneletPose &, const std::string &, const double = 100) -> boost::optional<double>;
   auto getLongitudinalDistance(const std::string &, const LaneletPose &, const double = 100) -> boost::optional<double>;
   auto getLongitudinalDistance(const std::string &, const std::string &, const double = 100) -> boost::optional<double>;
+  auto getLongitudinalDistance(const LaneletPose &, const EntityHandle &, const double = 100) -> boost::optional<double>;
+  auto getLongitudinalDistance(const EntityHandle &, const LaneletPose &, const double = 100) -> boost::optional<double>;
+  auto getLongitudinalDistance(const EntityHandle &, const EntityHandle &, const double = 100) -> boost::optional<double>;
   // clang-format on
 
   auto getMapPose(const std::string & entity_name) -> geometry_msgs::msg::Pose;
@@ -306,6 +416,9 @@ public:
   auto getRelativePose(const geometry_msgs::msg::Pose & from, const std::string              & to)       -> geometry_msgs::msg::Pose;
   auto getRelativePose(const std::string              & from, const geometry_msgs::msg::Pose & to)       -> geometry_msgs::msg::Pose;
   auto getRelativePose(const std::string              & from, const std::string              & to)       -> geometry_msgs::msg::Pose;
+  auto getRelativePose(const geometry_msgs::msg::Pose & from, const EntityHandle             & to) const -> geometry_msgs::msg::Pose;
+  auto getRelativePose(const EntityHandle             & from, const geometry_msgs::msg::Pose & to) const -> geometry_msgs::msg::Pose;
+  auto getRelativePose(const EntityHandle             & from, const EntityHandle             & to) const -> geometry_msgs::msg::Pose;
   // clang-format on
 
   auto getStepTime() const noexcept -> double;
@@ -337,6 +450,34 @@ public:
   void requestLaneChange(
     const std::string & name, const traffic_simulator::lane_change::Direction & direction);
 
+  /**
+   * @brief the entities alive when the snapshot was taken, shared so that a restore after a despawn
+   * brings back the same object, each with a copy of its state.
+   *
+   * The entity table is copied as is, so handles obtained before the snapshot stay valid after
+   * restoring it.
+   */
+  struct Snapshot
+  {
+    double current_time;
+
+    double step_time;
+
+    std::vector<EntitySlot> entity_slots;
+
+    std::vector<std::uint32_t> free_entity_slots;
+
+    std::vector<std::string> entity_names;
+
+    std::vector<std::shared_ptr<const traffic_simulator::entity::EntityBase::Snapshot>> entities;
+
+    TrafficLightManagerBase::Snapshot traffic_lights;
+  };
+
+  auto makeSnapshot() const -> Snapshot;
+
+  auto restore(const Snapshot &) -> void;
+
   bool setEntityStatus(const std::string & name, traffic_simulator_msgs::msg::EntityStatus status);
 
   void setVerbose(const bool verbose);
@@ -344,14 +485,38 @@ public:
   template <typename Entity, typename... Ts>
   auto spawnEntity(const std::string & name, Ts &&... xs)
   {
-    const auto result =
-      entities_.emplace(name, std::make_unique<Entity>(name, std::forward<decltype(xs)>(xs)...));
-    if (result.second) {
-      result.first->second->setHdMapUtils(hdmap_utils_ptr_);
-      result.first->second->setTrafficLightManager(traffic_light_manager_ptr_);
-      return result.second;
+    if (entity_handles_.find(name) != std::end(entity_handles_)) {
+      THROW_SEMANTIC_ERROR("entity : ", name, " is already exists.");
     } else {
+      const auto entity = std::make_shared<Entity>(name, std::forward<decltype(xs)>(xs)...);
+      entity->setHdMapUtils(hdmap_utils_ptr_);
+      entity->setTrafficLightManager(traffic_light_manager_ptr_);
+      insertEntity(name, entity);
+      return true;
+    }
+  }
+
+  /**
+   * @brief spawn an entity kept in the pool of entities after it is despawned.
+   * @note Once an entity of the name has been constructed, the arguments following the name are
+   *       ignored and the entity is reused as it was when first spawned.
+   */
+  template <typename Entity, typename... Ts>
+  auto spawnPooledEntity(const std::string & name, Ts &&... xs)
+  {
+    if (entity_handles_.find(name) != std::end(entity_handles_)) {
       THROW_SEMANTIC_ERROR("entity : ", name, " is already exists.");
+    } else if (const auto iter = entity_pool_.find(name); iter != std::end(entity_pool_)) {
+      iter->second.entity->restore(*iter->second.snapshot);
+      insertEntity(name, iter->second.entity);
+      return true;
+    } else {
+      const auto entity = std::make_shared<Entity>(name, std::forward<decltype(xs)>(xs)...);
+      entity->setHdMapUtils(hdmap_utils_ptr_);
+      entity->setTrafficLightManager(traffic_light_manager_ptr_);
+      entity_pool_.emplace(name, PooledEntity{entity, entity->makeSnapshot()});
+      insertEntity(name, entity);
+      return true;
     }
   }
 
@@ -374,6 +539,31 @@ public:
   void update(const double current_time, const double step_time);
 
   void updateHdmapMarker();
+
+private:
+  auto insertEntity(
+    const std::string & name, const std::shared_ptr<traffic_simulator::entity::EntityBase> &)
+    -> EntityHandle;
+
+  auto isEgo(const EntitySlot &) const -> bool;
+
+  auto makeGoalPoses(std::size_t index) -> const std::vector<geometry_msgs::msg::Pose> &;
+
+  auto makeObstacle(std::size_t index)
+    -> const boost::optional<traffic_simulator_msgs::msg::Obstacle> &;
+
+  auto makeWaypoints(std::size_t index) -> const traffic_simulator_msgs::msg::WaypointsArray &;
+
+  auto planCache(std::size_t index) -> PlanCache &;
+
+  auto publishEntityStatusArray() -> void;
+
+  auto rebuildEntityIndex() -> void;
+
+  auto updateNpcLogic(
+    const EntitySlot &,
+    const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list)
+    -> traffic_simulator_msgs::msg::EntityStatus;
 };
 }  // namespace entity
 }  // namespace traffic_simulator
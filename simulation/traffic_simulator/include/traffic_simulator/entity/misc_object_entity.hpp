@@ -99,6 +99,11 @@ public:
 
   void setDriverModel(const traffic_simulator_msgs::msg::DriverModel &) override;
 
+  auto getMiscObjectParameters() const -> const traffic_simulator_msgs::msg::MiscObjectParameters &
+  {
+    return params_;
+  }
+
 private:
   const traffic_simulator_msgs::msg::MiscObjectParameters params_;
 };
@@ -15,6 +15,7 @@
 #ifndef TRAFFIC_SIMULATOR__ENTITY__PEDESTRIAN_ENTITY_HPP_
 #define TRAFFIC_SIMULATOR__ENTITY__PEDESTRIAN_ENTITY_HPP_
 
+#include <any>
 #include <boost/optional.hpp>
 #include <memory>
 #include <pluginlib/class_loader.hpp>
@@ -57,6 +58,13 @@ public:
 
   ~PedestrianEntity() override = default;
 
+  struct Snapshot : public EntityBase::Snapshot
+  {
+    std::any behavior;
+
+    std::shared_ptr<const traffic_simulator::RoutePlanner> route_planner;
+  };
+
   const traffic_simulator_msgs::msg::PedestrianParameters parameters;
 
   void appendDebugMarker(visualization_msgs::msg::MarkerArray & marker_array) override;
@@ -67,8 +75,12 @@ public:
     return result;
   }
 
+  auto makeSnapshot() const -> std::shared_ptr<const EntityBase::Snapshot> override;
+
   void onUpdate(double current_time, double step_time) override;
 
+  auto restore(const EntityBase::Snapshot &) -> void override;
+
   void requestAcquirePosition(
     const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose) override;
 
@@ -141,6 +153,9 @@ public:
 
   const std::string plugin_name;
 
+protected:
+  auto save(Snapshot &) const -> void;
+
 private:
   pluginlib::ClassLoader<entity_behavior::BehaviorPluginBase> loader_;
   std::shared_ptr<entity_behavior::BehaviorPluginBase> behavior_plugin_ptr_;
@@ -15,6 +15,7 @@
 #ifndef TRAFFIC_SIMULATOR__ENTITY__VEHICLE_ENTITY_HPP_
 #define TRAFFIC_SIMULATOR__ENTITY__VEHICLE_ENTITY_HPP_
 
+#include <any>
 #include <boost/optional.hpp>
 #include <memory>
 #include <pluginlib/class_loader.hpp>
@@ -60,6 +61,15 @@ public:
 
   ~VehicleEntity() override = default;
 
+  struct Snapshot : public EntityBase::Snapshot
+  {
+    std::any behavior;
+
+    std::shared_ptr<const traffic_simulator::RoutePlanner> route_planner;
+
+    std::vector<std::int64_t> previous_route_lanelets;
+  };
+
   const traffic_simulator_msgs::msg::VehicleParameters parameters;
 
   void appendDebugMarker(visualization_msgs::msg::MarkerArray & marker_array) override;
@@ -70,8 +80,12 @@ public:
     return result;
   }
 
+  auto makeSnapshot() const -> std::shared_ptr<const EntityBase::Snapshot> override;
+
   void onUpdate(double current_time, double step_time) override;
 
+  auto restore(const EntityBase::Snapshot &) -> void override;
+
   void requestAcquirePosition(const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose);
 
   void requestAcquirePosition(const geometry_msgs::msg::Pose & map_pose) override;
@@ -163,6 +177,9 @@ public:
   }
   const std::string plugin_name;
 
+protected:
+  auto save(Snapshot &) const -> void;
+
 private:
   pluginlib::ClassLoader<entity_behavior::BehaviorPluginBase> loader_;
   std::shared_ptr<entity_behavior::BehaviorPluginBase> behavior_plugin_ptr_;
@@ -190,6 +190,10 @@ private:
     const traffic_simulator_msgs::msg::LaneletPose & to_pose,
     const traffic_simulator::lane_change::TrajectoryShape trajectory_shape,
     double tangent_vector_size = 100);
+  boost::optional<traffic_simulator::math::HermiteCurve> makeLaneChangeTrajectoryTo(
+    const geometry_msgs::msg::Pose & from_pose,
+    const traffic_simulator::lane_change::Parameter & lane_change_parameter, double to_s,
+    double maximum_curvature_threshold, double forward_distance_threshold);
   RouteCache route_cache_;
   CenterPointsCache center_points_cache_;
   LaneletLengthCache lanelet_length_cache_;
@@ -15,12 +15,33 @@
 #ifndef TRAFFIC_SIMULATOR__MATH__POLYNOMIAL_SOLVER_HPP_
 #define TRAFFIC_SIMULATOR__MATH__POLYNOMIAL_SOLVER_HPP_
 
-#include <vector>
+#include <array>
+#include <cstddef>
 
 namespace traffic_simulator
 {
 namespace math
 {
+/**
+ * @brief real roots of polynomial equations up to cubic, stored in a fixed capacity array in order not to
+ * allocate heap memory.
+ */
+class PolynomialRoots
+{
+public:
+  static constexpr std::size_t capacity = 3;
+  void push_back(double value);  // NOTE: Throws SimulationError if already full.
+  std::size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+  double operator[](std::size_t index) const { return values_[index]; }
+  const double * begin() const { return values_.data(); }
+  const double * end() const { return values_.data() + size_; }
+
+private:
+  std::array<double, capacity> values_;
+  std::size_t size_ = 0;
+};
+
 class PolynomialSolver
 {
 public:
@@ -29,18 +50,18 @@ public:
  *
  * @param a
  * @param b
- * @return std::vector<double> real root of the quadratic functions (from 0 to 1)
+ * @return PolynomialRoots real root of the linear functions (from min_value to max_value)
  */
-  std::vector<double> solveLinearEquation(
+  PolynomialRoots solveLinearEquation(
     double a, double b, double min_value = 0, double max_value = 1) const;
   /**
  * @brief solve quadratic equation a*x^2 + b*x + c = 0
  *
  * @param a
  * @param b
- * @return std::vector<double> real root of the quadratic functions (from 0 to 1)
+ * @return PolynomialRoots real root of the quadratic functions (from min_value to max_value)
  */
-  std::vector<double> solveQuadraticEquation(
+  PolynomialRoots solveQuadraticEquation(
     double a, double b, double c, double min_value = 0, double max_value = 1) const;
   /**
  * @brief solve cubic function a*t^3 + b*t^2 + c*t + d = 0
@@ -49,9 +70,10 @@ public:
  * @param b
  * @param c
  * @param d
- * @return std::vector<double> real root of the cubic functions (from 0 to 1)
+ * @return PolynomialRoots real root of the cubic functions (from min_value to max_value),
+ *         each root is refined by Newton's method on the original coefficients.
  */
-  std::vector<double> solveCubicEquation(
+  PolynomialRoots solveCubicEquation(
     double a, double b, double c, double d, double min_value = 0, double max_value = 1) const;
   /**
  * @brief calculate result of cubic function a*t^3 + b*t^2 + c*t + d
@@ -97,7 +119,17 @@ private:
            if return value is 2, 2 real roots: x[0], x[1],
            if return value is 1, 1 real root : x[0], x[1] ± i*x[2],
  */
-  int solveP3(std::vector<double> & x, double a, double b, double c) const;
+  int solveP3(std::array<double, 3> & x, double a, double b, double c) const;
+  /**
+ * @brief polish a root of a*t^3 + b*t^2 + c*t + d = 0 by Newton's method,
+ *        iteration stops when the residual does not decrease (e.g. around double roots)
+ */
+  double refineCubicRoot(double a, double b, double c, double d, double t) const;
+  /**
+ * @brief append the value to the roots if it is in [min_value, max_value]
+ *        values out of the range within the tolerance are clamped into the range
+ */
+  void appendRoot(PolynomialRoots & roots, double value, double min_value, double max_value) const;
   double _root3(double x) const;
   double root3(double x) const;
 };
@@ -48,7 +48,16 @@ public:
 protected:
   std::shared_ptr<traffic_simulator::entity::EntityManager> entity_manager_ptr_;
 
+  /**
+   * @brief Handle of the entity, looked up by name only when the entity has been (re)spawned
+   *        since the last call.
+   */
+  auto getEntityHandle(const std::string & name) -> const traffic_simulator::entity::EntityHandle &;
+
 private:
+  std::string entity_name_;
+  traffic_simulator::entity::EntityHandle entity_handle_;
+
   boost::optional<common::scenario_simulator_exception::SpecificationViolation> error_;
   MetricLifecycle lifecycle_;
 };
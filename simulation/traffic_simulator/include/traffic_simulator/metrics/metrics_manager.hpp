@@ -15,25 +15,31 @@
 #ifndef TRAFFIC_SIMULATOR__METRICS__METRICS_MANAGER_HPP_
 #define TRAFFIC_SIMULATOR__METRICS__METRICS_MANAGER_HPP_
 
-#include <fstream>
+#include <boost/circular_buffer.hpp>
 #include <memory>
 #include <nlohmann/json.hpp>
 #include <string>
 #include <traffic_simulator/entity/entity_manager.hpp>
 #include <traffic_simulator/metrics/metric_base.hpp>
+#include <traffic_simulator/metrics/metrics_writer.hpp>
 #include <unordered_map>
 #include <utility>
 
 namespace metrics
 {
+/**
+ * @brief write each frame to log_path as a line of JSON Lines: {"time": <simulation time>,
+ * "metrics": {<name>: <metric>, ...}}.
+ *
+ * Only metrics whose JSON differs from the one written last are written, and a frame without such
+ * metrics is skipped. The last history_size frames are kept for failure reports.
+ */
 class MetricsManager
 {
 public:
   explicit MetricsManager(
     const boost::filesystem::path & log_path, const bool verbose = false,
-    const bool write_file_every_frame = false);
-
-  ~MetricsManager() { file_ << log_; }
+    const std::size_t history_size = 100);
 
   void setVerbose(const bool verbose);
 
@@ -52,22 +58,24 @@ public:
 
   const boost::filesystem::path log_path;
 
-  const bool write_file_every_frame;
-
   MetricLifecycle getLifecycle(const std::string & name);
 
   bool exists(const std::string & name) const;
 
+  auto getHistory() const -> const boost::circular_buffer<nlohmann::json> & { return history_; }
+
 private:
   bool verbose_;
 
-  nlohmann::json log_;
+  boost::circular_buffer<nlohmann::json> history_;
 
   std::unordered_map<std::string, std::shared_ptr<MetricBase>> metrics_;
 
+  std::unordered_map<std::string, nlohmann::json> written_metrics_;
+
   std::shared_ptr<traffic_simulator::entity::EntityManager> entity_manager_ptr_;
 
-  std::ofstream file_;
+  MetricsWriter writer_;
 };
 }  // namespace metrics
 
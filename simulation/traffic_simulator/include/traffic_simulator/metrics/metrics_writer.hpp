@@ -0,0 +1,61 @@
+// Copyright 2015-2021 TierIV.inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__METRICS__METRICS_WRITER_HPP_
+#define TRAFFIC_SIMULATOR__METRICS__METRICS_WRITER_HPP_
+
+#include <boost/filesystem.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace metrics
+{
+/**
+ * @brief append lines to a file in order on a single writer thread.
+ *
+ * write() blocks while `capacity` lines are waiting, so a slow disk slows down the simulation
+ * instead of growing the memory. The file is flushed whenever the queue runs empty, and the
+ * remaining lines are written on destruction.
+ */
+class MetricsWriter
+{
+  std::ofstream file;
+
+  const std::size_t capacity;
+
+  std::mutex mutex;
+
+  std::condition_variable condition;
+
+  std::deque<std::string> lines;
+
+  bool stopped = false;
+
+  std::thread writer;
+
+public:
+  explicit MetricsWriter(const boost::filesystem::path &, std::size_t capacity = 1024);
+
+  ~MetricsWriter();
+
+  void write(std::string line);
+};
+}  // namespace metrics
+
+#endif  // TRAFFIC_SIMULATOR__METRICS__METRICS_WRITER_HPP_
@@ -28,6 +28,7 @@ public:
   void update();
   double getCurrentSimulationTime() const { return current_simulation_time_; }
   double getStepTime() const { return step_time_; }
+  void setCurrentSimulationTime(double current_simulation_time);
   const rclcpp::Time getCurrentRosTime();
   const rosgraph_msgs::msg::Clock getCurrentRosTimeAsMsg();
   const bool use_raw_clock;
@@ -0,0 +1,85 @@
+/**
+ * @file traffic_sink_grid.hpp
+ * @brief class definition of the traffic sinks indexed in a grid
+ * @version 0.1
+ * @date 2021-10-19
+ *
+ * @copyright Copyright(c) Tier IV.Inc {2015-2021}
+ *
+ */
+
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SINK_GRID_HPP_
+#define TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SINK_GRID_HPP_
+
+#include <boost/functional/hash.hpp>
+#include <cstdint>
+#include <functional>
+#include <geometry_msgs/msg/pose.hpp>
+#include <string>
+#include <traffic_simulator/traffic/traffic_module_base.hpp>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace traffic
+{
+/**
+ * @brief traffic sinks behaving like one TrafficSink each, testing each entity only against the
+ * sinks of its grid cell.
+ *
+ * Each sink is registered in every cell its circle overlaps, so a frame costs one pass over the
+ * entities however many sinks there are.
+ */
+class TrafficSinkGrid : public TrafficModuleBase
+{
+public:
+  explicit TrafficSinkGrid(
+    double cell_size,
+    const std::function<std::vector<std::string>(void)> & get_entity_names_function,
+    const std::function<geometry_msgs::msg::Pose(const std::string &)> & get_entity_pose_function,
+    const std::function<void(std::string)> & despawn_function);
+  const double cell_size;
+  void addSink(double radius, const geometry_msgs::msg::Point & position);
+  auto getSinkCount() const -> std::size_t;
+  void execute() override;
+
+private:
+  struct Sink
+  {
+    double radius;
+
+    geometry_msgs::msg::Point position;
+  };
+
+  using Cell = std::pair<std::int64_t, std::int64_t>;
+
+  auto getCell(double x, double y) const -> Cell;
+
+  std::unordered_map<Cell, std::vector<Sink>, boost::hash<Cell>> cells_;
+
+  std::size_t sink_count_ = 0;
+
+  const std::function<std::vector<std::string>(void)> get_entity_names_function;
+  const std::function<geometry_msgs::msg::Pose(const std::string &)> get_entity_pose_function;
+  const std::function<void(const std::string &)> despawn_function;
+};
+}  // namespace traffic
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SINK_GRID_HPP_
@@ -0,0 +1,101 @@
+/**
+ * @file traffic_source.hpp
+ * @brief class definition of the traffic source
+ * @version 0.1
+ * @date 2021-10-19
+ *
+ * @copyright Copyright(c) Tier IV.Inc {2015-2021}
+ *
+ */
+
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SOURCE_HPP_
+#define TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SOURCE_HPP_
+
+#include <functional>
+#include <geometry_msgs/msg/pose.hpp>
+#include <string>
+#include <traffic_simulator/traffic/traffic_module_base.hpp>
+#include <traffic_simulator_msgs/msg/lanelet_pose.hpp>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace traffic
+{
+/**
+ * @brief spawn entities at a lanelet pose at most flow_rate times per second of simulation time,
+ * while both of the following hold.
+ *
+ * - No entity is nearer than the distance travelled at speed in minimum_headway seconds, or than
+ *   minimum_gap meters.
+ * - Fewer than maximum_density * density_range entities are within density_range meters.
+ *
+ * Held back spawns are not made up for later, except for at most one. The entities are named
+ * "<name>_<index>", and the name of a despawned entity is given to the next spawn, so that
+ * spawn_function may reuse the entity of that name.
+ */
+class TrafficSource : public TrafficModuleBase
+{
+public:
+  struct Parameters
+  {
+    double flow_rate = 0.5;  // [1/s]
+
+    double speed = 10;  // [m/s]
+
+    double minimum_headway = 2;  // [s]
+
+    double minimum_gap = 10;  // [m]
+
+    double maximum_density = 0.05;  // [1/m]
+
+    double density_range = 100;  // [m]
+  };
+
+  explicit TrafficSource(
+    const std::string & name, const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose,
+    const geometry_msgs::msg::Point & position, const Parameters & parameters,
+    const std::function<std::vector<std::string>(void)> & get_entity_names_function,
+    const std::function<geometry_msgs::msg::Pose(const std::string &)> & get_entity_pose_function,
+    const std::function<bool(
+      const std::string &, const traffic_simulator_msgs::msg::LaneletPose &, double)> &
+      spawn_function,
+    const std::function<double(void)> & get_current_time_function);
+  const std::string name;
+  const traffic_simulator_msgs::msg::LaneletPose lanelet_pose;
+  const geometry_msgs::msg::Point position;
+  const Parameters parameters;
+  void execute() override;
+  auto getSpawnCount() const -> std::size_t;
+
+private:
+  auto isBlocked(const std::vector<std::string> & names) const -> bool;
+  auto nextEntityName(const std::vector<std::string> & names) -> const std::string &;
+  const std::function<std::vector<std::string>(void)> get_entity_names_function;
+  const std::function<geometry_msgs::msg::Pose(const std::string &)> get_entity_pose_function;
+  const std::function<bool(
+    const std::string &, const traffic_simulator_msgs::msg::LaneletPose &, double)>
+    spawn_function;
+  const std::function<double(void)> get_current_time_function;
+  std::vector<std::string> entity_names_;
+  std::size_t spawn_count_ = 0;
+  double next_spawn_time_;
+};
+}  // namespace traffic
+}  // namespace traffic_simulator
+
+#endif  // TRAFFIC_SIMULATOR__TRAFFIC__TRAFFIC_SOURCE_HPP_
@@ -103,6 +103,15 @@ public:
 
   auto hasAnyLightChanged() -> bool;
 
+  using Snapshot = std::unordered_map<LaneletID, TrafficLight>;
+
+  auto makeSnapshot() const -> Snapshot { return traffic_lights_; }
+
+  auto restore(const Snapshot & snapshot) -> void
+  {
+    traffic_lights_ = Snapshot(snapshot);  // NOTE: TrafficLight is not copy-assignable.
+  }
+
   auto update(const double) -> void;
 };
 
@@ -19,6 +19,7 @@
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/LU>
 #include <iostream>
+#include <memory>
 #include <queue>
 #include <traffic_simulator/vehicle_model/sim_model_interface.hpp>
 
@@ -48,6 +49,14 @@ public:
    */
   ~SimModelDelaySteerAccGeared() = default;
 
+  /**
+   * @brief make a copy of this model, including its state and input buffers
+   */
+  std::shared_ptr<SimModelInterface> clone() const override
+  {
+    return std::make_shared<SimModelDelaySteerAccGeared>(*this);
+  }
+
 private:
   const float64_t MIN_TIME_CONSTANT;  //!< @brief minimum time constant
 
@@ -18,6 +18,7 @@
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/LU>
 #include <iostream>
+#include <memory>
 #include <traffic_simulator/vehicle_model/sim_model_interface.hpp>
 
 /**
@@ -38,6 +39,14 @@ public:
    */
   ~SimModelIdealSteerAcc() = default;
 
+  /**
+   * @brief make a copy of this model, including its state and input buffers
+   */
+  std::shared_ptr<SimModelInterface> clone() const override
+  {
+    return std::make_shared<SimModelIdealSteerAcc>(*this);
+  }
+
 private:
   enum IDX { X = 0, Y, YAW, VX };
 
@@ -17,6 +17,7 @@
 
 #include <autoware_auto_vehicle_msgs/msg/gear_command.hpp>
 #include <eigen3/Eigen/Core>
+#include <memory>
 
 using bool8_t = bool;
 using float32_t = float;
@@ -50,6 +51,11 @@ public:
    */
   ~SimModelInterface() = default;
 
+  /**
+   * @brief make a copy of this model, including its state and input buffers
+   */
+  virtual std::shared_ptr<SimModelInterface> clone() const = 0;
+
   /**
    * @brief get state vector of model
    * @param [out] state state vector
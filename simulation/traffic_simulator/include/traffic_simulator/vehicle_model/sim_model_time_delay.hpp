@@ -26,6 +26,7 @@
 #include <eigen3/Eigen/Core>
 #include <eigen3/Eigen/LU>
 #include <iostream>
+#include <memory>
 #include <queue>
 #include <traffic_simulator/vehicle_model/sim_model_interface.hpp>
 #include <traffic_simulator/vehicle_model/sim_model_util.hpp>
@@ -60,6 +61,14 @@ public:
    */
   ~SimModelTimeDelayTwist() = default;
 
+  /**
+   * @brief make a copy of this model, including its state and input buffers
+   */
+  std::shared_ptr<SimModelInterface> clone() const override
+  {
+    return std::make_shared<SimModelTimeDelayTwist>(*this);
+  }
+
 private:
   const double MIN_TIME_CONSTANT;  //!< @brief minimum time constant
 
@@ -166,6 +175,14 @@ public:
    */
   ~SimModelTimeDelaySteer() = default;
 
+  /**
+   * @brief make a copy of this model, including its state and input buffers
+   */
+  std::shared_ptr<SimModelInterface> clone() const override
+  {
+    return std::make_shared<SimModelTimeDelaySteer>(*this);
+  }
+
 private:
   const double MIN_TIME_CONSTANT;  //!< @brief minimum time constant
 
@@ -272,6 +289,14 @@ public:
    */
   ~SimModelTimeDelaySteerAccel() = default;
 
+  /**
+   * @brief make a copy of this model, including its state and input buffers
+   */
+  std::shared_ptr<SimModelInterface> clone() const override
+  {
+    return std::make_shared<SimModelTimeDelaySteerAccel>(*this);
+  }
+
 private:
   const double MIN_TIME_CONSTANT;  //!< @brief minimum time constant
 
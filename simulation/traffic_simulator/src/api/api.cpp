@@ -14,6 +14,7 @@
 
 #include <tf2/LinearMath/Quaternion.h>
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <rclcpp/rclcpp.hpp>
@@ -48,7 +49,7 @@ bool API::despawn(const std::string & name)
     simulation_api_schema::DespawnEntityRequest req;
     simulation_api_schema::DespawnEntityResponse res;
     req.set_name(name);
-    zeromq_client_.call(req, res);
+    simulator_client_.call(req, res);
     return res.result().success();
   }
   return true;
@@ -71,21 +72,8 @@ bool API::spawn(
     }
   };
 
-  auto register_to_environment_simulator = [&]() {
-    if (configuration.standalone_mode) {
-      return true;
-    } else {
-      simulation_api_schema::SpawnVehicleEntityRequest req;
-      simulation_api_schema::SpawnVehicleEntityResponse res;
-      simulation_interface::toProto(parameters, *req.mutable_parameters());
-      req.mutable_parameters()->set_name(name);
-      req.set_is_ego(behavior == VehicleBehavior::autoware());
-      zeromq_client_.call(req, res);
-      return res.result().success();
-    }
-  };
-
-  return register_to_entity_manager() and register_to_environment_simulator();
+  return register_to_entity_manager() and
+         registerToEnvironmentSimulator(name, parameters, behavior == VehicleBehavior::autoware());
 }
 
 bool API::spawn(
@@ -98,20 +86,7 @@ bool API::spawn(
     return entity_manager_ptr_->spawnEntity<PedestrianEntity>(name, parameters, behavior);
   };
 
-  auto register_to_environment_simulator = [&]() {
-    if (configuration.standalone_mode) {
-      return true;
-    } else {
-      simulation_api_schema::SpawnPedestrianEntityRequest req;
-      simulation_api_schema::SpawnPedestrianEntityResponse res;
-      simulation_interface::toProto(parameters, *req.mutable_parameters());
-      req.mutable_parameters()->set_name(name);
-      zeromq_client_.call(req, res);
-      return res.result().success();
-    }
-  };
-
-  return register_to_entity_manager() and register_to_environment_simulator();
+  return register_to_entity_manager() and registerToEnvironmentSimulator(name, parameters);
 }
 
 bool API::spawn(
@@ -123,35 +98,102 @@ bool API::spawn(
     return entity_manager_ptr_->spawnEntity<MiscObjectEntity>(name, parameters);
   };
 
-  auto register_to_environment_simulator = [&]() {
-    if (configuration.standalone_mode) {
-      return true;
-    } else {
-      simulation_api_schema::SpawnMiscObjectEntityRequest req;
-      simulation_api_schema::SpawnMiscObjectEntityResponse res;
-      simulation_interface::toProto(parameters, *req.mutable_parameters());
-      req.mutable_parameters()->set_name(name);
-      zeromq_client_.call(req, res);
-      return res.result().success();
-    }
+  return register_to_entity_manager() and registerToEnvironmentSimulator(name, parameters);
+}
+
+void API::addTrafficSource(
+  const std::string & name, const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose,
+  const traffic::TrafficSource::Parameters & parameters,
+  const traffic_simulator_msgs::msg::VehicleParameters & vehicle_parameters,
+  const std::string & behavior)
+{
+  auto spawn = [this, vehicle_parameters, behavior](
+                 const auto & entity_name, const auto & entity_lanelet_pose, auto speed) {
+    using traffic_simulator::entity::VehicleEntity;
+    return entity_manager_ptr_->spawnPooledEntity<VehicleEntity>(
+             entity_name, vehicle_parameters, behavior) and
+           registerToEnvironmentSimulator(entity_name, vehicle_parameters, false) and
+           setEntityStatus(
+             entity_name, entity_lanelet_pose, helper::constructActionStatus(speed));
   };
 
-  return register_to_entity_manager() and register_to_environment_simulator();
+  traffic_controller_ptr_->addModule<traffic::TrafficSource>(
+    name, lanelet_pose, entity_manager_ptr_->toMapPose(lanelet_pose).position, parameters,
+    [this]() { return getEntityNames(); },
+    [this](const auto & entity_name) { return getEntityPose(entity_name); }, spawn,
+    [this]() { return getCurrentTime(); });
+}
+
+bool API::registerToEnvironmentSimulator(
+  const std::string & name, const traffic_simulator_msgs::msg::VehicleParameters & parameters,
+  const bool is_ego)
+{
+  if (configuration.standalone_mode) {
+    return true;
+  } else {
+    simulation_api_schema::SpawnVehicleEntityRequest req;
+    simulation_api_schema::SpawnVehicleEntityResponse res;
+    simulation_interface::toProto(parameters, *req.mutable_parameters());
+    req.mutable_parameters()->set_name(name);
+    req.set_is_ego(is_ego);
+    simulator_client_.call(req, res);
+    return res.result().success();
+  }
+}
+
+bool API::registerToEnvironmentSimulator(
+  const std::string & name, const traffic_simulator_msgs::msg::PedestrianParameters & parameters)
+{
+  if (configuration.standalone_mode) {
+    return true;
+  } else {
+    simulation_api_schema::SpawnPedestrianEntityRequest req;
+    simulation_api_schema::SpawnPedestrianEntityResponse res;
+    simulation_interface::toProto(parameters, *req.mutable_parameters());
+    req.mutable_parameters()->set_name(name);
+    simulator_client_.call(req, res);
+    return res.result().success();
+  }
+}
+
+bool API::registerToEnvironmentSimulator(
+  const std::string & name, const traffic_simulator_msgs::msg::MiscObjectParameters & parameters)
+{
+  if (configuration.standalone_mode) {
+    return true;
+  } else {
+    simulation_api_schema::SpawnMiscObjectEntityRequest req;
+    simulation_api_schema::SpawnMiscObjectEntityResponse res;
+    simulation_interface::toProto(parameters, *req.mutable_parameters());
+    req.mutable_parameters()->set_name(name);
+    simulator_client_.call(req, res);
+    return res.result().success();
+  }
 }
 
 geometry_msgs::msg::Pose API::getEntityPose(const std::string & name)
 {
-  auto status = getEntityStatus(name);
-  return status.pose;
+  return getEntityStatus(name)->pose;
 }
 
-traffic_simulator_msgs::msg::EntityStatus API::getEntityStatus(const std::string & name)
+auto API::getEntityStatus(const std::string & name)
+  -> std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus>
 {
-  auto status = entity_manager_ptr_->getEntityStatus(name);
+  const auto status = entity_manager_ptr_->getEntityStatus(name);
   if (!status) {
     THROW_SEMANTIC_ERROR("entity : ", name, " status is empty");
   }
-  return status.get();
+  return status;
+}
+
+auto API::getEntityStatus(const traffic_simulator::entity::EntityHandle & handle)
+  -> std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus>
+{
+  const auto status = entity_manager_ptr_->getEntityStatus(handle);
+  if (!status) {
+    THROW_SEMANTIC_ERROR("entity handle ", handle, " status is empty");
+  }
+  return status;
 }
 
 bool API::setEntityStatus(
@@ -195,14 +237,23 @@ bool API::setEntityStatus(
 
 boost::optional<double> API::getTimeHeadway(const std::string & from, const std::string & to)
 {
-  if (!entity_manager_ptr_->entityStatusSet(from) || !entity_manager_ptr_->entityStatusSet(to)) {
+  return getTimeHeadway(
+    entity_manager_ptr_->getEntityHandle(from), entity_manager_ptr_->getEntityHandle(to));
+}
+
+boost::optional<double> API::getTimeHeadway(
+  const traffic_simulator::entity::EntityHandle & from,
+  const traffic_simulator::entity::EntityHandle & to)
+{
+  const auto & to_entity = entity_manager_ptr_->getEntity(to);
+  if (!entity_manager_ptr_->getEntity(from)->statusSet() || !to_entity->statusSet()) {
     return boost::none;
   }
-  geometry_msgs::msg::Pose pose = getRelativePose(from, to);
+  geometry_msgs::msg::Pose pose = entity_manager_ptr_->getRelativePose(from, to);
   if (pose.position.x > 0) {
     return boost::none;
   }
-  traffic_simulator_msgs::msg::EntityStatus to_status = getEntityStatus(to);
+  const auto & to_status = to_entity->getStatus();
   double ret = (pose.position.x * -1) / (to_status.action_status.twist.linear.x);
   if (std::isnan(ret)) {
     return std::numeric_limits<double>::infinity();
@@ -280,7 +331,7 @@ bool API::initialize(double realtime_factor, double step_time)
     req.set_step_time(step_time);
     req.set_realtime_factor(realtime_factor);
     simulation_api_schema::InitializeResponse res;
-    zeromq_client_.call(req, res);
+    simulator_client_.call(req, res);
     return res.result().success();
   }
 }
@@ -294,7 +345,7 @@ bool API::attachDetectionSensor(
     simulation_api_schema::AttachDetectionSensorRequest req;
     simulation_api_schema::AttachDetectionSensorResponse res;
     *req.mutable_configuration() = sensor_configuration;
-    zeromq_client_.call(req, res);
+    simulator_client_.call(req, res);
     return res.result().success();
   }
 }
@@ -313,7 +364,7 @@ bool API::attachLidarSensor(const simulation_api_schema::LidarConfiguration & li
     simulation_api_schema::AttachLidarSensorRequest req;
     simulation_api_schema::AttachLidarSensorResponse res;
     *req.mutable_configuration() = lidar_configuration;
-    zeromq_client_.call(req, res);
+    simulator_client_.call(req, res);
     return res.result().success();
   }
 }
@@ -334,7 +385,7 @@ bool API::updateSensorFrame()
     simulation_interface::toProto(
       clock_.getCurrentRosTimeAsMsg().clock, *req.mutable_current_ros_time());
     simulation_api_schema::UpdateSensorFrameResponse res;
-    zeromq_client_.call(req, res);
+    simulator_client_.call(req, res);
     return res.result().success();
   }
 }
@@ -350,15 +401,19 @@ bool API::updateTrafficLightsInSim()
         static_cast<autoware_auto_perception_msgs::msg::TrafficSignal>(traffic_light), state);
       *req.add_states() = state;
     }
-    zeromq_client_.call(req, res);
+    simulator_client_.call(req, res);
   }
   // TODO handle response
   return res.result().success();
 }
 
+/**
+ * @brief send the status of every entity in a request built on an arena reset every frame.
+ */
 bool API::updateEntityStatusInSim()
 {
-  simulation_api_schema::UpdateEntityStatusRequest req;
+  entity_status_arena_.reset();
+  auto & req = entity_status_arena_.create<simulation_api_schema::UpdateEntityStatusRequest>();
   if (entity_manager_ptr_->getNumberOfEgo() != 0) {
     simulation_interface::toProto(
       entity_manager_ptr_->getVehicleCommand(entity_manager_ptr_->getEgoName()),
@@ -374,24 +429,21 @@ bool API::updateEntityStatusInSim()
     }
   }
   const auto names = entity_manager_ptr_->getEntityNames();
-  for (const auto name : names) {
-    auto status = entity_manager_ptr_->getEntityStatus(name);
+  for (const auto & name : names) {
+    const auto status = entity_manager_ptr_->getEntityStatus(name);
     if (status) {
-      traffic_simulator_msgs::EntityStatus proto;
-      status.get().name = name;
-      simulation_interface::toProto(status.get(), proto);
-      *req.add_status() = proto;
+      simulation_interface::toProto(*status, *req.add_status());
     }
   }
-  simulation_api_schema::UpdateEntityStatusResponse res;
-  zeromq_client_.call(req, res);
-  for (const auto status : res.status()) {
+  auto & res = entity_status_arena_.create<simulation_api_schema::UpdateEntityStatusResponse>();
+  simulator_client_.call(req, res);
+  for (const auto & status : res.status()) {
     auto entity_status = entity_manager_ptr_->getEntityStatus(status.name());
     if (!entity_status) {
       continue;
     }
     traffic_simulator_msgs::msg::EntityStatus status_msg;
-    status_msg = entity_status.get();
+    status_msg = *entity_status;
     geometry_msgs::msg::Pose pose;
     simulation_interface::toMsg(status.pose(), pose);
     status_msg.pose = pose;
@@ -411,8 +463,29 @@ bool API::updateEntityStatusInSim()
   return res.result().success();
 }
 
+API::~API()
+{
+  if (not configuration.profile_path.empty()) {
+    common::profiler::enable(false);
+    common::profiler::writeChromeTrace(configuration.profile_path.string());
+    common::profiler::clear();  // NOTE: Spans must not be carried over to the next API.
+  }
+}
+
+void API::publishDebugMarker()
+{
+  if (
+    debug_marker_pub_->get_subscription_count() > 0 and
+    debug_marker_frame_count_++ %
+        std::max<std::size_t>(configuration.debug_marker_publish_decimation, 1) ==
+      0) {
+    debug_marker_pub_->publish(entity_manager_ptr_->makeDebugMarker());
+  }
+}
+
 bool API::updateFrame()
 {
+  PROFILE_SCOPE("API::updateFrame");
   boost::optional<traffic_simulator_msgs::msg::EntityStatus> ego_status_before_update = boost::none;
   entity_manager_ptr_->update(clock_.getCurrentSimulationTime(), clock_.getStepTime());
   traffic_controller_ptr_->execute();
@@ -423,14 +496,14 @@ bool API::updateFrame()
     simulation_interface::toProto(
       clock_.getCurrentRosTimeAsMsg().clock, *req.mutable_current_ros_time());
     simulation_api_schema::UpdateFrameResponse res;
-    zeromq_client_.call(req, res);
+    simulator_client_.call(req, res);
     if (!res.result().success()) {
       return false;
     }
     entity_manager_ptr_->broadcastEntityTransform();
     clock_.update();
     clock_pub_->publish(clock_.getCurrentRosTimeAsMsg());
-    debug_marker_pub_->publish(entity_manager_ptr_->makeDebugMarker());
+    publishDebugMarker();
     metrics_manager_.calculate();
     if (!updateEntityStatusInSim()) {
       return false;
@@ -441,12 +514,81 @@ bool API::updateFrame()
     entity_manager_ptr_->broadcastEntityTransform();
     clock_.update();
     clock_pub_->publish(clock_.getCurrentRosTimeAsMsg());
-    debug_marker_pub_->publish(entity_manager_ptr_->makeDebugMarker());
+    publishDebugMarker();
     metrics_manager_.calculate();
     return true;
   }
 }
 
+auto API::makeSnapshot() const -> Snapshot
+{
+  Snapshot snapshot;
+  snapshot.world = entity_manager_ptr_->makeSnapshot();
+  snapshot.simulation_time = clock_.getCurrentSimulationTime();
+  return snapshot;
+}
+
+/**
+ * @brief rewind the simulation clock, the entities and the traffic lights to the snapshot.
+ *
+ * Entities despawned since the snapshot are registered to the environment simulator again, and
+ * entities spawned since then are despawned from it. Metrics are not part of a snapshot.
+ */
+auto API::restore(const Snapshot & snapshot) -> bool
+{
+  const auto names_before_restore = entity_manager_ptr_->getEntityNames();
+
+  entity_manager_ptr_->restore(snapshot.world);
+  clock_.setCurrentSimulationTime(snapshot.simulation_time);
+
+  if (configuration.standalone_mode) {
+    return true;
+  } else {
+    auto exists_before_restore = [&](const auto & name) {
+      return std::find(names_before_restore.begin(), names_before_restore.end(), name) !=
+             names_before_restore.end();
+    };
+
+    for (const auto & name : names_before_restore) {
+      if (not entity_manager_ptr_->entityExists(name)) {
+        simulation_api_schema::DespawnEntityRequest req;
+        simulation_api_schema::DespawnEntityResponse res;
+        req.set_name(name);
+        simulator_client_.call(req, res);
+        if (not res.result().success()) {
+          return false;
+        }
+      }
+    }
+
+    for (const auto & name : entity_manager_ptr_->getEntityNames()) {
+      if (not exists_before_restore(name)) {
+        using traffic_simulator::entity::EgoEntity;
+        using traffic_simulator::entity::MiscObjectEntity;
+        using traffic_simulator::entity::PedestrianEntity;
+        using traffic_simulator::entity::VehicleEntity;
+        const auto entity = entity_manager_ptr_->getEntity(name);
+        if (const auto vehicle = std::dynamic_pointer_cast<VehicleEntity>(entity)) {
+          const auto is_ego = static_cast<bool>(std::dynamic_pointer_cast<EgoEntity>(entity));
+          if (not registerToEnvironmentSimulator(name, vehicle->parameters, is_ego)) {
+            return false;
+          }
+        } else if (const auto pedestrian = std::dynamic_pointer_cast<PedestrianEntity>(entity)) {
+          if (not registerToEnvironmentSimulator(name, pedestrian->parameters)) {
+            return false;
+          }
+        } else if (const auto misc_object = std::dynamic_pointer_cast<MiscObjectEntity>(entity)) {
+          if (not registerToEnvironmentSimulator(name, misc_object->getMiscObjectParameters())) {
+            return false;
+          }
+        }
+      }
+    }
+
+    return true;  // NOTE: Statuses and traffic lights are sent on the next updateFrame.
+  }
+}
+
 void API::requestLaneChange(const std::string & name, const std::int64_t & lanelet_id)
 {
   entity_manager_ptr_->requestLaneChange(name, lanelet_id);
@@ -309,6 +309,22 @@ auto EgoEntity::getWaypoints() -> const traffic_simulator_msgs::msg::WaypointsAr
   return autoware->getWaypoints();
 }
 
+auto EgoEntity::makeSnapshot() const -> std::shared_ptr<const EntityBase::Snapshot>
+{
+  auto snapshot = std::make_shared<Snapshot>();
+  save(*snapshot);
+  return snapshot;
+}
+
+auto EgoEntity::save(Snapshot & snapshot) const -> void
+{
+  VehicleEntity::save(snapshot);
+  snapshot.vehicle_model = vehicle_model_ptr_->clone();
+  snapshot.initial_pose = initial_pose_;
+  snapshot.previous_linear_velocity = previous_linear_velocity_;
+  snapshot.previous_angular_velocity = previous_angular_velocity_;
+}
+
 void EgoEntity::onUpdate(double current_time, double step_time)
 {
   EntityBase::onUpdate(current_time, step_time);
@@ -385,6 +401,24 @@ void EgoEntity::onUpdate(double current_time, double step_time)
 
 auto EgoEntity::ready() const -> bool { return autoware->ready(); }
 
+/**
+ * @brief restore the simulator side of the ego entity only.
+ *
+ * The Autoware process driving it keeps its own state (localization, planning, engagement).
+ */
+auto EgoEntity::restore(const EntityBase::Snapshot & snapshot) -> void
+{
+  if (const auto ego_snapshot = dynamic_cast<const Snapshot *>(&snapshot)) {
+    VehicleEntity::restore(snapshot);
+    vehicle_model_ptr_ = ego_snapshot->vehicle_model->clone();
+    initial_pose_ = ego_snapshot->initial_pose;
+    previous_linear_velocity_ = ego_snapshot->previous_linear_velocity;
+    previous_angular_velocity_ = ego_snapshot->previous_angular_velocity;
+  } else {
+    THROW_SIMULATION_ERROR("Snapshot of entity ", name, " is not a snapshot of an ego.");
+  }
+}
+
 void EgoEntity::requestAcquirePosition(
   const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose)
 {
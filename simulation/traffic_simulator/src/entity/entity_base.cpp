@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <limits>
+#include <memory>
 #include <queue>
 #include <rclcpp/rclcpp.hpp>
 #include <scenario_simulator_exception/exception.hpp>
@@ -37,6 +38,67 @@ void EntityBase::appendDebugMarker(visualization_msgs::msg::MarkerArray & /*mark
   return;
 }
 
+auto EntityBase::finalizeStatus(const double current_time) -> void
+{
+  finalized_time_ = current_time;
+  invalidateFinalizedStatus();
+  if (status_) {
+    getFinalizedStatus();
+  }
+}
+
+auto EntityBase::getFinalizedStatus() const
+  -> const std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus> &
+{
+  if (not finalized_status_) {
+    auto status = std::make_shared<traffic_simulator_msgs::msg::EntityStatus>(getStatus());
+    status->action_status.current_action = getCurrentAction();
+    status->time = finalized_time_;
+    finalized_status_ = std::move(status);
+  }
+  return finalized_status_;
+}
+
+auto EntityBase::makeSnapshot() const -> std::shared_ptr<const Snapshot>
+{
+  auto snapshot = std::make_shared<Snapshot>();
+  save(*snapshot);
+  return snapshot;
+}
+
+auto EntityBase::save(Snapshot & snapshot) const -> void
+{
+  snapshot.next_waypoint = next_waypoint_;
+  snapshot.status = status_;
+  snapshot.status_before_update = status_before_update_;
+  snapshot.waypoints = waypoints_;
+  snapshot.spline = spline_;
+  snapshot.visibility = visibility_;
+  snapshot.other_status = other_status_;
+  snapshot.entity_type_list = entity_type_list_;
+  snapshot.linear_jerk = linear_jerk_;
+  snapshot.stand_still_duration = stand_still_duration_;
+  snapshot.target_speed = target_speed_;
+  snapshot.job_list = traffic_simulator::job::JobList(job_list_);
+}
+
+auto EntityBase::restore(const Snapshot & snapshot) -> void
+{
+  next_waypoint_ = snapshot.next_waypoint;
+  status_ = snapshot.status;
+  status_before_update_ = snapshot.status_before_update;
+  waypoints_ = snapshot.waypoints;
+  spline_ = snapshot.spline;
+  visibility_ = snapshot.visibility;
+  other_status_ = snapshot.other_status;
+  entity_type_list_ = snapshot.entity_type_list;
+  linear_jerk_ = snapshot.linear_jerk;
+  stand_still_duration_ = snapshot.stand_still_duration;
+  target_speed_ = snapshot.target_speed;
+  job_list_ = traffic_simulator::job::JobList(snapshot.job_list);
+  invalidateFinalizedStatus();
+}
+
 void EntityBase::onUpdate(double, double)
 {
   job_list_.update();
@@ -301,6 +363,7 @@ void EntityBase::updateEntityStatusTimestamp(const double current_time)
 {
   if (status_) {
     status_->time = current_time;
+    invalidateFinalizedStatus();
   }
 }
 
@@ -323,16 +386,12 @@ void EntityBase::setOtherStatus(
   }
 }
 
-const traffic_simulator_msgs::msg::EntityStatus EntityBase::getStatus() const
+auto EntityBase::getStatus() const -> const traffic_simulator_msgs::msg::EntityStatus &
 {
   if (!status_) {
     THROW_SEMANTIC_ERROR("status is not set");
   } else {
-    auto status = this->status_.get();
-    status.bounding_box = getBoundingBox();
-    status.subtype = entity_subtype_;
-    status.type = entity_type_;
-    return status;
+    return status_.get();
   }
 }
 
@@ -340,6 +399,10 @@ bool EntityBase::setStatus(const traffic_simulator_msgs::msg::EntityStatus & sta
 {
   status_ = status;
   status_->name = name;
+  status_->bounding_box = getBoundingBox();
+  status_->subtype = entity_subtype_;
+  status_->type = entity_type_;
+  invalidateFinalizedStatus();
   return true;
 }
 
@@ -350,6 +413,7 @@ void EntityBase::stopAtEndOfRoad()
   } else {
     status_.get().action_status.twist = geometry_msgs::msg::Twist();
     status_.get().action_status.accel = geometry_msgs::msg::Accel();
+    invalidateFinalizedStatus();
   }
 }
 
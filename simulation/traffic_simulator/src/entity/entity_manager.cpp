@@ -12,11 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cstdint>
 #include <limits>
 #include <memory>
 #include <queue>
 #include <scenario_simulator_exception/exception.hpp>
+#include <simple_profiler/profiler.hpp>
 #include <sstream>
 #include <stdexcept>
 #include <string>
@@ -26,6 +28,7 @@
 #include <traffic_simulator/math/collision.hpp>
 #include <traffic_simulator/math/transform.hpp>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace traffic_simulator
@@ -83,43 +86,66 @@ bool EntityManager::checkCollision(const std::string & name0, const std::string
   if (!status1) {
     THROW_SEMANTIC_ERROR("failed to calculate map pose : " + name1);
   }
-  auto bbox0 = getBoundingBox(name0);
-  auto bbox1 = getBoundingBox(name1);
-  return traffic_simulator::math::checkCollision2D(status0->pose, bbox0, status1->pose, bbox1);
+  return traffic_simulator::math::checkCollision2D(
+    status0->pose, status0->bounding_box, status1->pose, status1->bounding_box);
 }
 
 visualization_msgs::msg::MarkerArray EntityManager::makeDebugMarker() const
 {
   visualization_msgs::msg::MarkerArray marker;
-  for (const auto & entity : entities_) {
-    entity.second->appendDebugMarker(marker);
+  for (const auto & slot : entity_slots_) {
+    if (slot.entity) {
+      slot.entity->appendDebugMarker(marker);
+    }
   }
   return marker;
 }
 
 bool EntityManager::despawnEntity(const std::string & name)
 {
-  return entityExists(name) && entities_.erase(name);
+  if (const auto iter = entity_handles_.find(name); iter == std::end(entity_handles_)) {
+    return false;
+  } else {
+    const auto despawned = iter->first;  // NOTE: name may refer to one of the names erased below.
+    free_entity_slots_.push_back(iter->second.index);
+    entity_slots_[iter->second.index] = EntitySlot();
+    entity_handles_.erase(iter);
+    entity_types_.erase(despawned);
+    entity_names_.erase(std::find(std::begin(entity_names_), std::end(entity_names_), despawned));
+    return true;
+  }
 }
 
 bool EntityManager::entityExists(const std::string & name)
 {
-  return entities_.find(name) != std::end(entities_);
+  return entity_handles_.find(name) != std::end(entity_handles_);
+}
+
+auto EntityManager::entityExists(const EntityHandle & handle) const noexcept -> bool
+{
+  return handle.index < entity_slots_.size() and entity_slots_[handle.index].entity and
+         entity_slots_[handle.index].generation == handle.generation;
 }
 
 bool EntityManager::entityStatusSet(const std::string & name) const
 {
-  return entities_.at(name)->statusSet();
+  return getEntity(name)->statusSet();
 }
 
 auto EntityManager::getBoundingBoxDistance(const std::string & from, const std::string & to)
   -> boost::optional<double>
 {
-  const auto bbox0 = getBoundingBox(from);
-  const auto pose0 = getMapPose(from);
-  const auto bbox1 = getBoundingBox(to);
-  const auto pose1 = getMapPose(to);
-  return math::getPolygonDistance(pose0, bbox0, pose1, bbox1);
+  return getBoundingBoxDistance(getEntityHandle(from), getEntityHandle(to));
+}
+
+auto EntityManager::getBoundingBoxDistance(const EntityHandle & from, const EntityHandle & to)
+  -> boost::optional<double>
+{
+  const auto & entity0 = getEntity(from);
+  const auto & entity1 = getEntity(to);
+  return math::getPolygonDistance(
+    entity0->getStatus().pose, entity0->getBoundingBox(), entity1->getStatus().pose,
+    entity1->getBoundingBox());
 }
 
 auto EntityManager::getCurrentTime() const noexcept -> double { return current_time_; }
@@ -127,14 +153,17 @@ auto EntityManager::getCurrentTime() const noexcept -> double { return current_t
 auto EntityManager::getDistanceToCrosswalk(
   const std::string & name, const std::int64_t target_crosswalk_id) -> boost::optional<double>
 {
-  const auto it = entities_.find(name);
-  if (it == entities_.end()) {
+  if (not entityExists(name)) {
+    return boost::none;
+  }
+  if (current_time_ < 0) {
     return boost::none;
   }
-  if (getWaypoints(name).waypoints.empty()) {
+  const auto & waypoints = makeWaypoints(getEntityHandle(name).index).waypoints;
+  if (waypoints.empty()) {
     return boost::none;
   }
-  traffic_simulator::math::CatmullRomSpline spline(getWaypoints(name).waypoints);
+  traffic_simulator::math::CatmullRomSpline spline(waypoints);
   auto polygon = hdmap_utils_ptr_->getLaneletPolygon(target_crosswalk_id);
   return spline.getCollisionPointIn2D(polygon);
 }
@@ -142,62 +171,76 @@ auto EntityManager::getDistanceToCrosswalk(
 auto EntityManager::getDistanceToStopLine(
   const std::string & name, const std::int64_t target_stop_line_id) -> boost::optional<double>
 {
-  auto it = entities_.find(name);
-  if (it == entities_.end()) {
+  if (not entityExists(name)) {
     return boost::none;
   }
-  if (getWaypoints(name).waypoints.empty()) {
+  if (current_time_ < 0) {
+    return boost::none;
+  }
+  const auto & waypoints = makeWaypoints(getEntityHandle(name).index).waypoints;
+  if (waypoints.empty()) {
     return boost::none;
   }
-  traffic_simulator::math::CatmullRomSpline spline(getWaypoints(name).waypoints);
+  traffic_simulator::math::CatmullRomSpline spline(waypoints);
   auto polygon = hdmap_utils_ptr_->getStopLinePolygon(target_stop_line_id);
   return spline.getCollisionPointIn2D(polygon);
 }
 
-auto EntityManager::getEntityNames() const -> const std::vector<std::string>
+auto EntityManager::getEntityNames() const noexcept -> const std::vector<std::string> &
+{
+  return entity_names_;
+}
+
+auto EntityManager::getEntity(const std::string & name) const
+  -> const std::shared_ptr<traffic_simulator::entity::EntityBase> &
+{
+  return entity_slots_[getEntityHandle(name).index].entity;
+}
+
+auto EntityManager::getEntity(const EntityHandle & handle) const
+  -> const std::shared_ptr<traffic_simulator::entity::EntityBase> &
 {
-  std::vector<std::string> names{};
-  for (const auto & each : entities_) {
-    names.push_back(each.first);
+  if (not entityExists(handle)) {
+    THROW_SEMANTIC_ERROR("entity handle ", handle, " refers to no entity.");
+  } else {
+    return entity_slots_[handle.index].entity;
   }
-  return names;
 }
 
-auto EntityManager::getEntityStatus(const std::string & name) const
-  -> const boost::optional<traffic_simulator_msgs::msg::EntityStatus>
+auto EntityManager::getEntityHandle(const std::string & name) const -> EntityHandle
 {
-  traffic_simulator_msgs::msg::EntityStatus status_msg;
-  auto it = entities_.find(name);
-  if (it == entities_.end()) {
+  if (const auto iter = entity_handles_.find(name); iter == std::end(entity_handles_)) {
     THROW_SEMANTIC_ERROR("entity : ", name, " does not exist.");
+  } else {
+    return iter->second;
   }
-  status_msg = it->second->getStatus();
-  status_msg.bounding_box = getBoundingBox(name);
-  status_msg.action_status.current_action = getCurrentAction(name);
-  switch (getEntityType(name).type) {
-    case traffic_simulator_msgs::msg::EntityType::EGO:
-      status_msg.type.type = status_msg.type.EGO;
-      break;
-    case traffic_simulator_msgs::msg::EntityType::VEHICLE:
-      status_msg.type.type = status_msg.type.VEHICLE;
-      break;
-    case traffic_simulator_msgs::msg::EntityType::PEDESTRIAN:
-      status_msg.type.type = status_msg.type.PEDESTRIAN;
-      break;
-  }
-  status_msg.time = current_time_;
-  status_msg.name = name;
-  return status_msg;
 }
 
-auto EntityManager::getEntityTypeList() const
-  -> const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType>
+auto EntityManager::getEntityName(const EntityHandle & handle) const -> const std::string &
 {
-  std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> ret;
-  for (auto it = entities_.begin(); it != entities_.end(); it++) {
-    ret.emplace(it->first, it->second->getEntityType());
+  if (not entityExists(handle)) {
+    THROW_SEMANTIC_ERROR("entity handle ", handle, " refers to no entity.");
+  } else {
+    return entity_slots_[handle.index].name;
   }
-  return ret;
+}
+
+auto EntityManager::getEntityStatus(const std::string & name) const
+  -> std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus>
+{
+  return getEntityStatus(getEntityHandle(name));
+}
+
+auto EntityManager::getEntityStatus(const EntityHandle & handle) const
+  -> std::shared_ptr<const traffic_simulator_msgs::msg::EntityStatus>
+{
+  return getEntity(handle)->getFinalizedStatus();
+}
+
+auto EntityManager::getEntityTypeList() const noexcept
+  -> const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> &
+{
+  return entity_types_;
 }
 
 auto EntityManager::getHdmapUtils() -> const std::shared_ptr<hdmap_utils::HdMapUtils> &
@@ -257,50 +300,50 @@ auto EntityManager::getLongitudinalDistance(
   const LaneletPose & from, const std::string & to, const double max_distance)
   -> boost::optional<double>
 {
-  if (!laneMatchingSucceed(to)) {
-    return boost::none;
-  }
-  if (entityStatusSet(to)) {
-    if (const auto status = getEntityStatus(to)) {
-      return getLongitudinalDistance(from, status->lanelet_pose, max_distance);
-    }
-  }
-
-  return boost::none;
+  return getLongitudinalDistance(from, getEntityHandle(to), max_distance);
 }
 
 auto EntityManager::getLongitudinalDistance(
   const std::string & from, const LaneletPose & to, const double max_distance)
   -> boost::optional<double>
 {
-  if (!laneMatchingSucceed(from)) {
-    return boost::none;
-  }
-  if (entityStatusSet(from)) {
-    if (const auto status = getEntityStatus(from)) {
-      return getLongitudinalDistance(status->lanelet_pose, to, max_distance);
-    }
-  }
-
-  return boost::none;
+  return getLongitudinalDistance(getEntityHandle(from), to, max_distance);
 }
 
 auto EntityManager::getLongitudinalDistance(
   const std::string & from, const std::string & to, const double max_distance)
   -> boost::optional<double>
 {
-  if (!laneMatchingSucceed(from)) {
-    return boost::none;
-  }
-  if (!laneMatchingSucceed(to)) {
-    return boost::none;
+  return getLongitudinalDistance(getEntityHandle(from), getEntityHandle(to), max_distance);
+}
+
+auto EntityManager::getLongitudinalDistance(
+  const LaneletPose & from, const EntityHandle & to, const double max_distance)
+  -> boost::optional<double>
+{
+  if (const auto & status = getEntity(to)->getStatus(); status.lanelet_pose_valid) {
+    return getLongitudinalDistance(from, status.lanelet_pose, max_distance);
   }
-  if (entityStatusSet(from)) {
-    if (const auto status = getEntityStatus(from)) {
-      return getLongitudinalDistance(status->lanelet_pose, to, max_distance);
-    }
+  return boost::none;
+}
+
+auto EntityManager::getLongitudinalDistance(
+  const EntityHandle & from, const LaneletPose & to, const double max_distance)
+  -> boost::optional<double>
+{
+  if (const auto & status = getEntity(from)->getStatus(); status.lanelet_pose_valid) {
+    return getLongitudinalDistance(status.lanelet_pose, to, max_distance);
   }
+  return boost::none;
+}
 
+auto EntityManager::getLongitudinalDistance(
+  const EntityHandle & from, const EntityHandle & to, const double max_distance)
+  -> boost::optional<double>
+{
+  if (const auto & status = getEntity(from)->getStatus(); status.lanelet_pose_valid) {
+    return getLongitudinalDistance(status.lanelet_pose, to, max_distance);
+  }
   return boost::none;
 }
 
@@ -354,9 +397,9 @@ geometry_msgs::msg::Pose EntityManager::getMapPose(
 
 auto EntityManager::getNumberOfEgo() const -> std::size_t
 {
-  return std::count_if(std::begin(entities_), std::end(entities_), [this](const auto & each) {
-    return isEgo(each.first);
-  });
+  return std::count_if(
+    std::begin(entity_slots_), std::end(entity_slots_),
+    [this](const auto & slot) { return slot.entity and isEgo(slot); });
 }
 
 const std::string EntityManager::getEgoName() const
@@ -378,7 +421,7 @@ auto EntityManager::getObstacle(const std::string & name)
   if (current_time_ < 0) {
     return boost::none;
   }
-  return entities_.at(name)->getObstacle();
+  return makeObstacle(getEntityHandle(name).index);
 }
 
 auto EntityManager::getRelativePose(
@@ -422,6 +465,24 @@ auto EntityManager::getRelativePose(const std::string & from, const std::string
   return getRelativePose(from_status->pose, to_status->pose);
 }
 
+auto EntityManager::getRelativePose(
+  const geometry_msgs::msg::Pose & from, const EntityHandle & to) const -> geometry_msgs::msg::Pose
+{
+  return getRelativePose(from, getEntity(to)->getStatus().pose);
+}
+
+auto EntityManager::getRelativePose(
+  const EntityHandle & from, const geometry_msgs::msg::Pose & to) const -> geometry_msgs::msg::Pose
+{
+  return getRelativePose(getEntity(from)->getStatus().pose, to);
+}
+
+auto EntityManager::getRelativePose(const EntityHandle & from, const EntityHandle & to) const
+  -> geometry_msgs::msg::Pose
+{
+  return getRelativePose(getEntity(from)->getStatus().pose, getEntity(to)->getStatus().pose);
+}
+
 auto EntityManager::getStepTime() const noexcept -> double { return step_time_; }
 
 auto EntityManager::getWaypoints(const std::string & name)
@@ -430,7 +491,7 @@ auto EntityManager::getWaypoints(const std::string & name)
   if (current_time_ < 0) {
     return traffic_simulator_msgs::msg::WaypointsArray();
   }
-  return entities_.at(name)->getWaypoints();
+  return makeWaypoints(getEntityHandle(name).index);
 }
 
 void EntityManager::getGoalPoses(
@@ -439,7 +500,7 @@ void EntityManager::getGoalPoses(
   if (current_time_ < 0) {
     goals = std::vector<traffic_simulator_msgs::msg::LaneletPose>();
   }
-  goals = entities_.at(name)->getGoalPoses();
+  goals = getEntity(name)->getGoalPoses();
 }
 
 void EntityManager::getGoalPoses(
@@ -456,10 +517,15 @@ void EntityManager::getGoalPoses(
 }
 
 bool EntityManager::isEgo(const std::string & name) const
+{
+  return isEgo(entity_slots_[getEntityHandle(name).index]);
+}
+
+auto EntityManager::isEgo(const EntitySlot & slot) const -> bool
 {
   using traffic_simulator_msgs::msg::EntityType;
-  return getEntityType(name).type == EntityType::EGO and
-         dynamic_cast<EgoEntity const *>(entities_.at(name).get());
+  return slot.entity->getEntityType().type == EntityType::EGO and
+         dynamic_cast<EgoEntity const *>(slot.entity.get());
 }
 
 bool EntityManager::isInLanelet(
@@ -573,7 +639,7 @@ void EntityManager::requestSpeedChange(
   if (isEgo(name) && getCurrentTime() > 0) {
     THROW_SEMANTIC_ERROR("You cannot set target speed to the ego vehicle after starting scenario.");
   }
-  return entities_.at(name)->requestSpeedChange(target_speed, continuous);
+  return getEntity(name)->requestSpeedChange(target_speed, continuous);
 }
 
 void EntityManager::requestSpeedChange(
@@ -583,7 +649,7 @@ void EntityManager::requestSpeedChange(
   if (isEgo(name) && getCurrentTime() > 0) {
     THROW_SEMANTIC_ERROR("You cannot set target speed to the ego vehicle after starting scenario.");
   }
-  return entities_.at(name)->requestSpeedChange(target_speed, transition, constraint, continuous);
+  return getEntity(name)->requestSpeedChange(target_speed, transition, constraint, continuous);
 }
 
 void EntityManager::requestSpeedChange(
@@ -592,7 +658,7 @@ void EntityManager::requestSpeedChange(
   if (isEgo(name) && getCurrentTime() > 0) {
     THROW_SEMANTIC_ERROR("You cannot set target speed to the ego vehicle after starting scenario.");
   }
-  return entities_.at(name)->requestSpeedChange(target_speed, continuous);
+  return getEntity(name)->requestSpeedChange(target_speed, continuous);
 }
 
 void EntityManager::requestSpeedChange(
@@ -603,7 +669,40 @@ void EntityManager::requestSpeedChange(
   if (isEgo(name) && getCurrentTime() > 0) {
     THROW_SEMANTIC_ERROR("You cannot set target speed to the ego vehicle after starting scenario.");
   }
-  return entities_.at(name)->requestSpeedChange(target_speed, transition, constraint, continuous);
+  return getEntity(name)->requestSpeedChange(target_speed, transition, constraint, continuous);
+}
+
+auto EntityManager::makeSnapshot() const -> Snapshot
+{
+  Snapshot snapshot;
+  snapshot.current_time = current_time_;
+  snapshot.step_time = step_time_;
+  snapshot.entity_slots = entity_slots_;
+  snapshot.free_entity_slots = free_entity_slots_;
+  snapshot.entity_names = entity_names_;
+  for (const auto & slot : entity_slots_) {
+    snapshot.entities.push_back(slot.entity ? slot.entity->makeSnapshot() : nullptr);
+  }
+  snapshot.traffic_lights = traffic_light_manager_ptr_->makeSnapshot();
+  return snapshot;
+}
+
+auto EntityManager::restore(const Snapshot & snapshot) -> void
+{
+  current_time_ = snapshot.current_time;
+  step_time_ = snapshot.step_time;
+  entity_slots_ = snapshot.entity_slots;
+  free_entity_slots_ = snapshot.free_entity_slots;
+  entity_names_ = snapshot.entity_names;
+  rebuildEntityIndex();
+  plan_caches_.clear();
+  for (std::size_t index = 0; index < entity_slots_.size(); ++index) {
+    if (entity_slots_[index].entity) {
+      entity_slots_[index].entity->restore(*snapshot.entities[index]);
+      entity_slots_[index].entity->finalizeStatus(current_time_);
+    }
+  }
+  traffic_light_manager_ptr_->restore(snapshot.traffic_lights);
 }
 
 bool EntityManager::setEntityStatus(
@@ -614,14 +713,16 @@ bool EntityManager::setEntityStatus(
     THROW_SEMANTIC_ERROR(
       "You cannot set entity status to the ego vehicle name:", name, " after starting scenario.");
   }
-  return entities_.at(name)->setStatus(status);
+  return getEntity(name)->setStatus(status);
 }
 
 void EntityManager::setVerbose(const bool verbose)
 {
   configuration.verbose = verbose;
-  for (auto & entity : entities_) {
-    entity.second->setVerbose(verbose);
+  for (auto & slot : entity_slots_) {
+    if (slot.entity) {
+      slot.entity->setVerbose(verbose);
+    }
   }
 }
 
@@ -635,19 +736,32 @@ traffic_simulator_msgs::msg::EntityStatus EntityManager::updateNpcLogic(
   const std::string & name,
   const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list)
 {
+  return updateNpcLogic(entity_slots_[getEntityHandle(name).index], type_list);
+}
+
+auto EntityManager::updateNpcLogic(
+  const EntitySlot & slot,
+  const std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityType> & type_list)
+  -> traffic_simulator_msgs::msg::EntityStatus
+{
+  PROFILE_SCOPE("EntityManager::updateNpcLogic");
   if (configuration.verbose) {
-    std::cout << "update " << name << " behavior" << std::endl;
+    std::cout << "update " << slot.name << " behavior" << std::endl;
   }
-  entities_[name]->setEntityTypeList(type_list);
-  entities_[name]->onUpdate(current_time_, step_time_);
-  if (entities_[name]->statusSet()) {
-    return entities_[name]->getStatus();
+  slot.entity->setEntityTypeList(type_list);
+  slot.entity->onUpdate(current_time_, step_time_);
+  auto & plan_cache = planCache(&slot - entity_slots_.data());
+  plan_cache.waypoints.reset();
+  plan_cache.obstacle.reset();
+  if (slot.entity->statusSet()) {
+    return slot.entity->getStatus();
   }
-  THROW_SIMULATION_ERROR("status of entity ", name, "is empty");
+  THROW_SIMULATION_ERROR("status of entity ", slot.name, "is empty");
 }
 
 void EntityManager::update(const double current_time, const double step_time)
 {
+  PROFILE_SCOPE("EntityManager::update");
   std::chrono::system_clock::time_point start, end;
   start = std::chrono::system_clock::now();
   step_time_ = step_time;
@@ -663,66 +777,38 @@ void EntityManager::update(const double current_time, const double step_time)
     traffic_light_manager_ptr_->update(step_time_);
   }
   setVerbose(configuration.verbose);
-  auto type_list = getEntityTypeList();
   std::unordered_map<std::string, traffic_simulator_msgs::msg::EntityStatus> all_status;
-  const std::vector<std::string> entity_names = getEntityNames();
-  for (const auto & entity_name : entity_names) {
-    if (entities_[entity_name]->statusSet()) {
-      all_status.emplace(entity_name, entities_[entity_name]->getStatus());
+  for (const auto & slot : entity_slots_) {
+    if (slot.entity and slot.entity->statusSet()) {
+      all_status.emplace(slot.name, slot.entity->getStatus());
     }
   }
-  for (auto it = entities_.begin(); it != entities_.end(); it++) {
-    it->second->setOtherStatus(all_status);
+  for (const auto & slot : entity_slots_) {
+    if (slot.entity) {
+      slot.entity->setOtherStatus(all_status);
+    }
   }
   all_status.clear();
-  for (const auto & entity_name : entity_names) {
-    if (entities_[entity_name]->statusSet()) {
-      auto status = updateNpcLogic(entity_name, type_list);
-      status.bounding_box = getBoundingBox(entity_name);
-      all_status.emplace(entity_name, status);
+  for (const auto & slot : entity_slots_) {
+    if (slot.entity) {
+      if (slot.entity->statusSet()) {
+        all_status.emplace(slot.name, updateNpcLogic(slot, entity_types_));
+      }
+      slot.entity->finalizeStatus(current_time_);
     }
   }
-  for (auto it = entities_.begin(); it != entities_.end(); it++) {
-    it->second->setOtherStatus(all_status);
-  }
-  auto entity_type_list = getEntityTypeList();
-  traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray status_array_msg;
-  for (const auto & status : all_status) {
-    traffic_simulator_msgs::msg::EntityStatusWithTrajectory status_with_traj;
-    auto status_msg = status.second;
-    status_msg.name = status.first;
-    status_msg.bounding_box = getBoundingBox(status.first);
-    status_msg.action_status.current_action = getCurrentAction(status.first);
-    switch (getEntityType(status.first).type) {
-      case traffic_simulator_msgs::msg::EntityType::EGO:
-        status_msg.type.type = status_msg.type.EGO;
-        break;
-      case traffic_simulator_msgs::msg::EntityType::VEHICLE:
-        status_msg.type.type = status_msg.type.VEHICLE;
-        break;
-      case traffic_simulator_msgs::msg::EntityType::PEDESTRIAN:
-        status_msg.type.type = status_msg.type.PEDESTRIAN;
-        break;
-    }
-    status_with_traj.waypoint = getWaypoints(status.first);
-    std::vector<geometry_msgs::msg::Pose> goals;
-    getGoalPoses(status.first, goals);
-    for (const auto goal : goals) {
-      status_with_traj.goal_pose.push_back(goal);
+  for (const auto & slot : entity_slots_) {
+    if (slot.entity) {
+      slot.entity->setOtherStatus(all_status);
     }
-    const auto obstacle = getObstacle(status.first);
-    if (obstacle) {
-      status_with_traj.obstacle = obstacle.get();
-      status_with_traj.obstacle_find = true;
-    } else {
-      status_with_traj.obstacle_find = false;
-    }
-    status_with_traj.status = status_msg;
-    status_with_traj.name = status.first;
-    status_with_traj.time = current_time + step_time;
-    status_array_msg.data.emplace_back(status_with_traj);
   }
-  entity_status_array_pub_ptr_->publish(status_array_msg);
+  if (
+    entity_status_array_pub_ptr_->get_subscription_count() > 0 and
+    entity_status_frame_count_++ %
+        std::max<std::size_t>(configuration.entity_status_publish_decimation, 1) ==
+      0) {
+    publishEntityStatusArray();
+  }
   end = std::chrono::system_clock::now();
   double elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count();
   if (configuration.verbose) {
@@ -730,6 +816,92 @@ void EntityManager::update(const double current_time, const double step_time)
   }
 }
 
+auto EntityManager::makeGoalPoses(std::size_t index)
+  -> const std::vector<geometry_msgs::msg::Pose> &
+{
+  const auto & slot = entity_slots_[index];
+  if (goal_pose_caches_.size() <= index) {
+    goal_pose_caches_.resize(entity_slots_.size());
+  }
+  auto & cache = goal_pose_caches_[index];
+  auto goals = slot.entity->getGoalPoses();
+  if (cache.generation != slot.generation or cache.goals != goals) {
+    cache.generation = slot.generation;
+    cache.goals = std::move(goals);
+    cache.goal_poses.clear();
+    for (const auto & goal : cache.goals) {
+      cache.goal_poses.push_back(toMapPose(goal));
+    }
+  }
+  return cache.goal_poses;
+}
+
+auto EntityManager::planCache(std::size_t index) -> PlanCache &
+{
+  if (plan_caches_.size() <= index) {
+    plan_caches_.resize(entity_slots_.size());
+  }
+  auto & cache = plan_caches_[index];
+  if (cache.generation != entity_slots_[index].generation) {
+    cache = PlanCache();
+    cache.generation = entity_slots_[index].generation;
+  }
+  return cache;
+}
+
+auto EntityManager::makeObstacle(std::size_t index)
+  -> const boost::optional<traffic_simulator_msgs::msg::Obstacle> &
+{
+  auto & cache = planCache(index);
+  if (not cache.obstacle) {
+    cache.obstacle = entity_slots_[index].entity->getObstacle();
+  }
+  return *cache.obstacle;
+}
+
+auto EntityManager::makeWaypoints(std::size_t index)
+  -> const traffic_simulator_msgs::msg::WaypointsArray &
+{
+  auto & cache = planCache(index);
+  if (not cache.waypoints) {
+    cache.waypoints = entity_slots_[index].entity->getWaypoints();
+  }
+  return *cache.waypoints;
+}
+
+/**
+ * @brief publish entity/status, requesting waypoints and obstacles only while it has subscribers.
+ */
+auto EntityManager::publishEntityStatusArray() -> void
+{
+  PROFILE_SCOPE("EntityManager::publishEntityStatusArray");
+  traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray status_array_msg;
+  status_array_msg.data.reserve(entity_names_.size());
+  for (std::size_t index = 0; index < entity_slots_.size(); ++index) {
+    const auto & slot = entity_slots_[index];
+    if (slot.entity and slot.entity->statusSet()) {
+      traffic_simulator_msgs::msg::EntityStatusWithTrajectory status_with_traj;
+      if (current_time_ >= 0) {
+        status_with_traj.waypoint = makeWaypoints(index);
+      }
+      status_with_traj.goal_pose = makeGoalPoses(index);
+      const auto obstacle = current_time_ < 0 ? boost::none : makeObstacle(index);
+      if (obstacle) {
+        status_with_traj.obstacle = obstacle.get();
+        status_with_traj.obstacle_find = true;
+      } else {
+        status_with_traj.obstacle_find = false;
+      }
+      status_with_traj.status = *slot.entity->getFinalizedStatus();
+      status_with_traj.status.time = slot.entity->getStatus().time;
+      status_with_traj.name = slot.name;
+      status_with_traj.time = current_time_ + step_time_;
+      status_array_msg.data.push_back(std::move(status_with_traj));
+    }
+  }
+  entity_status_array_pub_ptr_->publish(status_array_msg);
+}
+
 void EntityManager::updateHdmapMarker()
 {
   MarkerArray markers;
@@ -741,5 +913,44 @@ void EntityManager::updateHdmapMarker()
   }
   lanelet_marker_pub_ptr_->publish(markers);
 }
+
+auto EntityManager::insertEntity(
+  const std::string & name, const std::shared_ptr<traffic_simulator::entity::EntityBase> & entity)
+  -> EntityHandle
+{
+  EntityHandle handle;
+  handle.generation = ++last_generation_;
+  if (free_entity_slots_.empty()) {
+    handle.index = entity_slots_.size();
+    entity_slots_.push_back(EntitySlot{name, entity, handle.generation});
+  } else {
+    handle.index = free_entity_slots_.back();
+    free_entity_slots_.pop_back();
+    entity_slots_[handle.index] = EntitySlot{name, entity, handle.generation};
+  }
+  entity_handles_.emplace(name, handle);
+  entity_names_.push_back(name);
+  entity_types_.emplace(name, entity->getEntityType());
+  entity->finalizeStatus(current_time_);
+  return handle;
+}
+
+auto EntityManager::rebuildEntityIndex() -> void
+{
+  entity_handles_.clear();
+  entity_types_.clear();
+  for (std::uint32_t index = 0; index < entity_slots_.size(); ++index) {
+    if (const auto & slot = entity_slots_[index]; slot.entity) {
+      entity_handles_.emplace(slot.name, EntityHandle{index, slot.generation});
+      entity_types_.emplace(slot.name, slot.entity->getEntityType());
+    }
+  }
+  const auto despawned = [this](const auto & name) {
+    return entity_handles_.find(name) == std::end(entity_handles_);
+  };
+  entity_names_.erase(
+    std::remove_if(std::begin(entity_names_), std::end(entity_names_), despawned),
+    std::end(entity_names_));
+}
 }  // namespace entity
 }  // namespace traffic_simulator
@@ -32,6 +32,7 @@ void MiscObjectEntity::onUpdate(double, double)
     status_->action_status.twist = geometry_msgs::msg::Twist();
     status_->action_status.current_action = "static";
     status_before_update_ = status_;
+    invalidateFinalizedStatus();
   } else {
     status_before_update_ = status_;
   }
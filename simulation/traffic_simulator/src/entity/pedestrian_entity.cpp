@@ -47,6 +47,31 @@ void PedestrianEntity::appendDebugMarker(visualization_msgs::msg::MarkerArray &
   std::copy(marker.begin(), marker.end(), std::back_inserter(marker_array.markers));
 }
 
+auto PedestrianEntity::makeSnapshot() const -> std::shared_ptr<const EntityBase::Snapshot>
+{
+  auto snapshot = std::make_shared<Snapshot>();
+  save(*snapshot);
+  return snapshot;
+}
+
+auto PedestrianEntity::save(Snapshot & snapshot) const -> void
+{
+  EntityBase::save(snapshot);
+  snapshot.behavior = behavior_plugin_ptr_->makeSnapshot();
+  snapshot.route_planner = std::make_shared<const RoutePlanner>(*route_planner_ptr_);
+}
+
+auto PedestrianEntity::restore(const EntityBase::Snapshot & snapshot) -> void
+{
+  if (const auto pedestrian_snapshot = dynamic_cast<const Snapshot *>(&snapshot)) {
+    EntityBase::restore(snapshot);
+    behavior_plugin_ptr_->restore(pedestrian_snapshot->behavior);
+    route_planner_ptr_ = std::make_shared<RoutePlanner>(*pedestrian_snapshot->route_planner);
+  } else {
+    THROW_SIMULATION_ERROR("Snapshot of entity ", name, " is not a snapshot of a pedestrian.");
+  }
+}
+
 void PedestrianEntity::requestAssignRoute(
   const std::vector<traffic_simulator_msgs::msg::LaneletPose> & waypoints)
 {
@@ -48,6 +48,33 @@ void VehicleEntity::appendDebugMarker(visualization_msgs::msg::MarkerArray & mar
   std::copy(marker.begin(), marker.end(), std::back_inserter(marker_array.markers));
 }
 
+auto VehicleEntity::makeSnapshot() const -> std::shared_ptr<const EntityBase::Snapshot>
+{
+  auto snapshot = std::make_shared<Snapshot>();
+  save(*snapshot);
+  return snapshot;
+}
+
+auto VehicleEntity::save(Snapshot & snapshot) const -> void
+{
+  EntityBase::save(snapshot);
+  snapshot.behavior = behavior_plugin_ptr_->makeSnapshot();
+  snapshot.route_planner = std::make_shared<const RoutePlanner>(*route_planner_ptr_);
+  snapshot.previous_route_lanelets = previous_route_lanelets_;
+}
+
+auto VehicleEntity::restore(const EntityBase::Snapshot & snapshot) -> void
+{
+  if (const auto vehicle_snapshot = dynamic_cast<const Snapshot *>(&snapshot)) {
+    EntityBase::restore(snapshot);
+    behavior_plugin_ptr_->restore(vehicle_snapshot->behavior);
+    route_planner_ptr_ = std::make_shared<RoutePlanner>(*vehicle_snapshot->route_planner);
+    previous_route_lanelets_ = vehicle_snapshot->previous_route_lanelets;
+  } else {
+    THROW_SIMULATION_ERROR("Snapshot of entity ", name, " is not a snapshot of a vehicle.");
+  }
+}
+
 void VehicleEntity::requestAssignRoute(
   const std::vector<traffic_simulator_msgs::msg::LaneletPose> & waypoints)
 {
@@ -33,9 +33,11 @@
 #include <lanelet2_extension_psim/utility/query.hpp>
 #include <lanelet2_extension_psim/utility/utilities.hpp>
 #include <lanelet2_extension_psim/visualization/visualization.hpp>
+#include <limits>
 #include <memory>
 #include <scenario_simulator_exception/exception.hpp>
 #include <set>
+#include <simple_profiler/profiler.hpp>
 #include <string>
 #include <traffic_simulator/color_utils/color_utils.hpp>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
@@ -125,6 +127,7 @@ std::vector<std::int64_t> HdMapUtils::filterLaneletIds(
 std::vector<std::int64_t> HdMapUtils::getNearbyLaneletIds(
   const geometry_msgs::msg::Point & position, double distance_threshold) const
 {
+  PROFILE_SCOPE("HdMapUtils::getNearbyLaneletIds");
   std::vector<std::int64_t> lanelet_ids;
   lanelet::BasicPoint2d search_point(position.x, position.y);
   std::vector<std::pair<double, lanelet::Lanelet>> nearest_lanelet =
@@ -143,6 +146,7 @@ std::vector<std::int64_t> HdMapUtils::getNearbyLaneletIds(
 std::vector<std::int64_t> HdMapUtils::getNearbyLaneletIds(
   const geometry_msgs::msg::Point & point, double distance_thresh, bool include_crosswalk) const
 {
+  PROFILE_SCOPE("HdMapUtils::getNearbyLaneletIds");
   std::vector<std::int64_t> lanelet_ids;
   lanelet::BasicPoint2d search_point(point.x, point.y);
   std::vector<std::pair<double, lanelet::Lanelet>> nearest_lanelet =
@@ -181,6 +185,7 @@ double HdMapUtils::getHeight(const traffic_simulator_msgs::msg::LaneletPose & la
 boost::optional<double> HdMapUtils::getCollisionPointInLaneCoordinate(
   std::int64_t lanelet_id, std::int64_t crossing_lanelet_id)
 {
+  PROFILE_SCOPE("HdMapUtils::getCollisionPointInLaneCoordinate");
   namespace bg = boost::geometry;
   using Point = bg::model::d2::point_xy<double>;
   using Line = bg::model::linestring<Point>;
@@ -405,6 +410,7 @@ boost::optional<std::int64_t> HdMapUtils::matchToLane(
 boost::optional<traffic_simulator_msgs::msg::LaneletPose> HdMapUtils::toLaneletPose(
   geometry_msgs::msg::Pose pose, bool include_crosswalk, double matching_distance)
 {
+  PROFILE_SCOPE("HdMapUtils::toLaneletPose");
   const auto lanelet_ids = getNearbyLaneletIds(pose.position, 0.1, include_crosswalk);
   if (lanelet_ids.empty()) {
     return boost::none;
@@ -421,6 +427,7 @@ boost::optional<traffic_simulator_msgs::msg::LaneletPose> HdMapUtils::toLaneletP
 boost::optional<traffic_simulator_msgs::msg::LaneletPose> HdMapUtils::toLaneletPose(
   geometry_msgs::msg::Pose pose, std::int64_t lanelet_id, double matching_distance)
 {
+  PROFILE_SCOPE("HdMapUtils::toLaneletPose");
   const auto spline = getCenterPointsSpline(lanelet_id);
   const auto s = spline->getSValue(pose, matching_distance);
   if (!s) {
@@ -453,6 +460,7 @@ boost::optional<traffic_simulator_msgs::msg::LaneletPose> HdMapUtils::toLaneletP
 boost::optional<traffic_simulator_msgs::msg::LaneletPose> HdMapUtils::toLaneletPose(
   geometry_msgs::msg::Pose pose, std::vector<std::int64_t> lanelet_ids, double matching_distance)
 {
+  PROFILE_SCOPE("HdMapUtils::toLaneletPose");
   for (const auto id : lanelet_ids) {
     const auto lanelet_pose = toLaneletPose(pose, id, matching_distance);
     if (lanelet_pose) {
@@ -466,6 +474,7 @@ boost::optional<traffic_simulator_msgs::msg::LaneletPose> HdMapUtils::toLaneletP
   geometry_msgs::msg::Pose pose, const traffic_simulator_msgs::msg::BoundingBox & bbox,
   bool include_crosswalk, double matching_distance)
 {
+  PROFILE_SCOPE("HdMapUtils::toLaneletPose");
   const auto lanelet_id = matchToLane(pose, bbox, include_crosswalk);
   if (!lanelet_id) {
     return toLaneletPose(pose, include_crosswalk, matching_distance);
@@ -623,6 +632,7 @@ std::vector<std::int64_t> HdMapUtils::getFollowingLanelets(
   std::int64_t lanelet_id, std::vector<std::int64_t> candidate_lanelet_ids, double distance,
   bool include_self)
 {
+  PROFILE_SCOPE("HdMapUtils::getFollowingLanelets");
   if (candidate_lanelet_ids.empty()) {
     return {};
   }
@@ -659,6 +669,7 @@ std::vector<std::int64_t> HdMapUtils::getFollowingLanelets(
 std::vector<std::int64_t> HdMapUtils::getFollowingLanelets(
   std::int64_t lanelet_id, double distance, bool include_self)
 {
+  PROFILE_SCOPE("HdMapUtils::getFollowingLanelets");
   std::vector<std::int64_t> ret;
   double total_distance = 0.0;
   if (include_self) {
@@ -688,6 +699,7 @@ std::vector<std::int64_t> HdMapUtils::getFollowingLanelets(
 std::vector<std::int64_t> HdMapUtils::getRoute(
   std::int64_t from_lanelet_id, std::int64_t to_lanelet_id)
 {
+  PROFILE_SCOPE("HdMapUtils::getRoute");
   if (route_cache_.exists(from_lanelet_id, to_lanelet_id)) {
     return route_cache_.getRoute(from_lanelet_id, to_lanelet_id);
   }
@@ -969,6 +981,13 @@ HdMapUtils::getLaneChangeTrajectory(
   return std::make_pair(traj, collision_point.get());
 }
 
+/**
+ * @brief Candidates of the goal are placed every 1 m along the target lanelet, and the feasible
+ * candidate whose trajectory length is the closest to target_trajectory_length is chosen.
+ * @note Every candidate is checked, because neither the feasibility nor the length of the
+ * trajectory is monotonic along the lanelet, so a coarse search can miss narrow feasible ranges.
+ * The cost of a candidate is reduced by the analytic curvature bound in makeLaneChangeTrajectoryTo.
+ */
 boost::optional<std::pair<traffic_simulator::math::HermiteCurve, double>>
 HdMapUtils::getLaneChangeTrajectory(
   const geometry_msgs::msg::Pose & from_pose,
@@ -976,39 +995,54 @@ HdMapUtils::getLaneChangeTrajectory(
   double maximum_curvature_threshold, double target_trajectory_length,
   double forward_distance_threshold)
 {
-  double to_length = getLaneletLength(lane_change_parameter.target.lanelet_id);
-  std::vector<double> evaluation, target_s;
-  std::vector<traffic_simulator::math::HermiteCurve> curves;
-
+  const double to_length = getLaneletLength(lane_change_parameter.target.lanelet_id);
+  boost::optional<std::pair<traffic_simulator::math::HermiteCurve, double>> best;
+  double best_evaluation = std::numeric_limits<double>::max();
   for (double to_s = 0; to_s < to_length; to_s = to_s + 1.0) {
-    auto goal_pose = toMapPose(lane_change_parameter.target.lanelet_id, to_s, 0);
-    if (
-      traffic_simulator::math::getRelativePose(from_pose, goal_pose.pose).position.x <=
-      forward_distance_threshold) {
-      continue;
-    }
-    double start_to_goal_distance = std::sqrt(
-      std::pow(from_pose.position.x - goal_pose.pose.position.x, 2) +
-      std::pow(from_pose.position.y - goal_pose.pose.position.y, 2) +
-      std::pow(from_pose.position.z - goal_pose.pose.position.z, 2));
-    traffic_simulator_msgs::msg::LaneletPose to_pose;
-    to_pose.lanelet_id = lane_change_parameter.target.lanelet_id;
-    to_pose.s = to_s;
-    auto traj = getLaneChangeTrajectory(
-      from_pose, to_pose, lane_change_parameter.trajectory_shape, start_to_goal_distance * 0.5);
-    if (traj.getMaximum2DCurvature() < maximum_curvature_threshold) {
-      double eval = std::fabs(target_trajectory_length - traj.getLength());
-      evaluation.push_back(eval);
-      curves.push_back(traj);
-      target_s.push_back(to_s);
+    if (const auto curve = makeLaneChangeTrajectoryTo(
+          from_pose, lane_change_parameter, to_s, maximum_curvature_threshold,
+          forward_distance_threshold)) {
+      if (const double evaluation = std::fabs(target_trajectory_length - curve->getLength());
+          evaluation < best_evaluation) {
+        best_evaluation = evaluation;
+        best = std::make_pair(curve.get(), to_s);
+      }
     }
   }
-  if (evaluation.empty()) {
+  return best;
+}
+
+boost::optional<traffic_simulator::math::HermiteCurve> HdMapUtils::makeLaneChangeTrajectoryTo(
+  const geometry_msgs::msg::Pose & from_pose,
+  const traffic_simulator::lane_change::Parameter & lane_change_parameter, double to_s,
+  double maximum_curvature_threshold, double forward_distance_threshold)
+{
+  PROFILE_SCOPE("HdMapUtils::makeLaneChangeTrajectoryTo");
+  const auto goal_pose = toMapPose(lane_change_parameter.target.lanelet_id, to_s, 0);
+  if (
+    traffic_simulator::math::getRelativePose(from_pose, goal_pose.pose).position.x <=
+    forward_distance_threshold) {
     return boost::none;
   }
-  std::vector<double>::iterator min_itr = std::min_element(evaluation.begin(), evaluation.end());
-  size_t min_index = std::distance(evaluation.begin(), min_itr);
-  return std::make_pair(curves[min_index], target_s[min_index]);
+  const double start_to_goal_distance = std::sqrt(
+    std::pow(from_pose.position.x - goal_pose.pose.position.x, 2) +
+    std::pow(from_pose.position.y - goal_pose.pose.position.y, 2) +
+    std::pow(from_pose.position.z - goal_pose.pose.position.z, 2));
+  traffic_simulator_msgs::msg::LaneletPose to_pose;
+  to_pose.lanelet_id = lane_change_parameter.target.lanelet_id;
+  to_pose.s = to_s;
+  const auto traj = getLaneChangeTrajectory(
+    from_pose, to_pose, lane_change_parameter.trajectory_shape, start_to_goal_distance * 0.5);
+  /**
+   * @note The analytic upper bound of the curvature is cheap, sampled curvature is checked only when
+   * the bound is not enough to accept the curve.
+   */
+  if (
+    traj.getMaximum2DCurvatureUpperBound() < maximum_curvature_threshold ||
+    traj.getMaximum2DCurvature() < maximum_curvature_threshold) {
+    return traj;
+  }
+  return boost::none;
 }
 
 traffic_simulator::math::HermiteCurve HdMapUtils::getLaneChangeTrajectory(
@@ -1017,6 +1051,7 @@ traffic_simulator::math::HermiteCurve HdMapUtils::getLaneChangeTrajectory(
   const traffic_simulator::lane_change::TrajectoryShape trajectory_shape,
   double tangent_vector_size)
 {
+  PROFILE_SCOPE("HdMapUtils::getLaneChangeTrajectory");
   geometry_msgs::msg::Vector3 start_vec;
   geometry_msgs::msg::Vector3 to_vec;
   geometry_msgs::msg::Pose goal_pose =
@@ -1086,6 +1121,7 @@ std::vector<geometry_msgs::msg::Point> HdMapUtils::toMapPoints(
 geometry_msgs::msg::PoseStamped HdMapUtils::toMapPose(
   std::int64_t lanelet_id, double s, double offset, geometry_msgs::msg::Quaternion quat)
 {
+  PROFILE_SCOPE("HdMapUtils::toMapPose");
   geometry_msgs::msg::PoseStamped ret;
   ret.header.frame_id = "map";
   const auto spline = getCenterPointsSpline(lanelet_id);
@@ -1105,6 +1141,7 @@ geometry_msgs::msg::PoseStamped HdMapUtils::toMapPose(
 geometry_msgs::msg::PoseStamped HdMapUtils::toMapPose(
   traffic_simulator_msgs::msg::LaneletPose lanelet_pose)
 {
+  PROFILE_SCOPE("HdMapUtils::toMapPose");
   return toMapPose(
     lanelet_pose.lanelet_id, lanelet_pose.s, lanelet_pose.offset,
     quaternion_operation::convertEulerAngleToQuaternion(lanelet_pose.rpy));
@@ -1113,6 +1150,7 @@ geometry_msgs::msg::PoseStamped HdMapUtils::toMapPose(
 geometry_msgs::msg::PoseStamped HdMapUtils::toMapPose(
   std::int64_t lanelet_id, double s, double offset)
 {
+  PROFILE_SCOPE("HdMapUtils::toMapPose");
   traffic_simulator_msgs::msg::LaneletPose lanelet_pose;
   lanelet_pose.lanelet_id = lanelet_id;
   lanelet_pose.s = s;
@@ -1128,6 +1166,7 @@ boost::optional<geometry_msgs::msg::Vector3> HdMapUtils::getTangentVector(
 
 bool HdMapUtils::canChangeLane(std::int64_t from_lanelet_id, std::int64_t to_lanelet_id)
 {
+  PROFILE_SCOPE("HdMapUtils::canChangeLane");
   const auto from_lanelet = lanelet_map_ptr_->laneletLayer.get(from_lanelet_id);
   const auto to_lanelet = lanelet_map_ptr_->laneletLayer.get(to_lanelet_id);
   return traffic_rules_vehicle_ptr_->canChangeLane(from_lanelet, to_lanelet);
@@ -1136,12 +1175,14 @@ bool HdMapUtils::canChangeLane(std::int64_t from_lanelet_id, std::int64_t to_lan
 boost::optional<double> HdMapUtils::getLongitudinalDistance(
   traffic_simulator_msgs::msg::LaneletPose from, traffic_simulator_msgs::msg::LaneletPose to)
 {
+  PROFILE_SCOPE("HdMapUtils::getLongitudinalDistance");
   return getLongitudinalDistance(from.lanelet_id, from.s, to.lanelet_id, to.s);
 }
 
 boost::optional<double> HdMapUtils::getLongitudinalDistance(
   std::int64_t from_lanelet_id, double from_s, std::int64_t to_lanelet_id, double to_s)
 {
+  PROFILE_SCOPE("HdMapUtils::getLongitudinalDistance");
   if (from_lanelet_id == to_lanelet_id) {
     if (from_s > to_s) {
       return boost::none;
@@ -1525,6 +1566,7 @@ boost::optional<double> HdMapUtils::getDistanceToStopLine(
   const std::vector<std::int64_t> & route_lanelets,
   const std::vector<geometry_msgs::msg::Point> & waypoints)
 {
+  PROFILE_SCOPE("HdMapUtils::getDistanceToStopLine");
   if (waypoints.empty()) {
     return boost::none;
   }
@@ -1558,6 +1600,7 @@ boost::optional<double> HdMapUtils::getDistanceToStopLine(
   const std::vector<std::int64_t> & route_lanelets,
   const traffic_simulator::math::CatmullRomSplineInterface & spline)
 {
+  PROFILE_SCOPE("HdMapUtils::getDistanceToStopLine");
   if (spline.getLength() <= 0) {
     return boost::none;
   }
@@ -94,37 +94,25 @@ boost::optional<double> HermiteCurve::getCollisionPointIn2D(
   if (n <= 1) {
     return boost::none;
   }
-  std::vector<double> s_values;
-  for (size_t i = 0; i < (n - 1); i++) {
-    const auto p0 = polygon[i];
-    const auto p1 = polygon[i + 1];
-    auto s = getCollisionPointIn2D(p0, p1, search_backward);
-    if (s) {
-      s_values.emplace_back(s.get());
+  boost::optional<double> ret;
+  const auto update = [&](const boost::optional<double> & s) {
+    if (s && (!ret || (search_backward ? s.get() > ret.get() : s.get() < ret.get()))) {
+      ret = s;
     }
+  };
+  for (size_t i = 0; i < (n - 1); i++) {
+    update(getCollisionPointIn2D(polygon[i], polygon[i + 1], search_backward));
   }
   if (close_start_end) {
-    const auto p0 = polygon[n - 1];
-    const auto p1 = polygon[0];
-    auto s = getCollisionPointIn2D(p0, p1, search_backward);
-    if (s) {
-      s_values.emplace_back(s.get());
-    }
+    update(getCollisionPointIn2D(polygon[n - 1], polygon[0], search_backward));
   }
-  if (s_values.empty()) {
-    return boost::none;
-  }
-  if (search_backward) {
-    return *std::max_element(s_values.begin(), s_values.end());
-  }
-  return *std::min_element(s_values.begin(), s_values.end());
+  return ret;
 }
 
 boost::optional<double> HermiteCurve::getCollisionPointIn2D(
   const geometry_msgs::msg::Point & point0, const geometry_msgs::msg::Point & point1,
   bool search_backward) const
 {
-  std::vector<double> s_values;
   double fx = point0.x;
   double ex = (point1.x - point0.x);
   double fy = point0.y;
@@ -133,8 +121,11 @@ boost::optional<double> HermiteCurve::getCollisionPointIn2D(
   double b = by_ * ex - bx_ * ey;
   double c = cy_ * ex - cx_ * ey;
   double d = dy_ * ex - dx_ * ey - ex * fy + ey * fx;
-  auto solutions = solver_.solveCubicEquation(a, b, c, d);
-  for (const auto solution : solutions) {
+  boost::optional<double> ret;
+  /**
+   * @note solutions are already filtered into s = [0, 1] by the solver.
+   */
+  for (const auto solution : solver_.solveCubicEquation(a, b, c, d)) {
     constexpr double epsilon = std::numeric_limits<double>::epsilon();
     double x = solver_.cubicFunction(ax_, bx_, cx_, dx_, solution);
     double tx = (x - point0.x) / (point1.x - point0.x);
@@ -158,18 +149,11 @@ boost::optional<double> HermiteCurve::getCollisionPointIn2D(
         continue;
       }
     }
-    if (0 > solution || solution > 1) {
-      continue;
+    if (!ret || (search_backward ? solution > ret.get() : solution < ret.get())) {
+      ret = solution;
     }
-    s_values.emplace_back(solution);
-  }
-  if (s_values.empty()) {
-    return boost::none;
-  }
-  if (search_backward) {
-    return *std::max_element(s_values.begin(), s_values.end());
   }
-  return *std::min_element(s_values.begin(), s_values.end());
+  return ret;
 }
 
 boost::optional<double> HermiteCurve::getSValue(
@@ -178,8 +162,8 @@ boost::optional<double> HermiteCurve::getSValue(
   geometry_msgs::msg::Point p0, p1;
   p0.y = threshold_distance;
   p1.y = -threshold_distance;
-  const auto line = math::transformPoints(pose, {p0, p1});
-  const auto s = getCollisionPointIn2D(line[0], line[1], false);
+  const auto s =
+    getCollisionPointIn2D(math::transformPoint(pose, p0), math::transformPoint(pose, p1), false);
   if (!s) {
     return boost::none;
   }
@@ -301,6 +285,51 @@ double HermiteCurve::getMaximum2DCurvature() const
   return values.second;
 }
 
+/**
+ * @brief get analytic upper bound of the absolute 2D curvature in s = [0, 1].
+ * The numerator of the curvature (x'y'' - x''y') is a quadratic function of s and the squared speed
+ * (x'^2 + y'^2) is a quartic function of s, so both extrema can be calculated without sampling.
+ * @return double upper bound of |curvature|, always equal or larger than the value of getMaximum2DCurvature
+ */
+double HermiteCurve::getMaximum2DCurvatureUpperBound() const
+{
+  constexpr double epsilon = std::numeric_limits<double>::epsilon();
+  /**
+   * @brief x'y'' - x''y' = -6(a x b)s^2 + 6(c x a)s + 2(c x b)
+   */
+  const double numerator_a = -6 * (ax_ * by_ - ay_ * bx_);
+  const double numerator_b = 6 * (cx_ * ay_ - cy_ * ax_);
+  const double numerator_c = 2 * (cx_ * by_ - cy_ * bx_);
+  double max_numerator = std::max(
+    std::fabs(numerator_c), std::fabs(numerator_a + numerator_b + numerator_c));
+  if (std::fabs(numerator_a) > epsilon) {
+    const double s = -numerator_b / (2 * numerator_a);
+    if (0 < s && s < 1) {
+      max_numerator = std::max(
+        max_numerator,
+        std::fabs(solver_.quadraticFunction(numerator_a, numerator_b, numerator_c, s)));
+    }
+  }
+  const auto get_squared_speed = [this](double s) {
+    const auto tangent_vec = getTangentVector(s);
+    return tangent_vec.x * tangent_vec.x + tangent_vec.y * tangent_vec.y;
+  };
+  double min_squared_speed = std::min(get_squared_speed(0), get_squared_speed(1));
+  /**
+   * @brief extrema of the squared speed are the roots of
+   * x'x'' + y'y'' = 18|a|^2 s^3 + 18(a.b)s^2 + (4|b|^2 + 6(a.c))s + 2(b.c)
+   */
+  for (const auto s : solver_.solveCubicEquation(
+         18 * (ax_ * ax_ + ay_ * ay_), 18 * (ax_ * bx_ + ay_ * by_),
+         4 * (bx_ * bx_ + by_ * by_) + 6 * (ax_ * cx_ + ay_ * cy_), 2 * (bx_ * cx_ + by_ * cy_))) {
+    min_squared_speed = std::min(min_squared_speed, get_squared_speed(s));
+  }
+  if (min_squared_speed <= epsilon) {
+    return std::numeric_limits<double>::infinity();
+  }
+  return max_numerator / std::pow(min_squared_speed, 1.5);
+}
+
 /**
  * @brief get length of the hermite curve. Calculate distance of two points on hermite curve and accumulate it's distance
  * @param num_points 
@@ -12,12 +12,13 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 #include <limits>
 #include <rclcpp/rclcpp.hpp>
+#include <scenario_simulator_exception/exception.hpp>
 #include <traffic_simulator/math/polynomial_solver.hpp>
-#include <vector>
 
 namespace traffic_simulator
 {
@@ -35,76 +36,122 @@ double PolynomialSolver::quadraticFunction(double a, double b, double c, double
   return a * t * t + b * t + c;
 }
 
-std::vector<double> PolynomialSolver::solveLinearEquation(
+void PolynomialRoots::push_back(double value)
+{
+  if (size_ == capacity) {
+    THROW_SIMULATION_ERROR(
+      "PolynomialRoots holds at most ", capacity, " roots, but another root ", value,
+      " was pushed.");
+  }
+  values_[size_++] = value;
+}
+
+void PolynomialSolver::appendRoot(
+  PolynomialRoots & roots, double value, double min_value, double max_value) const
+{
+  constexpr double tolerance = 1e-10;
+  if (min_value - tolerance <= value && value <= max_value + tolerance) {
+    roots.push_back(std::clamp(value, min_value, max_value));
+  }
+}
+
+PolynomialRoots PolynomialSolver::solveLinearEquation(
   double a, double b, double min_value, double max_value) const
 {
   constexpr double e = std::numeric_limits<double>::epsilon();
+  PolynomialRoots ret;
   if (std::fabs(a) < e) {
     if (std::fabs(b) < e) {
       if (min_value <= 0 && 0 <= max_value) {
-        return {0};
+        ret.push_back(0);
       }
     }
-    return {};
-  }
-  double ret = -b / a;
-  if (min_value <= ret && ret <= max_value) {
-    return {ret};
+    return ret;
   }
-  return {};
+  appendRoot(ret, -b / a, min_value, max_value);
+  return ret;
 }
 
-std::vector<double> PolynomialSolver::solveQuadraticEquation(
+PolynomialRoots PolynomialSolver::solveQuadraticEquation(
   double a, double b, double c, double min_value, double max_value) const
 {
-  std::vector<double> candidates, ret;
   constexpr double e = std::numeric_limits<double>::epsilon();
   if (std::fabs(a) < e) {
-    return solveLinearEquation(b, c);
+    return solveLinearEquation(b, c, min_value, max_value);
   }
+  PolynomialRoots ret;
   double root = b * b - 4 * a * c;
   if (std::fabs(root) < e) {
-    candidates = {-b / (2 * a)};
-  } else if (root < 0) {
-    candidates = {};
-  } else {
-    candidates = {(-b - std::sqrt(root)) / (2 * a), (-b + std::sqrt(root)) / (2 * a)};
-  }
-  for (const auto candidate : candidates) {
-    if (min_value <= candidate && candidate <= max_value) {
-      ret.emplace_back(candidate);
-    }
+    appendRoot(ret, -b / (2 * a), min_value, max_value);
+  } else if (root > 0) {
+    /**
+     * @brief avoid cancellation of -b and sqrt(root), the other root is calculated by Vieta's formula
+     */
+    const double q = -0.5 * (b + std::copysign(std::sqrt(root), b));
+    const double x0 = q / a;
+    const double x1 = std::fabs(q) < e ? x0 : c / q;
+    appendRoot(ret, std::min(x0, x1), min_value, max_value);
+    appendRoot(ret, std::max(x0, x1), min_value, max_value);
   }
   return ret;
 }
 
-std::vector<double> PolynomialSolver::solveCubicEquation(
+PolynomialRoots PolynomialSolver::solveCubicEquation(
   double a, double b, double c, double d, double min_value, double max_value) const
 {
   constexpr double e = std::numeric_limits<double>::epsilon();
   if (std::fabs(a) < e) {
-    return solveQuadraticEquation(b, c, d);
+    return solveQuadraticEquation(b, c, d, min_value, max_value);
   }
-  std::vector<double> solutions, candidates, ret;
-  auto result = solveP3(solutions, b / a, c / a, d / a);
+  std::array<double, 3> solutions;
+  const auto result = solveP3(solutions, b / a, c / a, d / a);
+  /**
+   * @note solveP3 returns 3 for 3 real roots, 2 for a double root and 1 for a single real root and
+   * complex roots x[1] ± i*x[2]. Around a double root, rounding errors often turn the double root into
+   * complex roots with tiny imaginary part, so the real part is also a candidate in that case.
+   */
+  constexpr double imaginary_part_threshold = 1e-6;
+  std::size_t candidate_size = 0;
   if (result == 3) {
-    candidates = solutions;
+    candidate_size = 3;
   } else if (result == 2) {
-    candidates = {solutions[0], solutions[1]};
+    candidate_size = 2;
   } else if (result == 1) {
-    candidates = {solutions[0]};
+    candidate_size =
+      std::fabs(solutions[2]) < imaginary_part_threshold * std::max(1.0, std::fabs(solutions[1]))
+        ? 2
+        : 1;
   }
-  for (const auto candidate : candidates) {
-    if (min_value <= candidate && candidate <= max_value) {
-      ret.emplace_back(candidate);
-    }
+  PolynomialRoots ret;
+  for (std::size_t i = 0; i < candidate_size; i++) {
+    appendRoot(ret, refineCubicRoot(a, b, c, d, solutions[i]), min_value, max_value);
   }
   return ret;
 }
 
-int PolynomialSolver::solveP3(std::vector<double> & x, double a, double b, double c) const
+double PolynomialSolver::refineCubicRoot(double a, double b, double c, double d, double t) const
+{
+  constexpr int max_iteration = 4;
+  double residual = std::fabs(cubicFunction(a, b, c, d, t));
+  for (int i = 0; i < max_iteration && residual > 0; i++) {
+    const double derivative = quadraticFunction(3 * a, 2 * b, c, t);
+    if (std::fabs(derivative) < std::numeric_limits<double>::epsilon()) {
+      break;
+    }
+    const double next_t = t - cubicFunction(a, b, c, d, t) / derivative;
+    const double next_residual = std::fabs(cubicFunction(a, b, c, d, next_t));
+    if (next_residual >= residual) {
+      break;
+    }
+    t = next_t;
+    residual = next_residual;
+  }
+  return t;
+}
+
+int PolynomialSolver::solveP3(std::array<double, 3> & x, double a, double b, double c) const
 {
-  x = std::vector<double>(3);
+  x = {0, 0, 0};
   const double eps = std::numeric_limits<double>::epsilon();
   double a2 = a * a;
   double q = (a2 - 3 * b) / 9;
@@ -114,6 +161,11 @@ int PolynomialSolver::solveP3(std::vector<double> & x, double a, double b, doubl
   double q3 = q * q * q;
   double A, B;
   if (r2 <= (q3 + eps)) {  //<<-- FIXED!
+    if (q <= 0) {
+      // triple root, q3 can be 0 or negative by rounding errors
+      x = {-a / 3, -a / 3, -a / 3};
+      return 3;
+    }
     double t = r / sqrt(q3);
     if (t < -1) {
       t = -1;
@@ -32,6 +32,16 @@ void MetricBase::setEntityManager(
   entity_manager_ptr_ = entity_manager_ptr;
 }
 
+auto MetricBase::getEntityHandle(const std::string & name)
+  -> const traffic_simulator::entity::EntityHandle &
+{
+  if (name != entity_name_ or not entity_manager_ptr_->entityExists(entity_handle_)) {
+    entity_handle_ = entity_manager_ptr_->getEntityHandle(name);
+    entity_name_ = name;
+  }
+  return entity_handle_;
+}
+
 void MetricBase::success()
 {
   if (lifecycle_ != MetricLifecycle::ACTIVE) {
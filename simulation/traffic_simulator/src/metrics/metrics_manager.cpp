@@ -14,20 +14,18 @@
 
 #include <iostream>
 #include <memory>
+#include <simple_profiler/profiler.hpp>
 #include <string>
 #include <traffic_simulator/metrics/metric_base.hpp>
 #include <traffic_simulator/metrics/metrics_manager.hpp>
+#include <utility>
 #include <vector>
 
 namespace metrics
 {
 MetricsManager::MetricsManager(
-  const boost::filesystem::path & log_path, const bool verbose, const bool write_file_every_frame)
-: log_path(log_path),
-  write_file_every_frame(write_file_every_frame),
-  verbose_(verbose),
-  metrics_(),
-  file_(log_path.string())
+  const boost::filesystem::path & log_path, const bool verbose, const std::size_t history_size)
+: log_path(log_path), verbose_(verbose), history_(history_size), metrics_(), writer_(log_path)
 {
 }
 
@@ -51,7 +49,8 @@ MetricLifecycle MetricsManager::getLifecycle(const std::string & name)
 
 void MetricsManager::calculate()
 {
-  nlohmann::json log;
+  PROFILE_SCOPE("MetricsManager::calculate");
+  nlohmann::json log = nlohmann::json::object();
   std::vector<std::string> disable_metrics_list = {};
   for (const auto & metric : metrics_) {
     if (metric.second->getLifecycle() == MetricLifecycle::INACTIVE) {
@@ -62,22 +61,31 @@ void MetricsManager::calculate()
     if (metric.second->getLifecycle() == MetricLifecycle::ACTIVE) {
       metric.second->update();
     }
-    log[metric.first] = metric.second->toJson();
-    if (verbose_) {
-      std::cout << "metric : " << metric.first << " => " << log[metric.first] << std::endl;
+    const auto lifecycle = metric.second->getLifecycle();
+    auto json = metric.second->toJson();
+    if (auto & written = written_metrics_[metric.first]; written != json) {
+      written = json;
+      log[metric.first] = std::move(json);
+      if (verbose_) {
+        std::cout << "metric : " << metric.first << " => " << log[metric.first] << std::endl;
+      }
     }
-    if (
-      metric.second->getLifecycle() == MetricLifecycle::SUCCESS ||
-      metric.second->getLifecycle() == MetricLifecycle::FAILURE) {
+    if (lifecycle == MetricLifecycle::SUCCESS || lifecycle == MetricLifecycle::FAILURE) {
       disable_metrics_list.emplace_back(metric.first);
     }
   }
+  if (not log.empty()) {
+    nlohmann::json frame;
+    frame["time"] = entity_manager_ptr_->getCurrentTime();
+    frame["metrics"] = std::move(log);
+    writer_.write(frame.dump());
+    history_.push_back(std::move(frame));
+  }
   for (const auto & name : disable_metrics_list) {
     if (metrics_[name]->getLifecycle() == MetricLifecycle::FAILURE) {
       metrics_[name]->throwException();
     }
   }
-  log_[std::to_string(entity_manager_ptr_->getCurrentTime())] = log;
 }
 
 void MetricsManager::setEntityManager(
@@ -0,0 +1,73 @@
+// Copyright 2015-2021 TierIV.inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <string>
+#include <traffic_simulator/metrics/metrics_writer.hpp>
+#include <utility>
+
+namespace metrics
+{
+MetricsWriter::MetricsWriter(const boost::filesystem::path & path, std::size_t capacity)
+: file(path.string()),
+  capacity(std::max<std::size_t>(capacity, 1)),
+  writer([this]() {
+    std::unique_lock<std::mutex> lock(mutex);
+
+    while (true) {
+      condition.wait(lock, [this]() { return stopped or not lines.empty(); });
+
+      if (lines.empty()) {
+        break;  // NOTE: Stopped, and every line has been written.
+      }
+
+      std::deque<std::string> batch;
+      std::swap(lines, batch);
+
+      lock.unlock();
+      {
+        condition.notify_all();  // NOTE: Wake write() blocked on the capacity.
+        for (const auto & line : batch) {
+          file << line << '\n';
+        }
+        file.flush();
+      }
+      lock.lock();
+    }
+  })
+{
+}
+
+MetricsWriter::~MetricsWriter()
+{
+  if (writer.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stopped = true;
+    }
+    condition.notify_all();
+    writer.join();
+  }
+}
+
+void MetricsWriter::write(std::string line)
+{
+  {
+    std::unique_lock<std::mutex> lock(mutex);
+    condition.wait(lock, [this]() { return lines.size() < capacity; });
+    lines.push_back(std::move(line));
+  }
+  condition.notify_all();
+}
+}  // namespace metrics
@@ -19,7 +19,7 @@ namespace metrics
 {
 void MomentaryStopMetric::update()
 {
-  auto status = entity_manager_ptr_->getEntityStatus(target_entity);
+  auto status = entity_manager_ptr_->getEntityStatus(getEntityHandle(target_entity));
   if (!status) {
     THROW_SIMULATION_ERROR("failed to get target entity status.");
     return;
@@ -42,7 +42,8 @@ void MomentaryStopMetric::update()
   distance_to_stopline_ = distance.get();
   linear_acceleration_ = status->action_status.accel.linear.x;
   if (min_acceleration <= linear_acceleration_ && linear_acceleration_ <= max_acceleration) {
-    auto standstill_duration = entity_manager_ptr_->getStandStillDuration(target_entity);
+    auto standstill_duration =
+      entity_manager_ptr_->getStandStillDuration(getEntityHandle(target_entity));
     if (!standstill_duration) {
       THROW_SIMULATION_ERROR("failed to calculate standstill duration.");
     }
@@ -63,7 +64,7 @@ void MomentaryStopMetric::update()
 
 bool MomentaryStopMetric::activateTrigger()
 {
-  auto status = entity_manager_ptr_->getEntityStatus(target_entity);
+  auto status = entity_manager_ptr_->getEntityStatus(getEntityHandle(target_entity));
   if (!status) {
     return false;
   }
@@ -30,7 +30,7 @@ void OutOfRangeMetric::setEntityManager(
 
 void OutOfRangeMetric::update()
 {
-  const auto status = entity_manager_ptr_->getEntityStatus(target_entity);
+  const auto status = entity_manager_ptr_->getEntityStatus(getEntityHandle(target_entity));
   if (!status) {
     THROW_SIMULATION_ERROR("failed to get status of target_entity (", target_entity, ")");
     return;
@@ -54,7 +54,7 @@ void OutOfRangeMetric::update()
   }
 
   if (!jerk_callback_ptr_) {
-    const auto jerk_opt = entity_manager_ptr_->getLinearJerk(target_entity);
+    const auto jerk_opt = entity_manager_ptr_->getLinearJerk(getEntityHandle(target_entity));
     if (jerk_opt) {
       linear_jerk_ = jerk_opt.get();
     }
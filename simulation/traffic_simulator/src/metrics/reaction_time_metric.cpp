@@ -35,7 +35,7 @@ bool ReactionTimeMetric::activateTrigger() { return true; }
 
 void ReactionTimeMetric::update()
 {
-  const auto jerk = entity_manager_ptr_->getLinearJerk(target_entity);
+  const auto jerk = entity_manager_ptr_->getLinearJerk(getEntityHandle(target_entity));
   if (!jerk) {
     THROW_SIMULATION_ERROR("failed to calculate linear jerk.");
   }
@@ -29,7 +29,7 @@ bool StandstillMetric::activateTrigger() { return true; }
 
 void StandstillMetric::update()
 {
-  standstill_duration_ = entity_manager_ptr_->getStandStillDuration(target_entity);
+  standstill_duration_ = entity_manager_ptr_->getStandStillDuration(getEntityHandle(target_entity));
   if (standstill_duration_ && standstill_duration_.get() >= allow_standstill_duration) {
     failure(SPECIFICATION_VIOLATION(
       "Standstill duration over ", allow_standstill_duration, " seconds. Stand still duration is ",
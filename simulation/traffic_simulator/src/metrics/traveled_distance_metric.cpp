@@ -28,10 +28,10 @@ bool TraveledDistanceMetric::activateTrigger() { return true; }
 void TraveledDistanceMetric::update()
 {
   double step_time = entity_manager_ptr_->getStepTime();
-  auto status = entity_manager_ptr_->getEntityStatus(target_entity);
+  auto status = entity_manager_ptr_->getEntityStatus(getEntityHandle(target_entity));
   if (status) {
     traveled_distance =
-      traveled_distance + std::fabs(status.get().action_status.twist.linear.x) * step_time;
+      traveled_distance + std::fabs(status->action_status.twist.linear.x) * step_time;
   }
 }
 
@@ -43,6 +43,14 @@ void SimulationClock::update()
   current_simulation_time_ = current_simulation_time_ + step_time_;
 }
 
+void SimulationClock::setCurrentSimulationTime(double current_simulation_time)
+{
+  if (!initialized_) {
+    THROW_SIMULATION_ERROR("SimulationClock has not been initialized yet.");
+  }
+  current_simulation_time_ = current_simulation_time;
+}
+
 const rosgraph_msgs::msg::Clock SimulationClock::getCurrentRosTimeAsMsg()
 {
   rosgraph_msgs::msg::Clock clock;
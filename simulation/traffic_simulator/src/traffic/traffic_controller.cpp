@@ -26,7 +26,7 @@
 #include <memory>
 #include <string>
 #include <traffic_simulator/traffic/traffic_controller.hpp>
-#include <traffic_simulator/traffic/traffic_sink.hpp>
+#include <traffic_simulator/traffic/traffic_sink_grid.hpp>
 #include <utility>
 #include <vector>
 
@@ -52,17 +52,22 @@ TrafficController::TrafficController(
 
 void TrafficController::autoSink()
 {
+  constexpr double sink_radius = 1;
+  constexpr double cell_size = 10;  // NOTE: Large enough that most sinks are in a single cell.
+  const auto sinks = std::make_shared<TrafficSinkGrid>(
+    cell_size, get_entity_names_function, get_entity_pose_function, despawn_function);
   for (const auto & lanelet_id : hdmap_utils_->getLaneletIds()) {
     if (hdmap_utils_->getNextLaneletIds(lanelet_id).empty()) {
       traffic_simulator_msgs::msg::LaneletPose lanelet_pose;
       lanelet_pose.lanelet_id = lanelet_id;
       lanelet_pose.s = hdmap_utils_->getLaneletLength(lanelet_id);
       const auto pose = hdmap_utils_->toMapPose(lanelet_pose);
-      addModule<traffic_simulator::traffic::TrafficSink>(
-        1, pose.pose.position, get_entity_names_function, get_entity_pose_function,
-        despawn_function);
+      sinks->addSink(sink_radius, pose.pose.position);
     }
   }
+  if (sinks->getSinkCount() != 0) {
+    modules_.emplace_back(sinks);
+  }
 }
 
 void TrafficController::execute()
@@ -0,0 +1,89 @@
+/**
+ * @file traffic_sink_grid.cpp
+ * @brief implementation of the TrafficSinkGrid class
+ * @version 0.1
+ * @date 2021-10-19
+ *
+ * @copyright Copyright(c) Tier IV.Inc {2015-2021}
+ *
+ */
+
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cmath>
+#include <functional>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/math/distance.hpp>
+#include <traffic_simulator/traffic/traffic_sink_grid.hpp>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace traffic
+{
+TrafficSinkGrid::TrafficSinkGrid(
+  double cell_size,
+  const std::function<std::vector<std::string>(void)> & get_entity_names_function,
+  const std::function<geometry_msgs::msg::Pose(const std::string &)> & get_entity_pose_function,
+  const std::function<void(std::string)> & despawn_function)
+: TrafficModuleBase(),
+  cell_size(cell_size),
+  get_entity_names_function(get_entity_names_function),
+  get_entity_pose_function(get_entity_pose_function),
+  despawn_function(despawn_function)
+{
+  if (not(cell_size > 0)) {
+    THROW_SIMULATION_ERROR("The cell size of TrafficSinkGrid must be positive, but ", cell_size);
+  }
+}
+
+void TrafficSinkGrid::addSink(double radius, const geometry_msgs::msg::Point & position)
+{
+  const auto min = getCell(position.x - radius, position.y - radius);
+  const auto max = getCell(position.x + radius, position.y + radius);
+  for (auto x = min.first; x <= max.first; ++x) {
+    for (auto y = min.second; y <= max.second; ++y) {
+      cells_[Cell(x, y)].push_back({radius, position});
+    }
+  }
+  ++sink_count_;
+}
+
+auto TrafficSinkGrid::getSinkCount() const -> std::size_t { return sink_count_; }
+
+auto TrafficSinkGrid::getCell(double x, double y) const -> Cell
+{
+  return Cell(std::floor(x / cell_size), std::floor(y / cell_size));
+}
+
+void TrafficSinkGrid::execute()
+{
+  const auto names = get_entity_names_function();
+  for (const auto & name : names) {
+    const auto pose = get_entity_pose_function(name);
+    const auto iter = cells_.find(getCell(pose.position.x, pose.position.y));
+    if (iter != std::end(cells_)) {
+      for (const auto & sink : iter->second) {
+        if (traffic_simulator::math::getDistance(sink.position, pose) <= sink.radius) {
+          despawn_function(name);
+          break;
+        }
+      }
+    }
+  }
+}
+}  // namespace traffic
+}  // namespace traffic_simulator
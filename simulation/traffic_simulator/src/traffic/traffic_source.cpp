@@ -0,0 +1,108 @@
+/**
+ * @file traffic_source.cpp
+ * @brief implementation of the TrafficSource class
+ * @version 0.1
+ * @date 2021-10-19
+ *
+ * @copyright Copyright(c) Tier IV.Inc {2015-2021}
+ *
+ */
+
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <algorithm>
+#include <functional>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/math/distance.hpp>
+#include <traffic_simulator/traffic/traffic_source.hpp>
+#include <vector>
+
+namespace traffic_simulator
+{
+namespace traffic
+{
+TrafficSource::TrafficSource(
+  const std::string & name, const traffic_simulator_msgs::msg::LaneletPose & lanelet_pose,
+  const geometry_msgs::msg::Point & position, const Parameters & parameters,
+  const std::function<std::vector<std::string>(void)> & get_entity_names_function,
+  const std::function<geometry_msgs::msg::Pose(const std::string &)> & get_entity_pose_function,
+  const std::function<bool(
+    const std::string &, const traffic_simulator_msgs::msg::LaneletPose &, double)> &
+    spawn_function,
+  const std::function<double(void)> & get_current_time_function)
+: TrafficModuleBase(),
+  name(name),
+  lanelet_pose(lanelet_pose),
+  position(position),
+  parameters(parameters),
+  get_entity_names_function(get_entity_names_function),
+  get_entity_pose_function(get_entity_pose_function),
+  spawn_function(spawn_function),
+  get_current_time_function(get_current_time_function),
+  next_spawn_time_(get_current_time_function())
+{
+  if (not(parameters.flow_rate > 0)) {
+    THROW_SEMANTIC_ERROR(
+      "The flow rate of traffic source ", name, " must be positive, but ", parameters.flow_rate);
+  }
+}
+
+void TrafficSource::execute()
+{
+  const auto current_time = get_current_time_function();
+  if (current_time < next_spawn_time_) {
+    return;
+  }
+  const auto names = get_entity_names_function();
+  if (
+    not isBlocked(names) and
+    spawn_function(nextEntityName(names), lanelet_pose, parameters.speed)) {
+    const auto period = 1 / parameters.flow_rate;
+    next_spawn_time_ = std::max(next_spawn_time_, current_time - period) + period;
+    ++spawn_count_;
+  }
+}
+
+auto TrafficSource::getSpawnCount() const -> std::size_t { return spawn_count_; }
+
+auto TrafficSource::isBlocked(const std::vector<std::string> & names) const -> bool
+{
+  const auto gap = std::max(parameters.speed * parameters.minimum_headway, parameters.minimum_gap);
+  const auto capacity = parameters.maximum_density * parameters.density_range;
+  std::size_t count = 0;
+  for (const auto & each : names) {
+    const auto distance =
+      traffic_simulator::math::getDistance(position, get_entity_pose_function(each));
+    if (distance < gap) {
+      return true;
+    } else if (distance <= parameters.density_range and capacity <= ++count) {
+      return true;
+    }
+  }
+  return capacity <= count;
+}
+
+auto TrafficSource::nextEntityName(const std::vector<std::string> & names) -> const std::string &
+{
+  for (const auto & entity_name : entity_names_) {
+    if (std::find(std::begin(names), std::end(names), entity_name) == std::end(names)) {
+      return entity_name;
+    }
+  }
+  return entity_names_.emplace_back(name + "_" + std::to_string(entity_names_.size()));
+}
+}  // namespace traffic
+}  // namespace traffic_simulator
@@ -20,7 +20,7 @@
 #include <traffic_simulator_msgs/msg/pedestrian_parameters.hpp>
 #include <traffic_simulator_msgs/msg/vehicle_parameters.hpp>
 
-auto getVehicleParameters() -> traffic_simulator_msgs::msg::VehicleParameters
+inline auto getVehicleParameters() -> traffic_simulator_msgs::msg::VehicleParameters
 {
   traffic_simulator_msgs::msg::VehicleParameters parameters;
   parameters.name = "vehicle.volkswagen.t";
@@ -47,7 +47,7 @@ auto getVehicleParameters() -> traffic_simulator_msgs::msg::VehicleParameters
   return parameters;
 }
 
-auto getPedestrianParameters() -> traffic_simulator_msgs::msg::PedestrianParameters
+inline auto getPedestrianParameters() -> traffic_simulator_msgs::msg::PedestrianParameters
 {
   traffic_simulator_msgs::msg::PedestrianParameters parameters;
   parameters.name = "pedestrian";
@@ -61,7 +61,7 @@ auto getPedestrianParameters() -> traffic_simulator_msgs::msg::PedestrianParamet
   return parameters;
 }
 
-auto getMiscObjectParameters() -> traffic_simulator_msgs::msg::MiscObjectParameters
+inline auto getMiscObjectParameters() -> traffic_simulator_msgs::msg::MiscObjectParameters
 {
   traffic_simulator_msgs::msg::MiscObjectParameters misc_object_param;
   misc_object_param.bounding_box.dimensions.x = 1.0;
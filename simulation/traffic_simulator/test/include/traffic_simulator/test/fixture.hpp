@@ -0,0 +1,74 @@
+// Copyright 2015-2020 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__TEST__FIXTURE_HPP_
+#define TRAFFIC_SIMULATOR__TEST__FIXTURE_HPP_
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cstdint>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/api/configuration.hpp>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+
+/**
+ * @brief a node with the origin of the maps of traffic_simulator and kashiwanoha_map.
+ */
+inline auto makeNode(const std::string & name) -> std::shared_ptr<rclcpp::Node>
+{
+  return std::make_shared<rclcpp::Node>(
+    name, rclcpp::NodeOptions().parameter_overrides(
+            {{"origin_latitude", 35.61836750154}, {"origin_longitude", 139.78066608243}}));
+}
+
+/**
+ * @brief a configuration with the map installed to the share directory of the package.
+ */
+inline auto makeConfiguration(const std::string & map_package = "traffic_simulator")
+  -> traffic_simulator::Configuration
+{
+  return traffic_simulator::Configuration(
+    ament_index_cpp::get_package_share_directory(map_package) + "/map");
+}
+
+/**
+ * @brief the lanelet the tests spawn entities on.
+ */
+constexpr std::int64_t spawn_lanelet_id = 34741;
+
+inline auto makeSpawnPose(const double s = 0) -> traffic_simulator_msgs::msg::LaneletPose
+{
+  return traffic_simulator::helper::constructLaneletPose(spawn_lanelet_id, s, 0);
+}
+
+/**
+ * @brief the status of an entity spawned at s on the spawn lanelet.
+ */
+inline auto makeSpawnStatus(
+  const traffic_simulator::entity::EntityManager & entity_manager, const double s,
+  const traffic_simulator_msgs::msg::BoundingBox & bounding_box)
+  -> traffic_simulator_msgs::msg::EntityStatus
+{
+  traffic_simulator_msgs::msg::EntityStatus status;
+  status.lanelet_pose = makeSpawnPose(s);
+  status.lanelet_pose_valid = true;
+  status.pose = entity_manager.toMapPose(status.lanelet_pose);
+  status.bounding_box = bounding_box;
+  status.action_status = traffic_simulator::helper::constructActionStatus();
+  return status;
+}
+
+#endif  // TRAFFIC_SIMULATOR__TEST__FIXTURE_HPP_
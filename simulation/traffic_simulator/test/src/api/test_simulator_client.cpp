@@ -0,0 +1,103 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <simple_sensor_simulator/simple_sensor_simulator.hpp>
+#include <string>
+#include <traffic_simulator/api/api.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/test/catalogs.hpp>
+#include <traffic_simulator/test/fixture.hpp>
+#include <utility>
+#include <vector>
+
+using Frame = std::pair<bool, std::vector<traffic_simulator_msgs::msg::EntityStatus>>;
+
+constexpr unsigned int port_offset = 100;
+
+/**
+ * @brief spawn two obstacles, despawn one halfway, and record the result of every request and the
+ * status of every entity per frame.
+ *
+ * Unless in_process_simulator, requests go over ZeroMQ to a ScenarioSimulator on its own thread.
+ */
+auto runScenario(const bool in_process_simulator) -> std::vector<Frame>
+{
+  const auto simulator =
+    in_process_simulator
+      ? nullptr
+      : std::make_shared<simple_sensor_simulator::ScenarioSimulator>(
+          rclcpp::NodeOptions().parameter_overrides({{"port_offset", int(port_offset)}}));
+
+  const auto node = makeNode(
+    in_process_simulator ? "test_simulator_client_in_process" : "test_simulator_client_zeromq");
+
+  auto configuration = makeConfiguration();
+  configuration.in_process_simulator = in_process_simulator;
+  configuration.simulator_port_offset = port_offset;
+
+  traffic_simulator::API api(node, configuration);
+
+  std::vector<Frame> frames;
+
+  auto record = [&](bool result) {
+    std::vector<traffic_simulator_msgs::msg::EntityStatus> statuses;
+    for (const auto & name : api.getEntityNames()) {
+      statuses.push_back(*api.getEntityStatus(name));
+    }
+    frames.emplace_back(result, statuses);
+  };
+
+  record(api.initialize(1.0, 0.05));
+
+  for (const auto & [name, s] :
+       {std::make_pair("obstacle0", 0.0), std::make_pair("obstacle1", 5.0)}) {
+    record(api.spawn(name, getMiscObjectParameters()));
+    record(api.setEntityStatus(
+      name, makeSpawnPose(s), traffic_simulator::helper::constructActionStatus()));
+  }
+
+  for (auto frame = 0; frame < 20; ++frame) {
+    if (frame == 10) {
+      record(api.despawn("obstacle1"));
+    }
+    record(api.updateFrame());
+  }
+
+  return frames;
+}
+
+TEST(SIMULATOR_CLIENT, IN_PROCESS_SIMULATOR_IS_EQUIVALENT_TO_ZEROMQ)
+{
+  const auto frames_over_zeromq = runScenario(false);
+  const auto frames_in_process = runScenario(true);
+  ASSERT_EQ(frames_over_zeromq.size(), frames_in_process.size());
+  for (std::size_t i = 0; i < frames_over_zeromq.size(); ++i) {
+    EXPECT_TRUE(frames_over_zeromq[i].first) << "frame " << i;
+    EXPECT_EQ(frames_over_zeromq[i].first, frames_in_process[i].first) << "frame " << i;
+    EXPECT_TRUE(frames_over_zeromq[i].second == frames_in_process[i].second) << "frame " << i;
+  }
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+  const auto result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
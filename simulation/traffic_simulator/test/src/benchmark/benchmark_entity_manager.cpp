@@ -0,0 +1,151 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/api/configuration.hpp>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/test/catalogs.hpp>
+#include <vector>
+
+#include "kashiwanoha.hpp"
+
+/**
+ * @brief NPC vehicles driven by the default behavior plugin, spread over the road lanelets.
+ *
+ * Nothing subscribes the topics of the EntityManager, so nothing is published while updating.
+ */
+static void UpdateEntityManager(benchmark::State & state)
+{
+  const auto node = std::make_shared<rclcpp::Node>(
+    "traffic_simulator_benchmarks",
+    rclcpp::NodeOptions().parameter_overrides(
+      {{"origin_latitude", kashiwanoha::origin().latitude},
+       {"origin_longitude", kashiwanoha::origin().longitude}}));
+
+  traffic_simulator::entity::EntityManager entity_manager(
+    node, traffic_simulator::Configuration(kashiwanoha::mapPath()));
+
+  const auto & lanelet_ids = kashiwanoha::roadLaneletIds();
+
+  try {
+    for (std::int64_t i = 0; i < state.range(0); ++i) {
+      const auto name = "npc" + std::to_string(i);
+      const auto lanelet_id = lanelet_ids[i % lanelet_ids.size()];
+      const auto s = std::fmod(
+        1.0 + 10.0 * (i / lanelet_ids.size()),
+        kashiwanoha::hdmapUtils().getLaneletLength(lanelet_id));
+      entity_manager.spawnEntity<traffic_simulator::entity::VehicleEntity>(
+        name, getVehicleParameters());
+      traffic_simulator_msgs::msg::EntityStatus status;
+      status.lanelet_pose = traffic_simulator::helper::constructLaneletPose(lanelet_id, s, 0);
+      status.lanelet_pose_valid = true;
+      status.pose = entity_manager.toMapPose(status.lanelet_pose);
+      status.action_status = traffic_simulator::helper::constructActionStatus(5);
+      entity_manager.setEntityStatus(name, status);
+      entity_manager.requestSpeedChange(name, 10, true);
+    }
+  } catch (const std::exception & error) {
+    state.SkipWithError(error.what());  // NOTE: e.g. behavior_tree_plugin is not installed.
+    return;
+  }
+
+  double current_time = 0;
+  for (auto _ : state) {
+    entity_manager.update(current_time, 0.05);
+    current_time += 0.05;
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(UpdateEntityManager)->Arg(10)->Arg(100)->Arg(500)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief MiscObjectEntities along the road lanelets, which load no behavior plugin, so that only
+ * the cost of EntityManager itself is measured.
+ */
+struct MiscObjects
+{
+  const std::shared_ptr<rclcpp::Node> node = std::make_shared<rclcpp::Node>(
+    "traffic_simulator_benchmarks",
+    rclcpp::NodeOptions().parameter_overrides(
+      {{"origin_latitude", kashiwanoha::origin().latitude},
+       {"origin_longitude", kashiwanoha::origin().longitude}}));
+
+  traffic_simulator::entity::EntityManager entity_manager;
+
+  std::vector<std::string> names;
+
+  explicit MiscObjects(std::size_t size)
+  : entity_manager(node, traffic_simulator::Configuration(kashiwanoha::mapPath()))
+  {
+    const auto & lanelet_ids = kashiwanoha::roadLaneletIds();
+    for (std::size_t i = 0; i < size; ++i) {
+      names.push_back("obstacle" + std::to_string(i));
+      entity_manager.spawnEntity<traffic_simulator::entity::MiscObjectEntity>(
+        names.back(), getMiscObjectParameters());
+      traffic_simulator_msgs::msg::EntityStatus status;
+      status.lanelet_pose = traffic_simulator::helper::constructLaneletPose(
+        lanelet_ids[i % lanelet_ids.size()], 1.0, 0);
+      status.lanelet_pose_valid = true;
+      status.pose = entity_manager.toMapPose(status.lanelet_pose);
+      status.bounding_box = getMiscObjectParameters().bounding_box;
+      status.action_status = traffic_simulator::helper::constructActionStatus();
+      entity_manager.setEntityStatus(names.back(), status);
+    }
+  }
+};
+
+static void UpdateEntityManagerWithMiscObjects(benchmark::State & state)
+{
+  MiscObjects world(state.range(0));
+  double current_time = 0;
+  for (auto _ : state) {
+    world.entity_manager.update(current_time, 0.05);
+    current_time += 0.05;
+  }
+}
+BENCHMARK(UpdateEntityManagerWithMiscObjects)->Arg(500)->Unit(benchmark::kMillisecond);
+
+static void GetEntityStatusByName(benchmark::State & state)
+{
+  MiscObjects world(state.range(0));
+  for (auto _ : state) {
+    for (const auto & name : world.names) {
+      benchmark::DoNotOptimize(world.entity_manager.getEntityStatus(name));
+    }
+  }
+}
+BENCHMARK(GetEntityStatusByName)->Arg(500);
+
+static void GetEntityStatusByHandle(benchmark::State & state)
+{
+  MiscObjects world(state.range(0));
+  std::vector<traffic_simulator::entity::EntityHandle> handles;
+  for (const auto & name : world.names) {
+    handles.push_back(world.entity_manager.getEntityHandle(name));
+  }
+  for (auto _ : state) {
+    for (const auto & handle : handles) {
+      benchmark::DoNotOptimize(world.entity_manager.getEntityStatus(handle));
+    }
+  }
+}
+BENCHMARK(GetEntityStatusByHandle)->Arg(500);
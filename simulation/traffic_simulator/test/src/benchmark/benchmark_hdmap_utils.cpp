@@ -0,0 +1,104 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <geometry_msgs/msg/pose.hpp>
+#include <traffic_simulator/data_type/data_types.hpp>
+#include <traffic_simulator_msgs/msg/bounding_box.hpp>
+#include <vector>
+
+#include "kashiwanoha.hpp"
+
+static auto makePosesOnRoads()
+{
+  std::vector<geometry_msgs::msg::Pose> poses;
+  for (const auto lanelet_id : kashiwanoha::roadLaneletIds()) {
+    poses.push_back(kashiwanoha::hdmapUtils().toMapPose(lanelet_id, 1.0, 0.5).pose);
+  }
+  return poses;
+}
+
+static void ToLaneletPose(benchmark::State & state)
+{
+  const auto poses = makePosesOnRoads();
+  for (auto _ : state) {
+    for (const auto & pose : poses) {
+      benchmark::DoNotOptimize(kashiwanoha::hdmapUtils().toLaneletPose(pose, false));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * poses.size());
+}
+BENCHMARK(ToLaneletPose)->Unit(benchmark::kMillisecond);
+
+static void MatchToLane(benchmark::State & state)
+{
+  const auto poses = makePosesOnRoads();
+  traffic_simulator_msgs::msg::BoundingBox bounding_box;
+  bounding_box.dimensions.x = 4.5;
+  bounding_box.dimensions.y = 2.1;
+  bounding_box.dimensions.z = 1.8;
+  for (auto _ : state) {
+    for (const auto & pose : poses) {
+      benchmark::DoNotOptimize(kashiwanoha::hdmapUtils().matchToLane(pose, bounding_box, false));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * poses.size());
+}
+BENCHMARK(MatchToLane)->Unit(benchmark::kMillisecond);
+
+static void GetRoute(benchmark::State & state)
+{
+  const auto & route = kashiwanoha::longRoute();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kashiwanoha::hdmapUtils().getRoute(route.front(), route.back()));
+  }
+}
+BENCHMARK(GetRoute);
+
+static void GetFollowingLanelets(benchmark::State & state)
+{
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kashiwanoha::hdmapUtils().getFollowingLanelets(34513, 100, true));
+  }
+}
+BENCHMARK(GetFollowingLanelets);
+
+static void GetLongitudinalDistance(benchmark::State & state)
+{
+  const auto & route = kashiwanoha::longRoute();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      kashiwanoha::hdmapUtils().getLongitudinalDistance(route.front(), 0, route.back(), 0));
+  }
+}
+BENCHMARK(GetLongitudinalDistance);
+
+/**
+ * @brief a lane change from lanelet 34462 to the adjacent lanelet 34513, both long enough for the
+ * goal search to dominate.
+ */
+static void GetLaneChangeTrajectory(benchmark::State & state)
+{
+  const traffic_simulator::lane_change::Parameter parameter(
+    traffic_simulator::lane_change::AbsoluteTarget(34513),
+    traffic_simulator::lane_change::TrajectoryShape::CUBIC,
+    traffic_simulator::lane_change::Constraint());
+  const auto from_pose = kashiwanoha::hdmapUtils().toMapPose(34462, 5.0, 0).pose;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(kashiwanoha::hdmapUtils().getLaneChangeTrajectory(
+      from_pose, parameter, 10.0, state.range(0), 1.0));
+  }
+}
+BENCHMARK(GetLaneChangeTrajectory)->Arg(10)->Arg(20)->Arg(40);
@@ -0,0 +1,194 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <geometry_msgs/msg/point.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+#include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/math/catmull_rom_spline.hpp>
+#include <traffic_simulator/math/collision.hpp>
+#include <traffic_simulator/math/hermite_curve.hpp>
+#include <traffic_simulator/math/polynomial_solver.hpp>
+#include <traffic_simulator_msgs/msg/bounding_box.hpp>
+#include <utility>
+#include <vector>
+
+#include "kashiwanoha.hpp"
+
+/**
+ * @brief the center line of kashiwanoha::longRoute(), like the route splines of the behavior
+ * plugins.
+ */
+static auto makeRouteSpline()
+{
+  return traffic_simulator::math::CatmullRomSpline(
+    kashiwanoha::hdmapUtils().getCenterPoints(kashiwanoha::longRoute()));
+}
+
+static void ConstructCatmullRomSpline(benchmark::State & state)
+{
+  const auto points = kashiwanoha::hdmapUtils().getCenterPoints(kashiwanoha::longRoute());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(traffic_simulator::math::CatmullRomSpline(points));
+  }
+}
+BENCHMARK(ConstructCatmullRomSpline);
+
+static void CatmullRomSplineGetPoint(benchmark::State & state)
+{
+  const auto spline = makeRouteSpline();
+  for (auto _ : state) {
+    for (double s = 0; s < spline.getLength(); s += 1.0) {
+      benchmark::DoNotOptimize(spline.getPoint(s));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(spline.getLength()));
+}
+BENCHMARK(CatmullRomSplineGetPoint);
+
+static void CatmullRomSplineGetSValue(benchmark::State & state)
+{
+  auto spline = makeRouteSpline();
+  std::vector<geometry_msgs::msg::Pose> poses;
+  for (double s = 0; s < spline.getLength(); s += 10.0) {
+    poses.push_back(spline.getPose(s));
+    poses.back().position.y += 0.5;
+  }
+  for (auto _ : state) {
+    for (const auto & pose : poses) {
+      benchmark::DoNotOptimize(spline.getSValue(pose));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * poses.size());
+}
+BENCHMARK(CatmullRomSplineGetSValue);
+
+static void CatmullRomSplineGetCollisionPointIn2D(benchmark::State & state)
+{
+  const auto spline = makeRouteSpline();
+  const auto center = spline.getPose(spline.getLength() * 0.75).position;
+  std::vector<geometry_msgs::msg::Point> polygon;
+  const std::vector<std::pair<double, double>> corners = {{-2, -2}, {2, -2}, {2, 2}, {-2, 2}};
+  for (const auto & corner : corners) {
+    geometry_msgs::msg::Point point;
+    point.x = center.x + corner.first;
+    point.y = center.y + corner.second;
+    point.z = center.z;
+    polygon.push_back(point);
+  }
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(spline.getCollisionPointIn2D(polygon));
+  }
+}
+BENCHMARK(CatmullRomSplineGetCollisionPointIn2D);
+
+static auto makeHermiteCurve()
+{
+  geometry_msgs::msg::Pose start_pose, goal_pose;
+  goal_pose.position.x = 30;
+  goal_pose.position.y = 3.5;
+  geometry_msgs::msg::Vector3 start_vec, goal_vec;
+  start_vec.x = 15;
+  goal_vec.x = 15;
+  return traffic_simulator::math::HermiteCurve(start_pose, goal_pose, start_vec, goal_vec);
+}
+
+static void HermiteCurveGetPoint(benchmark::State & state)
+{
+  const auto curve = makeHermiteCurve();
+  for (auto _ : state) {
+    for (double s = 0; s < 1.0; s += 0.01) {
+      benchmark::DoNotOptimize(curve.getPoint(s));
+    }
+  }
+}
+BENCHMARK(HermiteCurveGetPoint);
+
+static void HermiteCurveGetMaximum2DCurvature(benchmark::State & state)
+{
+  const auto curve = makeHermiteCurve();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(curve.getMaximum2DCurvature());
+  }
+}
+BENCHMARK(HermiteCurveGetMaximum2DCurvature);
+
+static void HermiteCurveGetSValue(benchmark::State & state)
+{
+  const auto curve = makeHermiteCurve();
+  geometry_msgs::msg::Pose pose;
+  pose.position.y = 1.0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(curve.getSValue(pose, 3.0, true));
+    pose.position.x = pose.position.x < 30 ? pose.position.x + 0.01 : 0;
+  }
+}
+BENCHMARK(HermiteCurveGetSValue);
+
+static void HermiteCurveGetCollisionPointIn2D(benchmark::State & state)
+{
+  const auto curve = makeHermiteCurve();
+  std::vector<geometry_msgs::msg::Point> polygon(4);
+  polygon[0].x = 10;
+  polygon[0].y = -5;
+  polygon[1].x = 12;
+  polygon[1].y = -5;
+  polygon[2].x = 12;
+  polygon[2].y = 5;
+  polygon[3].x = 10;
+  polygon[3].y = 5;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(curve.getCollisionPointIn2D(polygon));
+  }
+}
+BENCHMARK(HermiteCurveGetCollisionPointIn2D);
+
+static void SolveQuadraticEquation(benchmark::State & state)
+{
+  traffic_simulator::math::PolynomialSolver solver;
+  double c = -1;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(solver.solveQuadraticEquation(1, 0.5, c));
+    c = c < 1 ? c + 0.001 : -1;
+  }
+}
+BENCHMARK(SolveQuadraticEquation);
+
+static void SolveCubicEquation(benchmark::State & state)
+{
+  traffic_simulator::math::PolynomialSolver solver;
+  double d = -1;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(solver.solveCubicEquation(1, -1.5, 0.5, d));
+    d = d < 1 ? d + 0.001 : -1;
+  }
+}
+BENCHMARK(SolveCubicEquation);
+
+static void CheckCollision2D(benchmark::State & state)
+{
+  traffic_simulator_msgs::msg::BoundingBox bounding_box;
+  bounding_box.dimensions.x = 4.5;
+  bounding_box.dimensions.y = 2.1;
+  bounding_box.dimensions.z = 1.8;
+  geometry_msgs::msg::Pose pose0, pose1;
+  pose1.position.x = state.range(0) / 10.0;  // NOTE: Colliding if less than 4.5 m.
+  pose1.orientation = traffic_simulator::helper::constructPose(0, 0, 0, 0, 0, 0.3).orientation;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      traffic_simulator::math::checkCollision2D(pose0, bounding_box, pose1, bounding_box));
+  }
+}
+BENCHMARK(CheckCollision2D)->Arg(30)->Arg(100);
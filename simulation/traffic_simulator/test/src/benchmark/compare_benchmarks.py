@@ -0,0 +1,107 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+
+# Copyright 2021 Tier IV, Inc. All rights reserved.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""
+Compare results of traffic_simulator_benchmarks against a baseline.
+
+Usage:
+  traffic_simulator_benchmarks --benchmark_out=result.json --benchmark_out_format=json
+  compare_benchmarks.py result.json --baseline baseline.json [--threshold 0.1] [--strict]
+  compare_benchmarks.py result.json --baseline baseline.json --update
+
+No baseline is checked in, as timings depend on the machine and the build type. Record one with
+--update from a release build of the whole suite on the machine to compare on. Benchmarks
+missing from the baseline are reported, and fail the comparison only with --strict.
+"""
+
+import argparse
+import json
+import sys
+
+from pathlib import Path
+
+
+def load(path):
+    with open(path) as file:
+        return {
+            benchmark["name"]: benchmark
+            for benchmark in json.load(file).get("benchmarks", [])
+            if benchmark.get("run_type", "iteration") == "iteration"
+            and "error_occurred" not in benchmark
+        }
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    parser.add_argument("result", type=Path)
+    parser.add_argument("--baseline", type=Path, required=True)
+    parser.add_argument("--threshold", type=float, default=0.1)
+    parser.add_argument("--time", choices=["real_time", "cpu_time"], default="cpu_time")
+    parser.add_argument("--strict", action="store_true")
+    parser.add_argument("--update", action="store_true")
+    args = parser.parse_args()
+
+    if args.update:
+        with open(args.result) as file:
+            result = json.load(file)
+        with open(args.baseline, "w") as file:
+            json.dump(result, file, indent=2)
+            file.write("\n")
+        print("[UPDATED] " + str(args.baseline))
+        return 0
+
+    baseline = load(args.baseline)
+    result = load(args.result)
+
+    regressions = 0
+    new = 0
+
+    for name, benchmark in result.items():
+        if name not in baseline:
+            print("[NEW    ] " + name)
+            new += 1
+            continue
+        before = baseline[name][args.time]
+        after = benchmark[args.time]
+        if baseline[name]["time_unit"] != benchmark["time_unit"]:
+            print("[SKIPPED] " + name + " (time unit changed)")
+            continue
+        change = (after - before) / before if before else 0.0
+        if args.threshold < change:
+            regressions += 1
+            status = "[SLOWER ]"
+        elif change < -args.threshold:
+            status = "[FASTER ]"
+        else:
+            status = "[OK     ]"
+        print(
+            "{} {} {:.3f} -> {:.3f} {} ({:+.1%})".format(
+                status, name, before, after, benchmark["time_unit"], change
+            )
+        )
+
+    for name in baseline.keys() - result.keys():
+        print("[MISSING] " + name)
+
+    if new:
+        print("{} benchmarks have no baseline; record them with --update".format(new))
+
+    return 1 if regressions or (new and args.strict) else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
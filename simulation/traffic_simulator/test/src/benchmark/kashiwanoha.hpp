@@ -0,0 +1,66 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TRAFFIC_SIMULATOR__TEST__BENCHMARK__KASHIWANOHA_HPP_
+#define TRAFFIC_SIMULATOR__TEST__BENCHMARK__KASHIWANOHA_HPP_
+
+#include <ament_index_cpp/get_package_share_directory.hpp>
+#include <cstdint>
+#include <geographic_msgs/msg/geo_point.hpp>
+#include <string>
+#include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
+#include <vector>
+
+/**
+ * @brief kashiwanoha_map, loaded once per process so that the benchmarks measure warmed-up queries.
+ */
+namespace kashiwanoha
+{
+inline auto mapPath() -> std::string
+{
+  return ament_index_cpp::get_package_share_directory("kashiwanoha_map") + "/map";
+}
+
+inline auto origin() -> geographic_msgs::msg::GeoPoint
+{
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  return origin;
+}
+
+inline auto hdmapUtils() -> hdmap_utils::HdMapUtils &
+{
+  static hdmap_utils::HdMapUtils hdmap_utils(mapPath() + "/lanelet2_map.osm", origin());
+  return hdmap_utils;
+}
+
+inline auto roadLaneletIds() -> const std::vector<std::int64_t> &
+{
+  static const auto lanelet_ids =
+    hdmapUtils().filterLaneletIds(hdmapUtils().getLaneletIds(), "road");
+  return lanelet_ids;
+}
+
+/**
+ * @brief the lanelets following lanelet 34513 for 500 m.
+ */
+inline auto longRoute() -> const std::vector<std::int64_t> &
+{
+  static const auto route = hdmapUtils().getFollowingLanelets(34513, 500, true);
+  return route;
+}
+}  // namespace kashiwanoha
+
+#endif  // TRAFFIC_SIMULATOR__TEST__BENCHMARK__KASHIWANOHA_HPP_
@@ -0,0 +1,135 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <thread>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/test/catalogs.hpp>
+#include <traffic_simulator/test/fixture.hpp>
+
+using traffic_simulator::entity::EntityManager;
+using traffic_simulator::entity::EntityMarkerQoS;
+using traffic_simulator::entity::MiscObjectEntity;
+
+/**
+ * @brief a MiscObjectEntity counting the requests of the trajectory fields of entity/status.
+ */
+class CountingEntity : public MiscObjectEntity
+{
+public:
+  static inline std::size_t waypoints_count = 0;
+
+  static inline std::size_t obstacle_count = 0;
+
+  using MiscObjectEntity::MiscObjectEntity;
+
+  auto getWaypoints() -> const traffic_simulator_msgs::msg::WaypointsArray override
+  {
+    ++waypoints_count;
+    return MiscObjectEntity::getWaypoints();
+  }
+
+  auto getObstacle() -> boost::optional<traffic_simulator_msgs::msg::Obstacle> override
+  {
+    ++obstacle_count;
+    return MiscObjectEntity::getObstacle();
+  }
+};
+
+auto spawn(EntityManager & entity_manager, const std::string & name)
+{
+  entity_manager.spawnEntity<CountingEntity>(name, getMiscObjectParameters());
+  entity_manager.setEntityStatus(
+    name, makeSpawnStatus(entity_manager, 0, getMiscObjectParameters().bounding_box));
+}
+
+auto waitForSubscription(const rclcpp::Node & node, const std::string & topic)
+{
+  for (auto i = 0; i < 100 and node.count_subscribers(topic) == 0; ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  }
+  return 0 < node.count_subscribers(topic);
+}
+
+TEST(ENTITY_MANAGER, NO_TRAJECTORY_WITHOUT_SUBSCRIBERS)
+{
+  const auto node = makeNode("test_entity_manager_without_subscribers");
+  EntityManager entity_manager(node, makeConfiguration());
+  spawn(entity_manager, "obstacle0");
+  spawn(entity_manager, "obstacle1");
+  CountingEntity::waypoints_count = 0;
+  CountingEntity::obstacle_count = 0;
+  for (auto frame = 0; frame < 10; ++frame) {
+    entity_manager.update(0.05 * frame, 0.05);
+  }
+  EXPECT_EQ(CountingEntity::waypoints_count, std::size_t(0));
+  EXPECT_EQ(CountingEntity::obstacle_count, std::size_t(0));
+}
+
+TEST(ENTITY_MANAGER, DECIMATED_TRAJECTORY_WITH_SUBSCRIBERS)
+{
+  const auto node = makeNode("test_entity_manager_with_subscribers");
+  auto configuration = makeConfiguration();
+  configuration.entity_status_publish_decimation = 5;
+  EntityManager entity_manager(node, configuration);
+  spawn(entity_manager, "obstacle0");
+  spawn(entity_manager, "obstacle1");
+  const auto subscription =
+    node->create_subscription<traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray>(
+      "entity/status", EntityMarkerQoS(),
+      [](const traffic_simulator_msgs::msg::EntityStatusWithTrajectoryArray::SharedPtr) {});
+  ASSERT_TRUE(waitForSubscription(*node, "entity/status"));
+  CountingEntity::waypoints_count = 0;
+  CountingEntity::obstacle_count = 0;
+  for (auto frame = 0; frame < 10; ++frame) {
+    entity_manager.update(0.05 * frame, 0.05);
+  }
+  EXPECT_EQ(CountingEntity::waypoints_count, std::size_t(2 * 2));
+  EXPECT_EQ(CountingEntity::obstacle_count, std::size_t(2 * 2));
+}
+
+TEST(ENTITY_MANAGER, TRAJECTORY_CACHED_UNTIL_UPDATE)
+{
+  const auto node = makeNode("test_entity_manager_trajectory_cache");
+  EntityManager entity_manager(node, makeConfiguration());
+  spawn(entity_manager, "obstacle0");
+  entity_manager.update(0, 0.05);
+  CountingEntity::waypoints_count = 0;
+  CountingEntity::obstacle_count = 0;
+  for (auto i = 0; i < 3; ++i) {
+    entity_manager.getWaypoints("obstacle0");
+    entity_manager.getObstacle("obstacle0");
+  }
+  EXPECT_EQ(CountingEntity::waypoints_count, std::size_t(1));
+  EXPECT_EQ(CountingEntity::obstacle_count, std::size_t(1));
+  entity_manager.update(0.05, 0.05);
+  entity_manager.getWaypoints("obstacle0");
+  entity_manager.getObstacle("obstacle0");
+  EXPECT_EQ(CountingEntity::waypoints_count, std::size_t(2));
+  EXPECT_EQ(CountingEntity::obstacle_count, std::size_t(2));
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+  const auto result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
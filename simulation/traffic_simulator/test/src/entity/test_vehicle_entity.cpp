@@ -17,8 +17,8 @@
 #include <scenario_simulator_exception/exception.hpp>
 #include <traffic_simulator/entity/vehicle_entity.hpp>
 #include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/test/catalogs.hpp>
 
-#include "../catalogs.hpp"
 #include "../expect_eq_macros.hpp"
 
 /*
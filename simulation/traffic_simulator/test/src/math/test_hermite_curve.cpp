@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
 #include <traffic_simulator/math/hermite_curve.hpp>
 
 TEST(HermiteCurveTest, CheckCollisionToLine)
@@ -161,6 +163,28 @@ TEST(HermiteCurveTest, CheckNormalVector)
   }
 }
 
+TEST(HermiteCurveTest, MaximumCurvatureUpperBound)
+{
+  for (double goal_y = -5.0; goal_y <= 5.0; goal_y = goal_y + 0.5) {
+    for (double goal_yaw = -1.0; goal_yaw <= 1.0; goal_yaw = goal_yaw + 0.25) {
+      geometry_msgs::msg::Pose start_pose, goal_pose;
+      geometry_msgs::msg::Vector3 start_vec, goal_vec;
+      goal_pose.position.x = 10;
+      goal_pose.position.y = goal_y;
+      start_vec.x = 5;
+      goal_vec.x = 5 * std::cos(goal_yaw);
+      goal_vec.y = 5 * std::sin(goal_yaw);
+      traffic_simulator::math::HermiteCurve curve(start_pose, goal_pose, start_vec, goal_vec);
+      double max_curvature = 0;
+      for (double s = 0; s <= 1; s = s + 0.001) {
+        max_curvature = std::max(max_curvature, std::fabs(curve.get2DCurvature(s)));
+      }
+      EXPECT_GE(curve.getMaximum2DCurvatureUpperBound(), max_curvature);
+      EXPECT_GE(curve.getMaximum2DCurvatureUpperBound(), std::fabs(curve.getMaximum2DCurvature()));
+    }
+  }
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -14,6 +14,8 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
 #include <scenario_simulator_exception/exception.hpp>
 #include <traffic_simulator/math/hermite_curve.hpp>
 #include <traffic_simulator/math/polynomial_solver.hpp>
@@ -100,6 +102,67 @@ TEST(PolynomialSolverTest, SolveCubicEquation)
   }
 }
 
+TEST(PolynomialSolverTest, PolynomialRoots)
+{
+  traffic_simulator::math::PolynomialRoots roots;
+  EXPECT_TRUE(roots.empty());
+  roots.push_back(0.1);
+  roots.push_back(0.2);
+  roots.push_back(0.3);
+  EXPECT_THROW(roots.push_back(0.4), common::SimulationError);
+  EXPECT_EQ(roots.size(), traffic_simulator::math::PolynomialRoots::capacity);
+  EXPECT_DOUBLE_EQ(roots[0], 0.1);
+  EXPECT_DOUBLE_EQ(roots[2], 0.3);
+  EXPECT_EQ(std::distance(roots.begin(), roots.end()), 3);
+}
+
+TEST(PolynomialSolverTest, SolveQuadraticEquationWithoutCancellation)
+{
+  traffic_simulator::math::PolynomialSolver solver;
+  /**
+   * @brief roots are 1e-9 and 1e+9, the small root is lost by the cancellation of -b + sqrt(b^2 - 4ac)
+   */
+  const auto ret = solver.solveQuadraticEquation(1, -(1e9 + 1e-9), 1, 0, 1);
+  ASSERT_EQ(ret.size(), static_cast<std::size_t>(1));
+  EXPECT_TRUE(checkValueWithTolerance(ret[0], 1e-9, 1e-20));
+}
+
+TEST(PolynomialSolverTest, SolveCubicEquationWithDoubleRoot)
+{
+  traffic_simulator::math::PolynomialSolver solver;
+  for (double root = 0.0; root <= 1.0; root = root + 0.01) {
+    for (double other_root = -2.0; other_root <= 2.0; other_root = other_root + 0.1) {
+      /**
+       * @brief (t - root)^2 (t - other_root) = 0
+       */
+      const double a = 1;
+      const double b = -(2 * root + other_root);
+      const double c = root * root + 2 * root * other_root;
+      const double d = -root * root * other_root;
+      const auto ret = solver.solveCubicEquation(a, b, c, d, 0, 1);
+      EXPECT_FALSE(ret.empty());
+      EXPECT_TRUE(std::any_of(ret.begin(), ret.end(), [&](const auto solution) {
+        return checkValueWithTolerance(solution, root, 1e-6);
+      }));
+      for (const auto & solution : ret) {
+        EXPECT_TRUE(0 <= solution && solution <= 1);
+        EXPECT_TRUE(checkValueWithTolerance(solver.cubicFunction(a, b, c, d, solution), 0.0, 1e-10));
+      }
+    }
+  }
+}
+
+TEST(PolynomialSolverTest, SolveCubicEquationAtBoundary)
+{
+  traffic_simulator::math::PolynomialSolver solver;
+  /**
+   * @brief (t - 1)(t - 2)(t - 3) = 0, the root on the boundary should not be rejected
+   */
+  const auto ret = solver.solveCubicEquation(1, -6, 11, -6, 0, 1);
+  ASSERT_EQ(ret.size(), static_cast<std::size_t>(1));
+  EXPECT_DOUBLE_EQ(ret[0], 1.0);
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,200 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <fstream>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <traffic_simulator/entity/entity_manager.hpp>
+#include <traffic_simulator/metrics/metrics_manager.hpp>
+#include <traffic_simulator/test/fixture.hpp>
+#include <vector>
+
+/**
+ * @brief a metric that activates at activation_time, and succeeds or fails after the given number
+ * of updates (never if 0).
+ */
+class FrameMetric : public metrics::MetricBase
+{
+public:
+  explicit FrameMetric(
+    double activation_time, std::size_t success_updates = 0, std::size_t failure_updates = 0)
+  : MetricBase("FrameMetric"),
+    activation_time(activation_time),
+    success_updates(success_updates),
+    failure_updates(failure_updates)
+  {
+  }
+
+  bool activateTrigger() override
+  {
+    return activation_time <= entity_manager_ptr_->getCurrentTime();
+  }
+
+  void update() override
+  {
+    ++updates;
+    if (updates == success_updates) {
+      success();
+    } else if (updates == failure_updates) {
+      failure(SPECIFICATION_VIOLATION("failed after ", updates, " updates"));
+    }
+  }
+
+  nlohmann::json toJson() override
+  {
+    auto json = toBaseJson();
+    json["updates"] = updates;
+    return json;
+  }
+
+  const double activation_time;
+
+  const std::size_t success_updates;
+
+  const std::size_t failure_updates;
+
+  std::size_t updates = 0;
+};
+
+/**
+ * @brief a metric that is active from the start and whose JSON never changes.
+ */
+class StaticMetric : public metrics::MetricBase
+{
+public:
+  StaticMetric() : MetricBase("StaticMetric") {}
+
+  bool activateTrigger() override { return true; }
+
+  void update() override {}
+
+  nlohmann::json toJson() override { return toBaseJson(); }
+};
+
+auto makeEntityManager()
+{
+  return std::make_shared<traffic_simulator::entity::EntityManager>(
+    makeNode("test_metrics_manager"), makeConfiguration());
+}
+
+auto readLines(const boost::filesystem::path & path)
+{
+  std::vector<nlohmann::json> lines;
+  std::ifstream file(path.string());
+  for (std::string line; std::getline(file, line);) {
+    lines.push_back(nlohmann::json::parse(line));
+  }
+  return lines;
+}
+
+class MetricsManagerTest : public testing::Test
+{
+protected:
+  const boost::filesystem::path path =
+    boost::filesystem::temp_directory_path() /
+    boost::filesystem::unique_path("test_metrics_manager-%%%%-%%%%.jsonl");
+
+  const std::shared_ptr<traffic_simulator::entity::EntityManager> entity_manager =
+    makeEntityManager();
+
+  void TearDown() override { boost::filesystem::remove(path); }
+
+  auto step(metrics::MetricsManager & metrics_manager, std::size_t frame)
+  {
+    entity_manager->update(0.1 * frame, 0.1);
+    metrics_manager.calculate();
+  }
+};
+
+TEST_F(MetricsManagerTest, OneLinePerChangedFrame)
+{
+  std::vector<nlohmann::json> history;
+  {
+    metrics::MetricsManager metrics_manager(path, false, 4);
+    metrics_manager.setEntityManager(entity_manager);
+    metrics_manager.addMetric<FrameMetric>("early", 0.0, 3);
+    metrics_manager.addMetric<FrameMetric>("late", 0.45);
+    for (std::size_t frame = 0; frame < 10; ++frame) {
+      step(metrics_manager, frame);
+    }
+    history.assign(metrics_manager.getHistory().begin(), metrics_manager.getHistory().end());
+  }  // NOTE: Every line is written on destruction.
+
+  const auto lines = readLines(path);
+  ASSERT_EQ(lines.size(), std::size_t(8));
+
+  // NOTE: Frames 3 and 4 are skipped, since no metric changed in them.
+  const std::vector<std::size_t> frames{0, 1, 2, 5, 6, 7, 8, 9};
+  for (std::size_t i = 0; i < lines.size(); ++i) {
+    EXPECT_DOUBLE_EQ(lines[i]["time"].get<double>(), 0.1 * frames[i]);
+  }
+
+  EXPECT_EQ(lines[0]["metrics"]["early"]["lifecycle"], "active");
+  EXPECT_EQ(lines[0]["metrics"]["late"]["lifecycle"], "inactive");
+  EXPECT_EQ(lines[1]["metrics"].size(), std::size_t(1));
+  EXPECT_EQ(lines[1]["metrics"]["early"]["updates"], 2);
+  EXPECT_EQ(lines[2]["metrics"]["early"]["lifecycle"], "success");
+  for (std::size_t i = 3; i < lines.size(); ++i) {
+    EXPECT_EQ(lines[i]["metrics"].size(), std::size_t(1));
+    EXPECT_EQ(lines[i]["metrics"]["late"]["lifecycle"], "active");
+    EXPECT_EQ(lines[i]["metrics"]["late"]["updates"], i - 2);
+  }
+
+  EXPECT_EQ(history, std::vector<nlohmann::json>(lines.end() - 4, lines.end()));
+}
+
+TEST_F(MetricsManagerTest, UnchangedActiveMetricNotWritten)
+{
+  {
+    metrics::MetricsManager metrics_manager(path);
+    metrics_manager.setEntityManager(entity_manager);
+    metrics_manager.addMetric<StaticMetric>("static");
+    for (std::size_t frame = 0; frame < 5; ++frame) {
+      step(metrics_manager, frame);
+    }
+  }
+
+  const auto lines = readLines(path);
+  ASSERT_EQ(lines.size(), std::size_t(1));
+  EXPECT_DOUBLE_EQ(lines[0]["time"].get<double>(), 0.0);
+  EXPECT_EQ(lines[0]["metrics"]["static"]["lifecycle"], "active");
+}
+
+TEST_F(MetricsManagerTest, FailingFrameWrittenBeforeThrow)
+{
+  {
+    metrics::MetricsManager metrics_manager(path);
+    metrics_manager.setEntityManager(entity_manager);
+    metrics_manager.addMetric<FrameMetric>("failing", 0.0, 0, 2);
+    step(metrics_manager, 0);
+    EXPECT_THROW(step(metrics_manager, 1), common::SpecificationViolation);
+  }
+
+  const auto lines = readLines(path);
+  ASSERT_EQ(lines.size(), std::size_t(2));
+  EXPECT_EQ(lines[1]["metrics"]["failing"]["lifecycle"], "failure");
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+  const auto result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
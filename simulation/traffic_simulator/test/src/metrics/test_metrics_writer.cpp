@@ -0,0 +1,143 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+#include <fcntl.h>
+#include <gtest/gtest.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <boost/filesystem.hpp>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <future>
+#include <memory>
+#include <string>
+#include <traffic_simulator/metrics/metrics_writer.hpp>
+#include <vector>
+
+auto makeTemporaryPath(const std::string & name)
+{
+  return boost::filesystem::temp_directory_path() /
+         boost::filesystem::unique_path(name + "-%%%%-%%%%");
+}
+
+auto readLines(const boost::filesystem::path & path)
+{
+  std::vector<std::string> lines;
+  std::ifstream file(path.string());
+  for (std::string line; std::getline(file, line);) {
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+auto makeLines(std::size_t size, std::size_t length = 0)
+{
+  std::vector<std::string> lines;
+  for (std::size_t i = 0; i < size; ++i) {
+    auto line = std::to_string(i);
+    line.resize(std::max(length, line.size()), '.');
+    lines.push_back(line);
+  }
+  return lines;
+}
+
+TEST(MetricsWriter, LinesInOrderOfWrite)
+{
+  const auto path = makeTemporaryPath("test_metrics_writer");
+  const auto lines = makeLines(10000);
+  {
+    metrics::MetricsWriter writer(path, 16);
+    for (const auto & line : lines) {
+      writer.write(line);
+    }
+  }
+  EXPECT_EQ(readLines(path), lines);
+  boost::filesystem::remove(path);
+}
+
+TEST(MetricsWriter, AllLinesWrittenOnDestruction)
+{
+  const auto path = makeTemporaryPath("test_metrics_writer");
+  const auto lines = makeLines(1024, 1024);
+  {
+    metrics::MetricsWriter writer(path);
+    for (const auto & line : lines) {
+      writer.write(line);
+    }
+    // NOTE: Destroyed with lines still pending.
+  }
+  EXPECT_EQ(readLines(path), lines);
+  boost::filesystem::remove(path);
+}
+
+TEST(MetricsWriter, EmptyFileWithoutLines)
+{
+  const auto path = makeTemporaryPath("test_metrics_writer");
+  { metrics::MetricsWriter writer(path); }
+  EXPECT_TRUE(boost::filesystem::exists(path));
+  EXPECT_TRUE(readLines(path).empty());
+  boost::filesystem::remove(path);
+}
+
+/**
+ * @brief write() blocks while the pipe and the queue are full, and returns once the reader catches
+ * up, without losing any line.
+ */
+TEST(MetricsWriter, WriteBlocksWhileQueueFull)
+{
+  const auto path = makeTemporaryPath("test_metrics_writer");
+  ASSERT_EQ(::mkfifo(path.c_str(), 0600), 0);
+
+  // NOTE: Opened before the writer, so that opening the FIFO to write does not block.
+  const auto reader = ::open(path.c_str(), O_RDONLY | O_NONBLOCK);
+  ASSERT_NE(reader, -1);
+
+  const auto lines = makeLines(64, 64 * 1024);
+  auto writer = std::make_unique<metrics::MetricsWriter>(path, 2);
+  auto written = std::async(std::launch::async, [&]() {
+    for (const auto & line : lines) {
+      writer->write(line);
+    }
+  });
+
+  EXPECT_EQ(written.wait_for(std::chrono::milliseconds(500)), std::future_status::timeout);
+
+  ::fcntl(reader, F_SETFL, ::fcntl(reader, F_GETFL) & ~O_NONBLOCK);
+  auto read = std::async(std::launch::async, [&]() {
+    std::string data;
+    char buffer[4096];
+    for (ssize_t size; 0 < (size = ::read(reader, buffer, sizeof(buffer)));) {
+      data.append(buffer, size);
+    }
+    return data;
+  });
+
+  ASSERT_EQ(written.wait_for(std::chrono::seconds(10)), std::future_status::ready);
+  writer.reset();  // NOTE: Closes the FIFO, so that the reader sees the end of it.
+
+  std::string expected;
+  for (const auto & line : lines) {
+    expected += line + '\n';
+  }
+  EXPECT_EQ(read.get(), expected);
+  ::close(reader);
+  boost::filesystem::remove(path);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
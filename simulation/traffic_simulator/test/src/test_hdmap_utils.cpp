@@ -14,10 +14,15 @@
 
 #include <gtest/gtest.h>
 
+#include <quaternion_operation/quaternion_operation.h>
+
 #include <ament_index_cpp/get_package_share_directory.hpp>
+#include <algorithm>
 #include <string>
 #include <traffic_simulator/hdmap_utils/hdmap_utils.hpp>
 #include <traffic_simulator/helper/helper.hpp>
+#include <traffic_simulator/math/transform.hpp>
+#include <vector>
 
 TEST(HdMapUtils, Construct)
 {
@@ -98,6 +103,92 @@ TEST(HdMapUtils, AlongLaneletPose)
     hdmap_utils.getLaneletLength(34684) - 10.0);
 }
 
+/**
+ * @brief reference implementation of the lane change trajectory search which checks every candidate.
+ */
+boost::optional<std::pair<traffic_simulator::math::HermiteCurve, double>>
+getLaneChangeTrajectoryByLinearSearch(
+  hdmap_utils::HdMapUtils & hdmap_utils, const geometry_msgs::msg::Pose & from_pose,
+  std::int64_t to_lanelet_id, double maximum_curvature_threshold, double target_trajectory_length,
+  double forward_distance_threshold)
+{
+  std::vector<double> evaluation, target_s;
+  std::vector<traffic_simulator::math::HermiteCurve> curves;
+  for (double to_s = 0; to_s < hdmap_utils.getLaneletLength(to_lanelet_id); to_s = to_s + 1.0) {
+    const auto goal_pose = hdmap_utils.toMapPose(to_lanelet_id, to_s, 0).pose;
+    if (
+      traffic_simulator::math::getRelativePose(from_pose, goal_pose).position.x <=
+      forward_distance_threshold) {
+      continue;
+    }
+    const double tangent_vector_size =
+      std::hypot(
+        from_pose.position.x - goal_pose.position.x, from_pose.position.y - goal_pose.position.y,
+        from_pose.position.z - goal_pose.position.z) *
+      0.5;
+    const double yaw =
+      quaternion_operation::convertQuaternionToEulerAngle(from_pose.orientation).z;
+    geometry_msgs::msg::Vector3 start_vec;
+    start_vec.x = tangent_vector_size * std::cos(yaw);
+    start_vec.y = tangent_vector_size * std::sin(yaw);
+    auto goal_vec = hdmap_utils.getTangentVector(to_lanelet_id, to_s).get();
+    goal_vec.x = goal_vec.x * tangent_vector_size;
+    goal_vec.y = goal_vec.y * tangent_vector_size;
+    goal_vec.z = goal_vec.z * tangent_vector_size;
+    traffic_simulator::math::HermiteCurve curve(from_pose, goal_pose, start_vec, goal_vec);
+    if (curve.getMaximum2DCurvature() < maximum_curvature_threshold) {
+      evaluation.push_back(std::fabs(target_trajectory_length - curve.getLength()));
+      curves.push_back(curve);
+      target_s.push_back(to_s);
+    }
+  }
+  if (evaluation.empty()) {
+    return boost::none;
+  }
+  const auto min_index =
+    std::distance(evaluation.begin(), std::min_element(evaluation.begin(), evaluation.end()));
+  return std::make_pair(curves[min_index], target_s[min_index]);
+}
+
+/**
+ * @brief Strict curvature thresholds leave narrow and separated feasible ranges of the goal along
+ * the target lanelet. The result must still be the same as checking every candidate.
+ */
+TEST(HdMapUtils, LaneChangeTrajectory)
+{
+  std::string path =
+    ament_index_cpp::get_package_share_directory("traffic_simulator") + "/map/lanelet2_map.osm";
+  geographic_msgs::msg::GeoPoint origin;
+  origin.latitude = 35.61836750154;
+  origin.longitude = 139.78066608243;
+  hdmap_utils::HdMapUtils hdmap_utils(path, origin);
+  for (const auto & [from_lanelet_id, to_lanelet_id] :
+       {std::make_pair(34462, 34513), std::make_pair(34513, 34462)}) {
+    const traffic_simulator::lane_change::Parameter parameter(
+      traffic_simulator::lane_change::AbsoluteTarget(to_lanelet_id),
+      traffic_simulator::lane_change::TrajectoryShape::CUBIC,
+      traffic_simulator::lane_change::Constraint());
+    for (double from_s = 0; from_s < hdmap_utils.getLaneletLength(from_lanelet_id);
+         from_s = from_s + 5.0) {
+      const auto from_pose = hdmap_utils.toMapPose(from_lanelet_id, from_s, 0).pose;
+      for (const auto maximum_curvature_threshold : {0.02, 0.05, 0.1, 10.0}) {
+        for (const auto target_trajectory_length : {10.0, 20.0, 40.0}) {
+          const auto expected = getLaneChangeTrajectoryByLinearSearch(
+            hdmap_utils, from_pose, to_lanelet_id, maximum_curvature_threshold,
+            target_trajectory_length, 1.0);
+          const auto actual = hdmap_utils.getLaneChangeTrajectory(
+            from_pose, parameter, maximum_curvature_threshold, target_trajectory_length, 1.0);
+          ASSERT_EQ(static_cast<bool>(expected), static_cast<bool>(actual));
+          if (expected && actual) {
+            EXPECT_DOUBLE_EQ(actual->second, expected->second);
+            EXPECT_DOUBLE_EQ(actual->first.getLength(), expected->first.getLength());
+          }
+        }
+      }
+    }
+  }
+}
+
 int main(int argc, char ** argv)
 {
   testing::InitGoogleTest(&argc, argv);
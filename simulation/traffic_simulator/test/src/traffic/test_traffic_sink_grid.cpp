@@ -0,0 +1,102 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <string>
+#include <traffic_simulator/traffic/traffic_sink_grid.hpp>
+#include <vector>
+
+geometry_msgs::msg::Point makePoint(double x, double y)
+{
+  geometry_msgs::msg::Point point;
+  point.x = x;
+  point.y = y;
+  return point;
+}
+
+struct World
+{
+  std::map<std::string, geometry_msgs::msg::Pose> poses;
+
+  std::vector<std::string> despawned;
+
+  void add(const std::string & name, double x, double y)
+  {
+    poses[name].position = makePoint(x, y);
+  }
+
+  auto makeSinkGrid(double cell_size) -> traffic_simulator::traffic::TrafficSinkGrid
+  {
+    return traffic_simulator::traffic::TrafficSinkGrid(
+      cell_size,
+      [this]() {
+        std::vector<std::string> names;
+        for (const auto & pose : poses) {
+          names.push_back(pose.first);
+        }
+        return names;
+      },
+      [this](const std::string & name) { return poses.at(name); },
+      [this](const std::string & name) {
+        despawned.push_back(name);
+        poses.erase(name);
+      });
+  }
+};
+
+TEST(TrafficSinkGrid, DespawnOnlyEntitiesInSinks)
+{
+  World world;
+  world.add("near", 100.5, 0);
+  world.add("far", 103, 0);
+  world.add("other", -50, -50.5);
+  auto sinks = world.makeSinkGrid(10);
+  sinks.addSink(1, makePoint(100, 0));
+  sinks.addSink(1, makePoint(-50, -50));
+  EXPECT_EQ(sinks.getSinkCount(), 2U);
+  sinks.execute();
+  EXPECT_EQ(world.despawned, (std::vector<std::string>{"near", "other"}));
+}
+
+TEST(TrafficSinkGrid, SinkOverlappingCells)
+{
+  World world;
+  world.add("a", 9.5, 0);
+  world.add("b", 10.5, 0);
+  world.add("c", 0, 19.5);
+  auto sinks = world.makeSinkGrid(1);
+  sinks.addSink(1, makePoint(10, 0));
+  sinks.addSink(5, makePoint(0, 15));
+  sinks.execute();
+  EXPECT_EQ(world.despawned, (std::vector<std::string>{"a", "b", "c"}));
+}
+
+TEST(TrafficSinkGrid, DespawnOnceInOverlappingSinks)
+{
+  World world;
+  world.add("a", 0, 0);
+  auto sinks = world.makeSinkGrid(10);
+  sinks.addSink(1, makePoint(0.5, 0));
+  sinks.addSink(1, makePoint(-0.5, 0));
+  sinks.execute();
+  EXPECT_EQ(world.despawned, (std::vector<std::string>{"a"}));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
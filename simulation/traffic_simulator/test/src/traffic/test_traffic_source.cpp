@@ -0,0 +1,150 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <scenario_simulator_exception/exception.hpp>
+#include <string>
+#include <traffic_simulator/traffic/traffic_source.hpp>
+#include <vector>
+
+/**
+ * @brief entities spawned at x = 0, moving along the x axis at their spawn speed in 0.1 s steps.
+ */
+struct World
+{
+  double current_time = 0;
+
+  std::map<std::string, double> speeds;
+
+  std::map<std::string, geometry_msgs::msg::Pose> poses;
+
+  std::vector<std::string> spawned;
+
+  void step()
+  {
+    current_time += 0.1;
+    for (auto & pose : poses) {
+      pose.second.position.x += speeds[pose.first] * 0.1;
+    }
+  }
+
+  auto makeSource(const traffic_simulator::traffic::TrafficSource::Parameters & parameters)
+    -> traffic_simulator::traffic::TrafficSource
+  {
+    return traffic_simulator::traffic::TrafficSource(
+      "source", traffic_simulator_msgs::msg::LaneletPose(), geometry_msgs::msg::Point(),
+      parameters,
+      [this]() {
+        std::vector<std::string> names;
+        for (const auto & pose : poses) {
+          names.push_back(pose.first);
+        }
+        return names;
+      },
+      [this](const std::string & name) { return poses.at(name); },
+      [this](const std::string & name, const auto &, double speed) {
+        poses[name] = geometry_msgs::msg::Pose();
+        speeds[name] = speed;
+        spawned.push_back(name);
+        return true;
+      },
+      [this]() { return current_time; });
+  }
+};
+
+auto makeParameters() -> traffic_simulator::traffic::TrafficSource::Parameters
+{
+  traffic_simulator::traffic::TrafficSource::Parameters parameters;
+  parameters.flow_rate = 1;
+  parameters.speed = 10;
+  parameters.minimum_headway = 0.5;
+  parameters.minimum_gap = 1;
+  parameters.maximum_density = 1;
+  parameters.density_range = 1000;
+  return parameters;
+}
+
+TEST(TrafficSource, SpawnAtFlowRate)
+{
+  World world;
+  auto source = world.makeSource(makeParameters());
+  for (int i = 0; i < 100; ++i) {
+    source.execute();
+    world.step();
+  }
+  EXPECT_EQ(source.getSpawnCount(), 10U);
+  EXPECT_EQ(world.spawned.front(), "source_0");
+  EXPECT_EQ(world.spawned.back(), "source_9");
+}
+
+TEST(TrafficSource, KeepHeadway)
+{
+  World world;
+  auto parameters = makeParameters();
+  parameters.flow_rate = 10;
+  parameters.minimum_headway = 2;  // NOTE: 20 meters at 10 m/s.
+  auto source = world.makeSource(parameters);
+  for (int i = 0; i < 100; ++i) {
+    source.execute();
+    world.step();
+  }
+  EXPECT_EQ(source.getSpawnCount(), 5U);
+}
+
+TEST(TrafficSource, KeepDensity)
+{
+  World world;
+  auto parameters = makeParameters();
+  parameters.flow_rate = 10;
+  parameters.maximum_density = 0.003;  // NOTE: Fewer than 3 entities within 1000 meters.
+  auto source = world.makeSource(parameters);
+  for (int i = 0; i < 100; ++i) {
+    source.execute();
+    world.step();
+  }
+  EXPECT_EQ(source.getSpawnCount(), 3U);
+}
+
+TEST(TrafficSource, ReuseNamesOfDespawnedEntities)
+{
+  World world;
+  auto source = world.makeSource(makeParameters());
+  for (int i = 0; i < 100; ++i) {
+    source.execute();
+    world.step();
+    if (world.poses.size() == 2) {
+      world.poses.erase(world.poses.begin());
+    }
+  }
+  EXPECT_EQ(source.getSpawnCount(), 10U);
+  for (const auto & name : world.spawned) {
+    EXPECT_TRUE(name == "source_0" or name == "source_1");
+  }
+}
+
+TEST(TrafficSource, RejectNonPositiveFlowRate)
+{
+  World world;
+  auto parameters = makeParameters();
+  parameters.flow_rate = 0;
+  EXPECT_THROW(world.makeSource(parameters), common::SemanticError);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -59,6 +59,9 @@ struct TestControlParameters
   SimulatorType simulator_type = SimulatorType::SIMPLE_SENSOR_SIMULATOR;
   ArchitectureType architecture_type = ArchitectureType::AWF_UNIVERSE;
   std::string simulator_host = "localhost";
+  int64_t worker_count = 1;
+  int64_t worker_index = -1;
+  int64_t simulator_port_offset = 0;
 };
 
 struct TestSuiteParameters
@@ -128,8 +131,9 @@ DEFINE_FMT_FORMATTER(
   v.name, v.lanelet_pose, v.pose, v.action_status, v.time, v.lanelet_pose_valid, v.type)
 
 DEFINE_FMT_FORMATTER(
-  TestControlParameters, "input dir: {} output dir: {} random test type: {} test count {}",
-  v.input_dir, v.output_dir, v.random_test_type, v.test_count)
+  TestControlParameters,
+  "input dir: {} output dir: {} random test type: {} test count {} worker count {} worker index {}",
+  v.input_dir, v.output_dir, v.random_test_type, v.test_count, v.worker_count, v.worker_index)
 
 DEFINE_FMT_FORMATTER(
   TestSuiteParameters,
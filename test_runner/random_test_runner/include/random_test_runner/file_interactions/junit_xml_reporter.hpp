@@ -19,7 +19,9 @@
 
 #include <spdlog/fmt/fmt.h>
 
+#include <algorithm>
 #include <boost/filesystem.hpp>
+#include <pugixml.hpp>
 #include <rclcpp/logger.hpp>
 #include <rclcpp/rclcpp.hpp>
 
@@ -40,6 +42,13 @@ public:
 
   void reportTimeout() { reportError("timeout", "Ego failed to reach goal within timeout"); }
 
+  void reportInitializationTimeout()
+  {
+    reportError("initialization timeout", "Autoware failed to become ready within timeout");
+  }
+
+  void reportLost(const std::string & message) { reportError("lost", message); }
+
 private:
   void reportError(const std::string & error_type, const std::string & message)
   {
@@ -63,6 +72,38 @@ public:
     return JunitXmlReporterTestCase(results_.testsuite(testsuite_name).testcase(testcase_name));
   }
 
+  bool hasTestCase(const std::string & testsuite_name, const std::string & testcase_name)
+  {
+    const auto names = results_.testsuite(testsuite_name).getTestcaseNames();
+    return std::find(names.begin(), names.end(), testcase_name) != names.end();
+  }
+
+  // Adds the test cases of a result.junit.xml written by another runner (e.g. a worker)
+  void merge(const boost::filesystem::path & result_path)
+  {
+    pugi::xml_document document;
+    if (!document.load_file(result_path.c_str())) {
+      RCLCPP_WARN_STREAM(
+        logger_, fmt::format("Failed to read results from {}", result_path.string()));
+      return;
+    }
+
+    for (const auto & testsuite : document.child("testsuites").children("testsuite")) {
+      for (const auto & testcase : testsuite.children("testcase")) {
+        auto & merged = results_.testsuite(testsuite.attribute("name").value())
+                          .testcase(testcase.attribute("name").value());
+        for (const auto & error : testcase.children("error")) {
+          merged.error.emplace_back(
+            error.attribute("type").value(), error.attribute("message").value());
+        }
+        for (const auto & failure : testcase.children("failure")) {
+          merged.failure.emplace_back(
+            failure.attribute("type").value(), failure.attribute("message").value());
+        }
+      }
+    }
+  }
+
   void write()
   {
     std::string message = fmt::format("Saving results to {}", output_directory_);
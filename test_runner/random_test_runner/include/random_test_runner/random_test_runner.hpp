@@ -17,9 +17,16 @@
 #ifndef RANDOM_TEST_RUNNER__RANDOM_TEST_RUNNER_HPP
 #define RANDOM_TEST_RUNNER__RANDOM_TEST_RUNNER_HPP
 
+#include <sys/types.h>
+
+#include <atomic>
+#include <boost/filesystem.hpp>
 #include <memory>
 #include <random>
 #include <rclcpp/rclcpp.hpp>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "random_test_runner/data_types.hpp"
 #include "random_test_runner/file_interactions/junit_xml_reporter.hpp"
@@ -35,6 +42,7 @@ class RandomTestRunner : public rclcpp::Node
 {
 public:
   explicit RandomTestRunner(const rclcpp::NodeOptions & option);
+  ~RandomTestRunner() override;
 
 private:
   TestControlParameters collectAndValidateTestControlParameters();
@@ -47,16 +55,34 @@ private:
   void update();
   void start();
   void stop();
+  bool startNextTest();
+  bool claimTest(size_t test_id) const;
+
+  void superviseWorkers(const TestControlParameters & test_control_parameters);
+  pid_t spawnWorker(
+    const TestControlParameters & test_control_parameters, int64_t worker_index) const;
+  pid_t spawnSimulator(int64_t worker_index) const;
+  void writeWorkerParameters(
+    const boost::filesystem::path & path, const TestControlParameters & test_control_parameters,
+    int64_t worker_index) const;
 
   std::random_device seed_randomization_device_;
 
-  std::vector<TestExecutor> test_executors_;
-  std::vector<TestExecutor>::iterator current_test_executor_;
+  TestControlParameters test_control_parameters_;
+  std::string test_suite_name_;
+
+  std::vector<TestDescription> test_descriptions_;
+  size_t next_test_id_ = 0;
+  std::unique_ptr<TestExecutor> current_test_executor_;
 
   JunitXmlReporter error_reporter_;
 
   std::shared_ptr<traffic_simulator::API> api_;
 
   rclcpp::TimerBase::SharedPtr update_timer_;
+
+  std::vector<pid_t> worker_pids_;
+  std::atomic<bool> workers_running_{false};
+  std::thread supervisor_;
 };
 #endif  // RANDOM_TEST_RUNNER__RANDOM_TEST_RUNNER_HPP
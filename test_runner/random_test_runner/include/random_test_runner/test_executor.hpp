@@ -17,6 +17,7 @@
 #ifndef RANDOM_TEST_RUNNER__TEST_EXECUTOR_HPP
 #define RANDOM_TEST_RUNNER__TEST_EXECUTOR_HPP
 
+#include <boost/optional.hpp>
 #include <memory>
 #include <rclcpp/logger.hpp>
 
@@ -41,6 +42,10 @@ public:
   bool scenarioCompleted();
 
 private:
+  // Whether the test can start, i.e. the ego (if any) is ready. NPCs are spawned only then.
+  bool ready();
+  void spawnNPCs();
+
   std::shared_ptr<traffic_simulator::API> api_;
   TestDescription test_description_;
   const std::string ego_name_ = "ego";
@@ -54,6 +59,7 @@ private:
   ArchitectureType architecture_type_;
 
   bool scenario_completed_ = false;
+  boost::optional<double> ready_time_;
 
   rclcpp::Logger logger_;
 };
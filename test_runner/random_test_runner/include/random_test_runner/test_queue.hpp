@@ -0,0 +1,42 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Co-developed by Tier IV, Inc. and Robotec.AI sp. z o.o.
+
+#ifndef RANDOM_TEST_RUNNER__TEST_QUEUE_HPP
+#define RANDOM_TEST_RUNNER__TEST_QUEUE_HPP
+
+#include <boost/filesystem.hpp>
+#include <boost/optional.hpp>
+#include <cstdint>
+
+// Workers share the test cases through a queue directory: a test is run by the worker that
+// manages to create its claim file first, and the claim file holds the index of that worker
+class TestQueue
+{
+public:
+  explicit TestQueue(boost::filesystem::path directory);
+
+  // Removes the claims left by a previous run, which would block every test
+  void reset() const;
+
+  bool claim(size_t test_id, int64_t worker_index) const;
+
+  boost::optional<int64_t> claimant(size_t test_id) const;
+
+private:
+  boost::filesystem::path directory_;
+};
+
+#endif  // RANDOM_TEST_RUNNER__TEST_QUEUE_HPP
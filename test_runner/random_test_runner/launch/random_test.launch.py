@@ -89,6 +89,10 @@ class RandomTestRunnerLaunch(object):
 
             # control arguments #
             "test_count": {"default": 5, "description": "Test count to be performed in test suite"},
+            "worker_count":
+                {"default": 1,
+                 "description": "Number of isolated workers running tests in parallel. Each worker has its own "
+                                "simulator, Autoware and ROS domain"},
             "input_dir":
                 {"default": "",
                  "description": "Directory containing the result.yaml file to be replayed. "
@@ -16,20 +16,90 @@
 
 #include "random_test_runner/random_test_runner.hpp"
 
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <yaml-cpp/yaml.h>
+
+#include <ament_index_cpp/get_package_prefix.hpp>
 #include <ament_index_cpp/get_package_share_directory.hpp>
 #include <boost/optional/optional_io.hpp>
+#include <csignal>
+#include <cstdlib>
+#include <fstream>
 #include <memory>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #include "random_test_runner/file_interactions/yaml_test_params_saver.hpp"
 #include "random_test_runner/lanelet_utils.hpp"
+#include "random_test_runner/test_queue.hpp"
 #include "random_test_runner/test_randomizer.hpp"
 #include "rclcpp/logger.hpp"
 #include "spdlog/fmt/fmt.h"
 #include "traffic_simulator/api/configuration.hpp"
 #include "traffic_simulator_msgs/msg/driver_model.hpp"
 
+extern char ** environ;
+
+namespace
+{
+// Ports used by the simulator of each worker are offset by a multiple of this
+const int64_t port_offset_stride = 100;
+const int64_t max_worker_count = 100;
+// The largest ROS_DOMAIN_ID for which the DDS ports are valid
+const int64_t max_domain_id = 232;
+
+boost::filesystem::path workerDirectory(const std::string & output_dir, int64_t worker_index)
+{
+  return boost::filesystem::path(output_dir) / fmt::format("worker_{}", worker_index);
+}
+
+int64_t baseDomainId()
+{
+  const char * domain_id = std::getenv("ROS_DOMAIN_ID");
+  return domain_id ? std::atoll(domain_id) : 0;
+}
+
+// Each worker runs in its own ROS domain, so that the Autoware of each worker is isolated
+int64_t workerDomainId(int64_t worker_index) { return baseDomainId() + worker_index + 1; }
+
+pid_t spawn(const std::vector<std::string> & arguments, int64_t worker_index)
+{
+  // NOTE: Prepare everything before fork, as only async-signal-safe calls are allowed after it.
+  std::vector<std::string> environment{
+    fmt::format("ROS_DOMAIN_ID={}", workerDomainId(worker_index))};
+  for (char ** variable = environ; *variable; ++variable) {
+    if (std::string(*variable).rfind("ROS_DOMAIN_ID=", 0) != 0) {
+      environment.emplace_back(*variable);
+    }
+  }
+
+  auto pointers = [](const std::vector<std::string> & strings) {
+    std::vector<char *> result;
+    for (const auto & string : strings) {
+      result.push_back(const_cast<char *>(string.c_str()));
+    }
+    result.push_back(nullptr);
+    return result;
+  };
+
+  auto argv = pointers(arguments);
+  auto envp = pointers(environment);
+
+  const pid_t pid = fork();
+  if (pid < 0) {
+    throw std::system_error(errno, std::generic_category(), "fork");
+  } else if (pid == 0) {
+    prctl(PR_SET_PDEATHSIG, SIGINT);
+    execvpe(argv[0], argv.data(), envp.data());
+    _exit(EXIT_FAILURE);
+  }
+  return pid;
+}
+}  // namespace
+
 RandomTestRunner::RandomTestRunner(const rclcpp::NodeOptions & option)
 : Node("random_test_runner", option), error_reporter_(get_logger())
 {
@@ -66,7 +136,7 @@ RandomTestRunner::RandomTestRunner(const rclcpp::NodeOptions & option)
 
   traffic_simulator::Configuration configuration(map_path);
   configuration.simulator_host = test_control_parameters.simulator_host;
-  api_ = std::make_shared<traffic_simulator::API>(this, configuration);
+  configuration.simulator_port_offset = test_control_parameters.simulator_port_offset;
   auto lanelet_utils = std::make_shared<LaneletUtils>(configuration.lanelet2_map_path());
 
   TestSuiteParameters validated_params = validateParameters(test_suite_params, lanelet_utils);
@@ -89,23 +159,39 @@ RandomTestRunner::RandomTestRunner(const rclcpp::NodeOptions & option)
     std::string message =
       fmt::format("Generating test {}/{}", test_id + 1, test_case_parameters_vector.size());
     RCLCPP_INFO_STREAM(get_logger(), message);
-    test_executors_.emplace_back(
-      api_,
+    test_descriptions_.emplace_back(
       TestRandomizer(
         get_logger(), validated_params, test_case_parameters_vector[test_id], lanelet_utils)
-        .generate(),
-      error_reporter_.spawnTestCase(validated_params.name, std::to_string(test_id)),
-      test_control_parameters.simulator_type, test_control_parameters.architecture_type,
-      get_logger());
+        .generate());
     yaml_test_params_saver.addTestCase(test_case_parameters_vector[test_id], validated_params.name);
   }
 
-  current_test_executor_ = test_executors_.begin();
+  test_control_parameters_ = test_control_parameters;
+  test_suite_name_ = validated_params.name;
   yaml_test_params_saver.write();
 
+  if (test_control_parameters.worker_count > 1 && test_control_parameters.worker_index < 0) {
+    superviseWorkers(test_control_parameters);
+    return;
+  }
+
+  api_ = std::make_shared<traffic_simulator::API>(this, configuration);
+
   start();
 }
 
+RandomTestRunner::~RandomTestRunner()
+{
+  if (supervisor_.joinable()) {
+    if (workers_running_) {
+      for (const auto pid : worker_pids_) {
+        kill(pid, SIGINT);
+      }
+    }
+    supervisor_.join();
+  }
+}
+
 TestSuiteParameters RandomTestRunner::collectTestSuiteParameters()
 {
   TestSuiteParameters tp;
@@ -144,6 +230,14 @@ TestControlParameters RandomTestRunner::collectAndValidateTestControlParameters(
   tp.architecture_type =
     architectureTypeFromString(this->declare_parameter<std::string>("architecture_type", ""));
   tp.simulator_host = this->declare_parameter<std::string>("simulator_host", "localhost");
+  tp.worker_count = this->declare_parameter<int64_t>("worker_count", 1);
+  tp.worker_index = this->declare_parameter<int64_t>("worker_index", -1);
+  tp.simulator_port_offset = this->declare_parameter<int64_t>("simulator_port_offset", 0);
+
+  if (tp.worker_count < 1 || tp.worker_count > max_worker_count) {
+    throw std::runtime_error(
+      fmt::format("Worker count {} is not within [1, {}]", tp.worker_count, max_worker_count));
+  }
 
   if (!tp.input_dir.empty() && !boost::filesystem::is_directory(tp.input_dir)) {
     throw std::runtime_error(
@@ -187,27 +281,22 @@ void RandomTestRunner::update()
 {
   if (current_test_executor_->scenarioCompleted()) {
     current_test_executor_->deinitialize();
-    current_test_executor_++;
-    if (current_test_executor_ == test_executors_.end()) {
+    // NOTE: So that the results of the tests run so far survive a crash of this worker.
+    error_reporter_.write();
+    if (!startNextTest()) {
       stop();
       return;
     }
-    std::string message = fmt::format(
-      "Running test {}/{}", std::distance(test_executors_.begin(), current_test_executor_) + 1,
-      test_executors_.size());
-    RCLCPP_INFO_STREAM(get_logger(), message);
-    current_test_executor_->initialize();
   }
   current_test_executor_->update(api_->getCurrentTime());
 }
 
 void RandomTestRunner::start()
 {
-  std::string message = fmt::format(
-    "Running test {}/{}", std::distance(test_executors_.begin(), current_test_executor_) + 1,
-    test_executors_.size());
-  RCLCPP_INFO_STREAM(get_logger(), message);
-  current_test_executor_->initialize();
+  if (!startNextTest()) {
+    stop();
+    return;
+  }
   update_timer_ = this->create_wall_timer(
     std::chrono::milliseconds(50), std::bind(&RandomTestRunner::update, this));
 }
@@ -215,6 +304,179 @@ void RandomTestRunner::start()
 void RandomTestRunner::stop()
 {
   error_reporter_.write();
-  update_timer_->cancel();
+  if (update_timer_) {
+    update_timer_->cancel();
+  }
   rclcpp::shutdown();
 }
+
+bool RandomTestRunner::startNextTest()
+{
+  for (; next_test_id_ < test_descriptions_.size(); next_test_id_++) {
+    if (claimTest(next_test_id_)) {
+      std::string message =
+        fmt::format("Running test {}/{}", next_test_id_ + 1, test_descriptions_.size());
+      RCLCPP_INFO_STREAM(get_logger(), message);
+      current_test_executor_ = std::make_unique<TestExecutor>(
+        api_, test_descriptions_[next_test_id_],
+        error_reporter_.spawnTestCase(test_suite_name_, std::to_string(next_test_id_)),
+        test_control_parameters_.simulator_type, test_control_parameters_.architecture_type,
+        get_logger());
+      current_test_executor_->initialize();
+      next_test_id_++;
+      return true;
+    }
+  }
+  return false;
+}
+
+bool RandomTestRunner::claimTest(size_t test_id) const
+{
+  return test_control_parameters_.worker_index < 0 ||
+         TestQueue(boost::filesystem::path(test_control_parameters_.input_dir) / "queue")
+           .claim(test_id, test_control_parameters_.worker_index);
+}
+
+void RandomTestRunner::superviseWorkers(const TestControlParameters & test_control_parameters)
+{
+  const auto last_domain_id = workerDomainId(test_control_parameters.worker_count - 1);
+  if (baseDomainId() < 0 || last_domain_id > max_domain_id) {
+    throw std::runtime_error(fmt::format(
+      "ROS_DOMAIN_ID {} leaves no room for {} workers, whose domain ids must be within [0, {}]",
+      baseDomainId(), test_control_parameters.worker_count, max_domain_id));
+  }
+
+  const TestQueue queue(boost::filesystem::path(test_control_parameters.output_dir) / "queue");
+  queue.reset();
+
+  std::vector<pid_t> simulator_pids;
+  for (int64_t worker_index = 0; worker_index < test_control_parameters.worker_count;
+       worker_index++) {
+    if (test_control_parameters.simulator_type == SimulatorType::SIMPLE_SENSOR_SIMULATOR) {
+      simulator_pids.push_back(spawnSimulator(worker_index));
+    }
+    worker_pids_.push_back(spawnWorker(test_control_parameters, worker_index));
+  }
+
+  std::string message = fmt::format("Spawned {} workers", worker_pids_.size());
+  RCLCPP_INFO_STREAM(get_logger(), message);
+
+  workers_running_ = true;
+  supervisor_ = std::thread([this, test_control_parameters, simulator_pids, queue]() {
+    std::vector<int> exit_statuses;
+    for (size_t worker_index = 0; worker_index < worker_pids_.size(); worker_index++) {
+      int status = 0;
+      waitpid(worker_pids_[worker_index], &status, 0);
+      exit_statuses.push_back(WIFEXITED(status) ? WEXITSTATUS(status) : -1);
+      std::string message =
+        fmt::format("Worker {} exited with status {}", worker_index, exit_statuses.back());
+      RCLCPP_INFO_STREAM(get_logger(), message);
+    }
+    workers_running_ = false;
+
+    for (const auto pid : simulator_pids) {
+      kill(pid, SIGINT);
+      waitpid(pid, nullptr, 0);
+    }
+
+    for (size_t worker_index = 0; worker_index < worker_pids_.size(); worker_index++) {
+      error_reporter_.merge(
+        workerDirectory(test_control_parameters.output_dir, worker_index) / "result.junit.xml");
+    }
+
+    // NOTE: Workers write the result of each test when it ends, so a test without a result was
+    // being run by a worker which crashed, or left unclaimed because every worker crashed.
+    for (size_t test_id = 0; test_id < test_descriptions_.size(); test_id++) {
+      if (!error_reporter_.hasTestCase(test_suite_name_, std::to_string(test_id))) {
+        std::string message = "No worker claimed this test";
+        if (const auto worker_index = queue.claimant(test_id)) {
+          message = fmt::format(
+            "Worker {} running this test exited with status {}", *worker_index,
+            exit_statuses.at(*worker_index));
+        }
+        RCLCPP_ERROR_STREAM(get_logger(), fmt::format("Test {}: {}", test_id, message));
+        error_reporter_.spawnTestCase(test_suite_name_, std::to_string(test_id))
+          .reportLost(message);
+      }
+    }
+    error_reporter_.write();
+    rclcpp::shutdown();
+  });
+}
+
+pid_t RandomTestRunner::spawnWorker(
+  const TestControlParameters & test_control_parameters, int64_t worker_index) const
+{
+  const auto directory = workerDirectory(test_control_parameters.output_dir, worker_index);
+  boost::filesystem::create_directories(directory);
+
+  const auto parameters_path = directory / "parameters.yaml";
+  writeWorkerParameters(parameters_path, test_control_parameters, worker_index);
+
+  return spawn(
+    {"/proc/self/exe", "--ros-args", "-r", std::string("__ns:=") + get_namespace(), "-r",
+     std::string("__node:=") + get_name(), "--params-file", parameters_path.string()},
+    worker_index);
+}
+
+pid_t RandomTestRunner::spawnSimulator(int64_t worker_index) const
+{
+  return spawn(
+    {ament_index_cpp::get_package_prefix("simple_sensor_simulator") +
+       "/lib/simple_sensor_simulator/simple_sensor_simulator_node",
+     "--ros-args", "-r", std::string("__ns:=") + get_namespace(), "-p",
+     fmt::format("port_offset:={}", (worker_index + 1) * port_offset_stride), "--log-level",
+     "warn"},
+    worker_index);
+}
+
+// Workers get all parameters of this node, and replay the test cases it has written
+void RandomTestRunner::writeWorkerParameters(
+  const boost::filesystem::path & path, const TestControlParameters & test_control_parameters,
+  int64_t worker_index) const
+{
+  YAML::Node parameters;
+  for (const auto & name : list_parameters({}, 0).names) {
+    const auto parameter = get_parameter(name);
+    switch (parameter.get_type()) {
+      case rclcpp::ParameterType::PARAMETER_BOOL:
+        parameters[name] = parameter.as_bool();
+        break;
+      case rclcpp::ParameterType::PARAMETER_INTEGER:
+        parameters[name] = parameter.as_int();
+        break;
+      case rclcpp::ParameterType::PARAMETER_DOUBLE:
+        parameters[name] = parameter.as_double();
+        break;
+      case rclcpp::ParameterType::PARAMETER_STRING:
+        parameters[name] = parameter.as_string();
+        break;
+      case rclcpp::ParameterType::PARAMETER_BOOL_ARRAY:
+        parameters[name] = parameter.as_bool_array();
+        break;
+      case rclcpp::ParameterType::PARAMETER_INTEGER_ARRAY:
+        parameters[name] = parameter.as_integer_array();
+        break;
+      case rclcpp::ParameterType::PARAMETER_DOUBLE_ARRAY:
+        parameters[name] = parameter.as_double_array();
+        break;
+      case rclcpp::ParameterType::PARAMETER_STRING_ARRAY:
+        parameters[name] = parameter.as_string_array();
+        break;
+      default:
+        break;
+    }
+  }
+
+  parameters["input_dir"] = test_control_parameters.output_dir;
+  parameters["output_dir"] =
+    workerDirectory(test_control_parameters.output_dir, worker_index).string();
+  parameters["worker_index"] = worker_index;
+  parameters["simulator_port_offset"] = (worker_index + 1) * port_offset_stride;
+
+  YAML::Node document;
+  document["/**"]["ros__parameters"] = parameters;
+
+  std::ofstream file(path.string());
+  file << document;
+}
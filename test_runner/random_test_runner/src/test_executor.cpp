@@ -22,6 +22,7 @@
 #include "random_test_runner/file_interactions/yaml_test_params_saver.hpp"
 
 const double test_timeout = 60.0;
+const double initialization_timeout = 60.0;
 
 traffic_simulator_msgs::msg::VehicleParameters getVehicleParameters()
 {
@@ -68,6 +69,7 @@ void TestExecutor::initialize()
   std::string message = fmt::format("Test description: {}", test_description_);
   RCLCPP_INFO_STREAM(logger_, message);
   scenario_completed_ = false;
+  ready_time_ = boost::none;
 
   api_->initialize(1.0, 0.05);
   api_->updateFrame();
@@ -88,10 +90,8 @@ void TestExecutor::initialize()
         ego_name_, stringFromArchitectureType(architecture_type_), detection_update_duration));
     }
 
-    // XXX dirty hack: wait for autoware system to launch
-    // ugly but helps for now
-    std::this_thread::sleep_for(std::chrono::milliseconds{5000});
-
+    // NOTE: Autoware is initialized, given the route and engaged by the tasks queued here.
+    // update() steps the simulation but does not start the test until these tasks complete.
     api_->requestAssignRoute(
       ego_name_,
       std::vector<traffic_simulator_msgs::msg::LaneletPose>{test_description_.ego_goal_position});
@@ -99,7 +99,15 @@ void TestExecutor::initialize()
 
     goal_reached_metric_.setGoal(test_description_.ego_goal_pose);
   }
+}
+
+bool TestExecutor::ready()
+{
+  return simulator_type_ != SimulatorType::SIMPLE_SENSOR_SIMULATOR || api_->ready(ego_name_);
+}
 
+void TestExecutor::spawnNPCs()
+{
   for (size_t i = 0; i < test_description_.npcs_descriptions.size(); i++) {
     const auto & npc_descr = test_description_.npcs_descriptions[i];
     api_->spawn(npc_descr.name, getVehicleParameters());
@@ -112,11 +120,32 @@ void TestExecutor::initialize()
 
 void TestExecutor::update(double current_time)
 {
+  if (!ready_time_) {
+    if (ready()) {
+      std::string message = fmt::format("Ready after {}s", current_time);
+      RCLCPP_INFO_STREAM(logger_, message);
+      ready_time_ = current_time;
+      spawnNPCs();
+    } else if (current_time >= initialization_timeout) {
+      RCLCPP_INFO(logger_, "Initialization timeout reached");
+      error_reporter_.reportInitializationTimeout();
+      scenario_completed_ = true;
+      return;
+    } else {
+      // NOTE: Autoware needs the simulation to advance to become ready, but no NPC exists until
+      // then, so nothing but the ego (which waits for the engagement) moves before the test starts.
+      api_->updateFrame();
+      return;
+    }
+  }
+
+  current_time -= ready_time_.value();
+
   bool timeout_reached = current_time >= test_timeout;
 
   if (timeout_reached) {
     if (simulator_type_ == SimulatorType::SIMPLE_SENSOR_SIMULATOR) {
-      traffic_simulator_msgs::msg::EntityStatus status = api_->getEntityStatus(ego_name_);
+      const auto status = *api_->getEntityStatus(ego_name_);
       if (!goal_reached_metric_.isGoalReached(status)) {
         RCLCPP_INFO(logger_, "Timeout reached");
         error_reporter_.reportTimeout();
@@ -127,7 +156,7 @@ void TestExecutor::update(double current_time)
   }
 
   if (simulator_type_ == SimulatorType::SIMPLE_SENSOR_SIMULATOR) {
-    traffic_simulator_msgs::msg::EntityStatus status = api_->getEntityStatus(ego_name_);
+    const auto status = *api_->getEntityStatus(ego_name_);
     for (const auto & npc : test_description_.npcs_descriptions) {
       if (api_->entityExists(npc.name) && api_->checkCollision(ego_name_, npc.name)) {
         if (ego_collision_metric_.isThereEgosCollisionWith(npc.name, current_time)) {
@@ -161,7 +190,9 @@ void TestExecutor::deinitialize()
     api_->despawn(ego_name_);
   }
   for (const auto & npc : test_description_.npcs_descriptions) {
-    api_->despawn(npc.name);
+    if (api_->entityExists(npc.name)) {
+      api_->despawn(npc.name);
+    }
   }
 }
 
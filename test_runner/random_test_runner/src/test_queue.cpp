@@ -0,0 +1,54 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Co-developed by Tier IV, Inc. and Robotec.AI sp. z o.o.
+
+#include "random_test_runner/test_queue.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fstream>
+#include <string>
+#include <utility>
+
+TestQueue::TestQueue(boost::filesystem::path directory) : directory_(std::move(directory)) {}
+
+void TestQueue::reset() const
+{
+  boost::filesystem::remove_all(directory_);
+  boost::filesystem::create_directories(directory_);
+}
+
+bool TestQueue::claim(size_t test_id, int64_t worker_index) const
+{
+  const auto path = directory_ / std::to_string(test_id);
+  const int fd = open(path.c_str(), O_CREAT | O_EXCL | O_WRONLY, 0644);
+  if (fd < 0) {
+    return false;
+  }
+  close(fd);
+  std::ofstream(path.string()) << worker_index;
+  return true;
+}
+
+boost::optional<int64_t> TestQueue::claimant(size_t test_id) const
+{
+  std::ifstream file((directory_ / std::to_string(test_id)).string());
+  int64_t worker_index;
+  if (file >> worker_index) {
+    return worker_index;
+  }
+  return boost::none;
+}
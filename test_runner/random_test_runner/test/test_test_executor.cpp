@@ -0,0 +1,73 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Co-developed by Tier IV, Inc. and Robotec.AI sp. z o.o.
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <rclcpp/rclcpp.hpp>
+#include <simple_junit/junit5.hpp>
+#include <traffic_simulator/api/api.hpp>
+#include <traffic_simulator/test/fixture.hpp>
+
+#include "random_test_runner/test_executor.hpp"
+
+/**
+ * NPCs are spawned when the test starts, not while waiting for the ego to become ready, so that
+ * they do not drive off from their start positions before the test.
+ */
+TEST(TestExecutor, SpawnNPCsWhenReady)
+{
+  const auto node = makeNode("test_test_executor");
+
+  auto configuration = makeConfiguration();
+  configuration.in_process_simulator = true;
+
+  const auto api = std::make_shared<traffic_simulator::API>(node, configuration);
+
+  TestDescription description;
+  NPCDescription npc;
+  npc.name = "npc0";
+  npc.speed = 1.0;
+  npc.start_position = makeSpawnPose(10.0);
+  description.npcs_descriptions.push_back(npc);
+
+  common::JUnit5 results;
+  TestExecutor executor(
+    api, description, JunitXmlReporterTestCase(results.testsuite("random_test").testcase("0")),
+    SimulatorType::UNITY, ArchitectureType::AWF_UNIVERSE, node->get_logger());
+
+  executor.initialize();
+  EXPECT_FALSE(api->entityExists(npc.name));
+
+  executor.update(api->getCurrentTime());
+  ASSERT_TRUE(api->entityExists(npc.name));
+  const auto status = api->getEntityStatus(npc.name);
+  EXPECT_EQ(status->lanelet_pose.lanelet_id, spawn_lanelet_id);
+  EXPECT_NEAR(status->lanelet_pose.s, 10.0, npc.speed * 0.05 + 1e-3);
+  EXPECT_FALSE(executor.scenarioCompleted());
+
+  executor.deinitialize();
+  EXPECT_FALSE(api->entityExists(npc.name));
+}
+
+int main(int argc, char ** argv)
+{
+  rclcpp::init(argc, argv);
+  testing::InitGoogleTest(&argc, argv);
+  const auto result = RUN_ALL_TESTS();
+  rclcpp::shutdown();
+  return result;
+}
@@ -0,0 +1,90 @@
+// Copyright 2015-2021 Tier IV, Inc. All rights reserved.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+// Co-developed by Tier IV, Inc. and Robotec.AI sp. z o.o.
+
+#include <gtest/gtest.h>
+
+#include <boost/filesystem.hpp>
+#include <string>
+
+#include "random_test_runner/file_interactions/junit_xml_reporter.hpp"
+#include "random_test_runner/test_queue.hpp"
+
+auto makeDirectory(const std::string & name)
+{
+  const auto directory = boost::filesystem::temp_directory_path() /
+                         boost::filesystem::unique_path("test_test_queue_%%%%%%%%") / name;
+  boost::filesystem::create_directories(directory);
+  return directory;
+}
+
+TEST(TestQueue, Claim)
+{
+  const TestQueue queue(makeDirectory("queue"));
+  queue.reset();
+  EXPECT_FALSE(queue.claimant(0));
+  EXPECT_TRUE(queue.claim(0, 1));
+  EXPECT_FALSE(queue.claim(0, 2));
+  EXPECT_TRUE(queue.claim(1, 2));
+  ASSERT_TRUE(queue.claimant(0));
+  EXPECT_EQ(queue.claimant(0).get(), 1);
+  ASSERT_TRUE(queue.claimant(1));
+  EXPECT_EQ(queue.claimant(1).get(), 2);
+}
+
+TEST(TestQueue, Reset)
+{
+  const TestQueue queue(makeDirectory("queue"));
+  EXPECT_TRUE(queue.claim(0, 1));
+  queue.reset();
+  EXPECT_FALSE(queue.claimant(0));
+  EXPECT_TRUE(queue.claim(0, 2));
+}
+
+/**
+ * A worker writes the results of the tests it has completed. The test it was running when it
+ * crashed has no result and is reported as lost by the supervisor.
+ */
+TEST(JunitXmlReporter, ReportLostTestCase)
+{
+  const auto worker_directory = makeDirectory("worker_0");
+  JunitXmlReporter worker(rclcpp::get_logger("worker"));
+  worker.init(worker_directory.string());
+  worker.spawnTestCase("random_test", "0");
+  worker.write();
+
+  const auto directory = worker_directory.parent_path();
+  JunitXmlReporter supervisor(rclcpp::get_logger("supervisor"));
+  supervisor.init(directory.string());
+  supervisor.merge(worker_directory / "result.junit.xml");
+  EXPECT_TRUE(supervisor.hasTestCase("random_test", "0"));
+  EXPECT_FALSE(supervisor.hasTestCase("random_test", "1"));
+  supervisor.spawnTestCase("random_test", "1").reportLost("Worker 0 crashed");
+  supervisor.write();
+
+  pugi::xml_document document;
+  ASSERT_TRUE(document.load_file((directory / "result.junit.xml").c_str()));
+  const auto testsuite = document.child("testsuites").child("testsuite");
+  EXPECT_TRUE(testsuite.find_child_by_attribute("testcase", "name", "0").child("error").empty());
+  const auto error = testsuite.find_child_by_attribute("testcase", "name", "1").child("error");
+  EXPECT_STREQ(error.attribute("type").value(), "lost");
+  EXPECT_STREQ(error.attribute("message").value(), "Worker 0 crashed");
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -21,7 +21,7 @@ from launch import LaunchDescription
 
 from launch.actions import DeclareLaunchArgument, OpaqueFunction, Shutdown
 
-from launch.conditions import IfCondition
+from launch.conditions import IfCondition, UnlessCondition
 
 from launch.substitutions import LaunchConfiguration
 
@@ -57,52 +57,76 @@ def default_autoware_launch_file_of(architecture_type):
 def launch_setup(context, *args, **kwargs):
     # fmt: off
     architecture_type       = LaunchConfiguration("architecture_type",       default="awf/universe")
+    as_fast_as_possible     = LaunchConfiguration("as_fast_as_possible",     default=False)
     autoware_launch_file    = LaunchConfiguration("autoware_launch_file",    default=default_autoware_launch_file_of(architecture_type.perform(context)))
     autoware_launch_package = LaunchConfiguration("autoware_launch_package", default=default_autoware_launch_package_of(architecture_type.perform(context)))
+    context_publish_rate    = LaunchConfiguration("context_publish_rate",    default=10.0)
+    debug_marker_publish_decimation = LaunchConfiguration("debug_marker_publish_decimation", default=1)
+    entity_status_publish_decimation = LaunchConfiguration("entity_status_publish_decimation", default=1)
     global_frame_rate       = LaunchConfiguration("global_frame_rate",       default=30.0)
     global_real_time_factor = LaunchConfiguration("global_real_time_factor", default=1.0)
     global_timeout          = LaunchConfiguration("global_timeout",          default=180)
+    in_process_simulator    = LaunchConfiguration("in_process_simulator",    default=False)
     initialize_duration     = LaunchConfiguration("initialize_duration",     default=30)
     launch_autoware         = LaunchConfiguration("launch_autoware",         default=True)
     launch_rviz             = LaunchConfiguration("launch_rviz",             default=False)
+    maximum_real_time_factor = LaunchConfiguration("maximum_real_time_factor", default=0.0)
     output_directory        = LaunchConfiguration("output_directory",        default=Path("/tmp"))
     port                    = LaunchConfiguration("port",                    default=8080)
+    profile                 = LaunchConfiguration("profile",                 default=False)
     record                  = LaunchConfiguration("record",                  default=True)
     scenario                = LaunchConfiguration("scenario",                default=Path("/dev/null"))
     sensor_model            = LaunchConfiguration("sensor_model",            default="")
     vehicle_model           = LaunchConfiguration("vehicle_model",           default="")
     workflow                = LaunchConfiguration("workflow",                default=Path("/dev/null"))
     sigterm_timeout         = LaunchConfiguration("sigterm_timeout",         default=8)
+    track_condition_dependencies = LaunchConfiguration("track_condition_dependencies", default=True)
     # fmt: on
 
     print(f"architecture_type       := {architecture_type.perform(context)}")
+    print(f"as_fast_as_possible     := {as_fast_as_possible.perform(context)}")
     print(f"autoware_launch_file    := {autoware_launch_file.perform(context)}")
     print(f"autoware_launch_package := {autoware_launch_package.perform(context)}")
+    print(f"context_publish_rate    := {context_publish_rate.perform(context)}")
+    print(f"debug_marker_publish_decimation := {debug_marker_publish_decimation.perform(context)}")
+    print(f"entity_status_publish_decimation := {entity_status_publish_decimation.perform(context)}")
     print(f"global_frame_rate       := {global_frame_rate.perform(context)}")
     print(f"global_real_time_factor := {global_real_time_factor.perform(context)}")
     print(f"global_timeout          := {global_timeout.perform(context)}")
+    print(f"in_process_simulator    := {in_process_simulator.perform(context)}")
     print(f"initialize_duration     := {initialize_duration.perform(context)}")
     print(f"launch_autoware         := {launch_autoware.perform(context)}")
     print(f"launch_rviz             := {launch_rviz.perform(context)}")
+    print(f"maximum_real_time_factor := {maximum_real_time_factor.perform(context)}")
     print(f"output_directory        := {output_directory.perform(context)}")
     print(f"port                    := {port.perform(context)}")
+    print(f"profile                 := {profile.perform(context)}")
     print(f"record                  := {record.perform(context)}")
     print(f"scenario                := {scenario.perform(context)}")
     print(f"sensor_model            := {sensor_model.perform(context)}")
     print(f"vehicle_model           := {vehicle_model.perform(context)}")
     print(f"workflow                := {workflow.perform(context)}")
     print(f"sigterm_timeout         := {sigterm_timeout.perform(context)}")
+    print(f"track_condition_dependencies := {track_condition_dependencies.perform(context)}")
 
     def make_parameters():
         parameters = [
             {"architecture_type": architecture_type},
+            {"as_fast_as_possible": as_fast_as_possible},
             {"autoware_launch_file": autoware_launch_file},
             {"autoware_launch_package": autoware_launch_package},
+            {"context_publish_rate": context_publish_rate},
+            {"debug_marker_publish_decimation": debug_marker_publish_decimation},
+            {"entity_status_publish_decimation": entity_status_publish_decimation},
+            {"in_process_simulator": in_process_simulator},
             {"initialize_duration": initialize_duration},
             {"launch_autoware": launch_autoware},
+            {"maximum_real_time_factor": maximum_real_time_factor},
             {"port": port},
+            {"profile": profile},
             {"record": record},
             {"sensor_model": sensor_model},
+            {"track_condition_dependencies": track_condition_dependencies},
             {"vehicle_model": vehicle_model},
         ]
 
@@ -120,19 +144,27 @@ def launch_setup(context, *args, **kwargs):
     return [
         # fmt: off
         DeclareLaunchArgument("architecture_type",       default_value=architecture_type      ),
+        DeclareLaunchArgument("as_fast_as_possible",     default_value=as_fast_as_possible    ),
         DeclareLaunchArgument("autoware_launch_file",    default_value=autoware_launch_file   ),
         DeclareLaunchArgument("autoware_launch_package", default_value=autoware_launch_package),
+        DeclareLaunchArgument("context_publish_rate",    default_value=context_publish_rate   ),
+        DeclareLaunchArgument("debug_marker_publish_decimation", default_value=debug_marker_publish_decimation),
+        DeclareLaunchArgument("entity_status_publish_decimation", default_value=entity_status_publish_decimation),
         DeclareLaunchArgument("global_frame_rate",       default_value=global_frame_rate      ),
         DeclareLaunchArgument("global_real_time_factor", default_value=global_real_time_factor),
         DeclareLaunchArgument("global_timeout",          default_value=global_timeout         ),
+        DeclareLaunchArgument("in_process_simulator",    default_value=in_process_simulator   ),
         DeclareLaunchArgument("launch_autoware",         default_value=launch_autoware        ),
         DeclareLaunchArgument("launch_rviz",             default_value=launch_rviz            ),
+        DeclareLaunchArgument("maximum_real_time_factor", default_value=maximum_real_time_factor),
         DeclareLaunchArgument("output_directory",        default_value=output_directory       ),
+        DeclareLaunchArgument("profile",                 default_value=profile                ),
         DeclareLaunchArgument("scenario",                default_value=scenario               ),
         DeclareLaunchArgument("sensor_model",            default_value=sensor_model           ),
         DeclareLaunchArgument("vehicle_model",           default_value=vehicle_model          ),
         DeclareLaunchArgument("workflow",                default_value=workflow               ),
         DeclareLaunchArgument("sigterm_timeout",         default_value=sigterm_timeout        ),
+        DeclareLaunchArgument("track_condition_dependencies", default_value=track_condition_dependencies),
         # fmt: on
         Node(
             package="scenario_test_runner",
@@ -159,6 +191,7 @@ def launch_setup(context, *args, **kwargs):
             name="simple_sensor_simulator",
             output="screen",
             parameters=[{"port": port}],
+            condition=UnlessCondition(in_process_simulator),
         ),
         LifecycleNode(
             package="openscenario_interpreter",